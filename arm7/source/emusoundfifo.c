@@ -23,8 +23,13 @@ typedef enum {
   EMUARM7_INIT_SND = 0x123C,
   EMUARM7_STOP_SND = 0x123D,
   EMUARM7_PLAY_SND = 0x123E,
+  EMUARM7_POKEY_STREAM = 0x123F,
 } FifoMesType;
 
+extern void pokeyStreamStart(void *stream, u16 *out, u16 playback_freq);
+
+static u16 *emu_sound_buffer = 0;   // The buffer the emulator channel loops over - the POKEY stream writes its samples here
+
 //---------------------------------------------------------------------------------
 void soundEmuDataHandler(int bytes, void *user_data) 
 {
@@ -38,12 +43,17 @@ void soundEmuDataHandler(int bytes, void *user_data)
     case EMUARM7_PLAY_SND:
       channel = (msg.SoundPlay.format & 0xF0)>>4;
       SCHANNEL_SOURCE(channel) = (u32)msg.SoundPlay.data;
+      emu_sound_buffer = (u16*)msg.SoundPlay.data;
       SCHANNEL_REPEAT_POINT(channel) = msg.SoundPlay.loopPoint;
       SCHANNEL_LENGTH(channel) = msg.SoundPlay.dataSize;
       SCHANNEL_TIMER(channel) = SOUND_FREQ(msg.SoundPlay.freq);
       SCHANNEL_CR(channel) = SCHANNEL_ENABLE | SOUND_VOL(msg.SoundPlay.volume) | SOUND_PAN(msg.SoundPlay.pan) | ((msg.SoundPlay.format & 0xF) << 29) | (msg.SoundPlay.loop ? SOUND_REPEAT : SOUND_ONE_SHOT);
       break;
    
+    case EMUARM7_POKEY_STREAM:
+      pokeyStreamStart((void*)msg.SoundPlay.data, emu_sound_buffer, msg.SoundPlay.freq);
+      break;
+
     case EMUARM7_INIT_SND:
       break;
 
@@ -0,0 +1,131 @@
+/*
+ *
+ * A8DS - Atari 8-bit Emulator designed to run on the Nintendo DS/DSi is
+ * Copyright (c) 2021-2025 Dave Bernazzani (wavemotion-dave)
+
+ * Copying and distribution of this emulator, its source code and associated
+ * readme files, with or without modification, are permitted in any medium without
+ * royalty provided this full copyright notice (including the Atari800 one below)
+ * is used and wavemotion-dave, alekmaul (original port), Atari800 team (for the
+ * original source) and Avery Lee (Altirra OS) are credited and thanked profusely.
+ *
+ * The A8DS emulator is offered as-is, without any warranty.
+ *
+ * Since much of the original codebase came from the Atari800 project, and since
+ * that project is released under the GPL V2, this program and source must also
+ * be distributed using that same licensing model. See COPYING for the full license.
+ */
+#include <nds.h>
+
+// ---------------------------------------------------------------------------------
+// The ARM7 side of the POKEY register-write stream (see pokey_stream.h). We build
+// the very same pokeysnd.c that the ARM9 uses so the synthesis can't drift apart -
+// all we add here are the sound registers it reads (our shadows, rebuilt from the
+// stream) and the timer that drains the stream at the playback rate.
+// ---------------------------------------------------------------------------------
+#include "pokeysnd.c"
+#include "pokey_stream.h"
+
+UBYTE AUDF[4 * MAXPOKEYS];
+UBYTE AUDC[4 * MAXPOKEYS];
+UBYTE AUDCTL[MAXPOKEYS];
+int Base_mult[MAXPOKEYS];
+const UBYTE *pokey_poly9 = NULL;
+const UBYTE *pokey_poly17 = NULL;
+
+static PokeyStream_t *pokey_stream = NULL;
+static u16 *pokey_out = NULL;       // The 2 sample loop the emulator sound channel is playing
+
+// Mirror of what POKEY_PutByte() does with the register before it updates the sound
+static void pokeyStreamWrite(u32 entry)
+{
+    UBYTE reg = POKEY_STREAM_REG(entry);
+    UBYTE val = POKEY_STREAM_VAL(entry);
+
+    if (reg < _AUDCTL)
+    {
+        if (reg & 1) AUDC[reg >> 1] = val;
+        else         AUDF[reg >> 1] = val;
+    }
+    else if (reg == _AUDCTL)
+    {
+        AUDCTL[0] = val;
+        Base_mult[0] = (val & CLOCK_15) ? DIV_15 : DIV_64;
+    }
+
+    Update_pokey_sound(reg, val, 0, SOUND_GAIN);
+}
+
+// ---------------------------------------------------------------------------------
+// Runs at the playback rate. Replay the stream until we have produced one sample
+// that is to be heard. If the stream runs dry (menus, the ARM9 is slow) we simply
+// hold the last sample - same as the ARM9 path does when it has nothing new - and
+// count it as an underrun.
+// ---------------------------------------------------------------------------------
+static void pokeyStreamTimer(void)
+{
+    u32 tail = pokey_stream->tail;
+    u32 head = pokey_stream->head;
+
+    for (;;)
+    {
+        if (tail == head)
+        {
+            pokey_stream->underruns++;
+            break;
+        }
+
+        u32 entry = pokey_stream->ring[tail];
+        tail = (tail + 1) & POKEY_STREAM_MASK;
+
+        if (entry & POKEY_STREAM_TICK)
+        {
+            unsigned char sample;
+            Pokey_process(&sample, 1);
+            if (entry & POKEY_STREAM_KEEP)
+            {
+                pokey_out[0] = pokey_out[1] = (sample << 8);
+                break;
+            }
+        }
+        else pokeyStreamWrite(entry);
+    }
+
+    pokey_stream->tail = tail;
+}
+
+void pokeyStreamStop(void)
+{
+    TIMER1_CR = 0;
+    irqDisable(IRQ_TIMER1);
+    pokey_stream = NULL;
+}
+
+// ---------------------------------------------------------------------------------
+// Start from a clean synthesizer - the ARM9 follows up with all of the registers.
+// Anything left in the ring from before is stale so we start at the current head.
+// ---------------------------------------------------------------------------------
+void pokeyStreamStart(void *stream, u16 *out, u16 playback_freq)
+{
+    pokeyStreamStop();
+    if (stream == NULL || out == NULL) return;
+
+    for (int i = 0; i < (4 * MAXPOKEYS); i++) AUDF[i] = AUDC[i] = 0;
+    for (int i = 0; i < MAXPOKEYS; i++)
+    {
+        AUDCTL[i] = 0;
+        Base_mult[i] = DIV_64;
+    }
+    Pokey_sound_init(FREQ_17_APPROX, playback_freq, 1, 0);
+
+    pokey_stream = (PokeyStream_t *) stream;
+    pokey_poly9  = pokey_stream->poly9;
+    pokey_poly17 = pokey_stream->poly17;
+    pokey_stream->tail = pokey_stream->head;
+    pokey_out = out;
+
+    TIMER1_DATA = TIMER_FREQ(playback_freq + 10);   // Very slightly faster to ensure we always swallow all the scanlines the ARM9 produces
+    TIMER1_CR = TIMER_DIV_1 | TIMER_IRQ_REQ | TIMER_ENABLE;
+    irqSet(IRQ_TIMER1, pokeyStreamTimer);
+    irqEnable(IRQ_TIMER1);
+}
@@ -0,0 +1,187 @@
+/*
+ * antic_span_test.c - equivalence test for the ANTIC mode E/F span kernels
+ *
+ * A8DS - Atari 8-bit Emulator designed to run on the Nintendo DS/DSi is
+ * Copyright (c) 2021-2025 Dave Bernazzani (wavemotion-dave)
+
+ * Copying and distribution of this emulator, its source code and associated
+ * readme files, with or without modification, are permitted in any medium without
+ * royalty provided this full copyright notice (including the Atari800 one below)
+ * is used and wavemotion-dave, alekmaul (original port), Atari800 team (for the
+ * original source) and Avery Lee (Altirra OS) are credited and thanked profusely.
+ *
+ * The A8DS emulator is offered as-is, without any warranty.
+ *
+ * Since much of the original codebase came from the Atari800 project, and since
+ * that project is released under the GPL V2, this program and source must also
+ * be distributed using that same licensing model. See COPYING for the full license.
+ */
+
+/*
+ * Checks antic_span_e() and antic_span_f() from antic_draw.s against the
+ * plain (no player/missile) path of the draw_antic_e() and draw_antic_f()
+ * loops in antic.c over random screen data, PM lines and run lengths. The
+ * count handed back, every screen word drawn and the words past the end of
+ * the span (which must not be touched) are all compared.
+ *
+ * On an ARM host the real kernels are linked in and run, e.g. with qemu
+ * from arm9/:
+ *
+ *   arm-linux-gnueabi-gcc -static -Wa,--defsym,ANTIC_ASM_KERNELS=1 -o antic_span_test host/antic_span_test.c source/emu/antic_draw.s
+ *   qemu-arm ./antic_span_test
+ *
+ * Anywhere else an instruction for instruction C model of the kernel is
+ * checked instead. That only verifies the scaling and masking as written
+ * out in the model, not the assembler itself:
+ *
+ *   gcc -O2 -o antic_span_test host/antic_span_test.c
+ *   ./antic_span_test
+ *
+ * Both print PASS and return 0 when the kernels match. The ARM run is the
+ * one that has to pass before ANTIC_ASM_KERNELS is turned on in antic.c.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+typedef uint8_t  UBYTE;
+typedef uint16_t UWORD;
+typedef uint32_t ULONG;
+
+#define MAX_CHARS   48
+#define GUARD_WORDS 8
+#define GUARD       0xDEAD
+#define RUNS        200000
+
+/* The kernels find these by name - in the emulator they live in DTCM in antic.c */
+UWORD lookup2[256];
+UWORD hires_lookup_n[128];
+#define hires_norm(x)   hires_lookup_n[(x) >> 1]
+
+#ifdef __arm__
+
+int antic_span_e(int nchars, const UBYTE *src, UWORD *dst, const ULONG *pm, ULONG background);
+int antic_span_f(int nchars, const UBYTE *src, UWORD *dst, const ULONG *pm, ULONG background);
+
+#else
+
+/* The ANTIC_SPAN macro one instruction at a time - the register names are kept so the two can be read side by side */
+static int antic_span_model(int r0, const UBYTE *r1, UWORD *r2, const ULONG *r3, ULONG r9,
+                            const UWORD *r12, int sh, ULONG m0, ULONG m1, ULONG m2, ULONG m3, int hires)
+{
+    ULONG r4, r5, r6, r7, lr = r9;
+    int r8 = r0;
+    const UBYTE *table = (const UBYTE *) r12;
+
+    do {
+        r4 = *r3++;                                             /* ldr r4, [r3], #4 */
+        r5 = *r1;                                               /* ldrb r5, [r1] */
+        if (r4 != 0) break;                                     /* cmp/bne 9f */
+        r1++;
+        r4 = r5 << sh;                                          /* movs r4, r5, lsl #sh */
+        if (r4 == 0) {                                          /* beq 2f */
+            *r2++ = (UWORD) r9; *r2++ = (UWORD) (r9 >> 16);     /* stmia r2!, {r9, lr} */
+            *r2++ = (UWORD) lr; *r2++ = (UWORD) (lr >> 16);
+            continue;
+        }
+        r5 = r4 & m0;
+        r6 = r4 & m1;
+        r5 = *(const UWORD *) (table + r5);                     /* ldrh r5, [r12, r5] */
+        r7 = r4 & m2;
+        r6 = *(const UWORD *) (table + r6);
+        r4 = r4 & m3;
+        if (hires) r4 <<= 2;
+        r7 = *(const UWORD *) (table + r7);
+        r4 = *(const UWORD *) (table + r4);
+        r5 = r5 | (r6 << 16);
+        r6 = r7 | (r4 << 16);
+        *r2++ = (UWORD) r5; *r2++ = (UWORD) (r5 >> 16);         /* stmia r2!, {r5, r6} */
+        *r2++ = (UWORD) r6; *r2++ = (UWORD) (r6 >> 16);
+    } while (--r0);                                             /* subs/bne 1b */
+    return r8 - r0;
+}
+
+static int antic_span_e(int nchars, const UBYTE *src, UWORD *dst, const ULONG *pm, ULONG background)
+{
+    return antic_span_model(nchars, src, dst, pm, background, lookup2, 1, 0x180, 0x060, 0x018, 0x006, 0);
+}
+
+static int antic_span_f(int nchars, const UBYTE *src, UWORD *dst, const ULONG *pm, ULONG background)
+{
+    return antic_span_model(nchars, src, dst, pm, background, hires_lookup_n, 0, 0xc0, 0x30, 0x0c, 0x03, 1);
+}
+
+#endif
+
+/* The no-PM branch of the draw_antic_e() / draw_antic_f() char loops, stopping at the first char with PM on it */
+static int reference_span(int mode_f, int nchars, const UBYTE *src, UWORD *ptr, const ULONG *pm, ULONG background)
+{
+    int done;
+    for (done = 0; done < nchars; done++, pm++) {
+        if (*pm) break;
+        int screendata = *src++;
+        if (screendata) {
+            if (mode_f) {
+                *ptr++ = hires_norm(screendata & 0xc0);
+                *ptr++ = hires_norm(screendata & 0x30);
+                *ptr++ = hires_norm(screendata & 0x0c);
+                *ptr++ = hires_norm((screendata & 0x03) << 2);
+            }
+            else {
+                *ptr++ = lookup2[screendata & 0xc0];
+                *ptr++ = lookup2[screendata & 0x30];
+                *ptr++ = lookup2[screendata & 0x0c];
+                *ptr++ = lookup2[screendata & 0x03];
+            }
+        }
+        else {
+            *ptr++ = (UWORD) background; *ptr++ = (UWORD) (background >> 16);
+            *ptr++ = (UWORD) background; *ptr++ = (UWORD) (background >> 16);
+        }
+    }
+    return done;
+}
+
+int main()
+{
+    static UBYTE src[MAX_CHARS];
+    static ULONG pm[MAX_CHARS];
+    static UWORD want[MAX_CHARS * 4 + GUARD_WORDS], got[MAX_CHARS * 4 + GUARD_WORDS];
+    int failures = 0;
+
+    srand(0xA8D5);
+    for (int run = 0; run < RUNS && failures < 10; run++) {
+        int mode_f = run & 1;
+        int nchars = 1 + rand() % MAX_CHARS;
+        ULONG background = ((ULONG) rand() << 16) ^ (ULONG) rand();
+
+        /* Every table entry random so a wrong index can't land on a matching colour */
+        for (int i = 0; i < 256; i++) lookup2[i] = (UWORD) rand();
+        for (int i = 0; i < 128; i++) hires_lookup_n[i] = (UWORD) rand();
+
+        for (int i = 0; i < MAX_CHARS; i++) {
+            src[i] = (rand() % 4 == 0) ? 0x00 : (UBYTE) rand();
+            pm[i] = 0;
+        }
+        if (rand() % 3) pm[rand() % MAX_CHARS] = 1u << (8 * (rand() % 4));  /* PM somewhere - maybe past the span */
+
+        for (int i = 0; i < MAX_CHARS * 4 + GUARD_WORDS; i++) want[i] = got[i] = GUARD;
+
+        int want_done = reference_span(mode_f, nchars, src, want, pm, background);
+        int got_done = mode_f ? antic_span_f(nchars, src, got, pm, background) : antic_span_e(nchars, src, got, pm, background);
+
+        if ((got_done != want_done) || memcmp(want, got, sizeof(want))) {
+            int i = 0;
+            while ((i < MAX_CHARS * 4 + GUARD_WORDS) && (want[i] == got[i])) i++;
+            if (i == MAX_CHARS * 4 + GUARD_WORDS) i = 0;
+            printf("FAIL run %d mode %c nchars %d: done %d (want %d), first bad word %d (%04x, want %04x)\n",
+                   run, mode_f ? 'F' : 'E', nchars, got_done, want_done, i, got[i], want[i]);
+            failures++;
+        }
+    }
+
+    printf("%s\n", failures ? "FAIL" : "PASS");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,111 @@
+/*
+ * cpu_test.c - host build of the 6502 timing and conformance self test
+ *
+ * A8DS - Atari 8-bit Emulator designed to run on the Nintendo DS/DSi is
+ * Copyright (c) 2021-2025 Dave Bernazzani (wavemotion-dave)
+
+ * Copying and distribution of this emulator, its source code and associated
+ * readme files, with or without modification, are permitted in any medium without
+ * royalty provided this full copyright notice (including the Atari800 one below)
+ * is used and wavemotion-dave, alekmaul (original port), Atari800 team (for the
+ * original source) and Avery Lee (Altirra OS) are credited and thanked profusely.
+ *
+ * The A8DS emulator is offered as-is, without any warranty.
+ *
+ * Since much of the original codebase came from the Atari800 project, and since
+ * that project is released under the GPL V2, this program and source must also
+ * be distributed using that same licensing model. See COPYING for the full license.
+ */
+
+/*
+ * Runs the tests from cputest.c (the CPU TEST key on the DS) against the real
+ * GO() from cpu.c on a flat 64K of RAM - no ROM, no hardware, no cart windows -
+ * so a change to the CPU core can be checked in seconds:
+ *
+ *  - every documented opcode single-stepped and its cycles checked against the
+ *    NMOS 6502 timings, page crossings and branches included, and
+ *
+ *  - the Klaus Dormann functional and decimal tests run to their end trap if
+ *    6502_functional_test.bin / 6502_decimal_test.bin are in the directory it
+ *    is run from (they are not ours to ship - see cputest.c for how they are
+ *    assembled). They are skipped otherwise.
+ *
+ * To build and run from arm9/:
+ *
+ *   gcc -O2 -Ihost -Isource/emu -Isource -o cpu_test host/cpu_test.c
+ *   ./cpu_test
+ *
+ * Prints the same report the DS writes to the SD card, then PASS and returns 0
+ * when everything that could be run passed.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cpu.c"
+
+// ---------------------------------------------------------------------------------
+// Just the memory that GO() reaches - the banks, the page descriptors and the
+// handler tables that are all left empty for the flat map.
+// ---------------------------------------------------------------------------------
+UBYTE memory[0x10000];
+UBYTE fast_page[0x1000];
+UBYTE *mem_map[20];
+rdfunc readmap[256];
+wrfunc writemap[256];
+UBYTE *page_rd[256];
+UBYTE *page_wr[256];
+UBYTE cart_paging = 0;
+void CART_PageIn(const UBYTE *ptr) { (void) ptr; }
+void ROM_PutByte(UWORD addr, UBYTE value) { (void) addr; (void) value; }
+
+extern inline UBYTE dGetByte(UWORD addr);
+extern inline void dPutByte(UWORD addr, UBYTE data);
+extern inline UWORD zGetByte(UWORD addr);
+extern inline void zPutByte(UWORD addr, UBYTE data);
+extern inline UWORD zGetWord(UWORD addr);
+extern inline void MEMORY_MapBank(unsigned int bank, UBYTE *ptr);
+extern inline void MEMORY_SetReadHandler(unsigned int page, rdfunc handler);
+extern inline void MEMORY_SetWriteHandler(unsigned int page, wrfunc handler);
+
+// ANTIC's side of the CPU loop - never drawing and no WSYNC pending
+int xpos = 0;
+int xpos_limit = 0;
+UBYTE wsync_halt = 0;
+UBYTE delayed_wsync = 0;
+int cur_screen_pos = NOT_DRAWING;
+const UBYTE *antic2cpu_ptr = NULL;
+void ESC_Run(UBYTE esc_code) { (void) esc_code; }
+
+// The bench device host clock stands in for the DS timer when timing the functional test
+#define BUS_CLOCK 33513982
+static void BENCH_ClockStart(u16 reload, VoidFn handler) { (void) reload; (void) handler; }
+static void BENCH_ClockRelease(void) { }
+static u32 BENCH_HostClock(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u32) ((u64) ts.tv_sec * BUS_CLOCK + ((u64) ts.tv_nsec * BUS_CLOCK) / 1000000000u);
+}
+
+#define CPUTEST_HOST
+#define CPUTEST_DIR ""
+#include "cputest.c"
+#undef printf              // atari.h points it at the emulator's own printf_()
+
+int main()
+{
+    u8 failed = 0;
+
+    printf("A8DS 6502 SELF TEST\n\n");
+    CpuFlatMemory();
+    if (CpuTimingTest(stdout)) failed = 1;
+    for (int i = 0; i < (int) (sizeof(test_images) / sizeof(test_images[0])); i++)
+    {
+        if (CpuImageTest(stdout, &test_images[i]) == 1) failed = 1;
+    }
+
+    printf("%s\n", failed ? "FAIL" : "PASS");
+    return failed;
+}
@@ -0,0 +1,62 @@
+/*
+ * nds.h - host stand-in for the few libnds pieces the host tests need
+ *
+ * A8DS - Atari 8-bit Emulator designed to run on the Nintendo DS/DSi is
+ * Copyright (c) 2021-2025 Dave Bernazzani (wavemotion-dave)
+
+ * Copying and distribution of this emulator, its source code and associated
+ * readme files, with or without modification, are permitted in any medium without
+ * royalty provided this full copyright notice (including the Atari800 one below)
+ * is used and wavemotion-dave, alekmaul (original port), Atari800 team (for the
+ * original source) and Avery Lee (Altirra OS) are credited and thanked profusely.
+ *
+ * The A8DS emulator is offered as-is, without any warranty.
+ *
+ * Since much of the original codebase came from the Atari800 project, and since
+ * that project is released under the GPL V2, this program and source must also
+ * be distributed using that same licensing model. See COPYING for the full license.
+ */
+#ifndef _HOST_NDS_H_
+#define _HOST_NDS_H_
+
+// ---------------------------------------------------------------------------------
+// The host tests in this directory build real emulator sources (the sound code,
+// the ARM7 pokeystream7.c, POKEY's timers...) with an ordinary gcc. This header takes the place of libnds
+// for them: the types, empty TCM placement, no-op cache calls and a pretend TIMER1
+// whose IRQ handler the test calls itself. It is never seen by the DS build.
+// ---------------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef uint8_t  u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef int8_t   s8;
+typedef int16_t  s16;
+typedef int32_t  s32;
+typedef uint64_t u64;
+typedef void (*VoidFn)(void);
+
+#define ITCM_CODE
+#define DTCM_DATA
+
+#define BIT(n)              (1 << (n))
+#define IRQ_TIMER1          BIT(4)
+#define TIMER_ENABLE        BIT(7)
+#define TIMER_IRQ_REQ       BIT(6)
+#define TIMER_DIV_1         0
+#define TIMER_FREQ(n)       (-0x2000000/(n))
+
+extern u16 host_timer1_cr, host_timer1_data;
+extern VoidFn host_timer1_irq;
+#define TIMER1_CR           host_timer1_cr
+#define TIMER1_DATA         host_timer1_data
+
+static inline void DC_FlushRange(const void *base, u32 size)  { (void) base; (void) size; }
+static inline void *memUncached(void *address)                  { return address; }
+
+static inline void irqSet(u32 irq, VoidFn handler)  { if (irq == IRQ_TIMER1) host_timer1_irq = handler; }
+static inline void irqEnable(u32 irq)               { (void) irq; }
+static inline void irqDisable(u32 irq)              { if (irq == IRQ_TIMER1) host_timer1_irq = 0; }
+
+#endif
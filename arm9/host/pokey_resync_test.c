@@ -0,0 +1,156 @@
+/*
+ * pokey_resync_test.c - host test of the ARM7 POKEY stream resync
+ *
+ * A8DS - Atari 8-bit Emulator designed to run on the Nintendo DS/DSi is
+ * Copyright (c) 2021-2025 Dave Bernazzani (wavemotion-dave)
+
+ * Copying and distribution of this emulator, its source code and associated
+ * readme files, with or without modification, are permitted in any medium without
+ * royalty provided this full copyright notice (including the Atari800 one below)
+ * is used and wavemotion-dave, alekmaul (original port), Atari800 team (for the
+ * original source) and Avery Lee (Altirra OS) are credited and thanked profusely.
+ *
+ * The A8DS emulator is offered as-is, without any warranty.
+ *
+ * Since much of the original codebase came from the Atari800 project, and since
+ * that project is released under the GPL V2, this program and source must also
+ * be distributed using that same licensing model. See COPYING for the full license.
+ */
+
+/*
+ * Fills the stream ring from the real pokey.c with the ARM7 stopped, so the
+ * sound register writes that follow are dropped, then lets the ARM7 catch up
+ * and checks what the next scanline sends to put it right:
+ *
+ *  - SKCTL, AUDCTL and every AUDF/AUDC with their current values, and
+ *
+ *  - an STIMER after the AUDFs when, and only when, an STIMER was dropped -
+ *    including when the resync itself only partly fits.
+ *
+ * To build and run from arm9/:
+ *
+ *   gcc -O2 -Ihost -Isource/emu -Isource -o pokey_resync_test host/pokey_resync_test.c
+ *   ./pokey_resync_test
+ *
+ * Prints PASS and returns 0 when every check holds.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "pokey.c"
+#undef printf               // atari.h points it at the emulator's own printf_()
+
+// The few things pokey.c reaches for outside itself
+unsigned int screenline_cpu_clock = 0;
+int xpos = 0;
+int cur_screen_pos = NOT_DRAWING;
+const SBYTE *cpu2antic_ptr = NULL;
+UBYTE IRQ = 0;
+UBYTE PIA_IRQ = 0;
+UBYTE POTENA = 0;
+int CASSETTE_IOLineStatus(void) { return 0; }
+int CASSETTE_GetInputIRQDelay(void) { return 0; }
+int SIO_GetByte(void) { return 0; }
+void SIO_PutByte(int byte) { (void) byte; }
+void Pokey_process(void *sndbuffer, unsigned int sndn) { (void) sndbuffer; (void) sndn; }
+static void no_sound(uint16 addr, uint8 val, uint8 chip, uint8 gain) { (void) addr; (void) val; (void) chip; (void) gain; }
+void (*Update_pokey_sound)(uint16 addr, uint8 val, uint8 chip, uint8 gain) = no_sound;
+
+static PokeyStream_t *stream;
+static int failures = 0;
+
+static void run_line(void)
+{
+    POKEY_Scanline();
+    screenline_cpu_clock += LINE_C;
+}
+
+// The ARM7 stops reading - run scanlines until the ring is full and the TICKs start being dropped
+static void fill_ring(void)
+{
+    while (((stream->head + 1) & POKEY_STREAM_MASK) != stream->tail) run_line();
+    run_line();
+}
+
+// The ARM7 catches up as far as leaving 'room' entries free
+static void drain_ring(u32 room)
+{
+    stream->tail = (stream->head - (POKEY_STREAM_SIZE - 1 - room)) & POKEY_STREAM_MASK;
+}
+
+// Where the register write is among the entries from 'from' up to the head, or -1
+static int find_write(u32 from, UBYTE reg, UBYTE val)
+{
+    for (u32 i = from, n = 0; i != stream->head; i = (i + 1) & POKEY_STREAM_MASK, n++) {
+        u32 entry = stream->ring[i];
+        if (!(entry & POKEY_STREAM_TICK) && (POKEY_STREAM_REG(entry) == reg) && (POKEY_STREAM_VAL(entry) == val)) return n;
+    }
+    return -1;
+}
+
+static int find_stimer(u32 from)
+{
+    for (u32 i = from, n = 0; i != stream->head; i = (i + 1) & POKEY_STREAM_MASK, n++) {
+        u32 entry = stream->ring[i];
+        if (!(entry & POKEY_STREAM_TICK) && (POKEY_STREAM_REG(entry) == _STIMER)) return n;
+    }
+    return -1;
+}
+
+static void check(int ok, const char *what)
+{
+    if (!ok) {
+        printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+int main()
+{
+    POKEY_Initialise();
+    pokey_decimate = 1;
+    stream = POKEY_StreamEnable(1);
+    run_line();                             // The resync every new stream starts with
+
+    // Case 1: the writes of a game setting up a tune - two-tone serial, a new clock, a tone, then STIMER - all dropped
+    fill_ring();
+    POKEY_PutByte(_SKCTLS, 0x0b);
+    POKEY_PutByte(_AUDCTL, 0x01);
+    POKEY_PutByte(_AUDF1, 0x40);
+    POKEY_PutByte(_AUDC1, 0xa8);
+    POKEY_PutByte(_STIMER, 0x00);
+    drain_ring(POKEY_STREAM_SIZE - 1);
+    u32 from = stream->head;
+    run_line();
+    check(find_write(from, _SKCTLS, 0x0b) >= 0, "SKCTL not re-sent");
+    check(find_write(from, _AUDCTL, 0x01) >= 0, "AUDCTL not re-sent");
+    check(find_write(from, _AUDC1, 0xa8) >= 0, "AUDC1 not re-sent");
+    check(find_write(from, _AUDF1, 0x40) >= 0, "AUDF1 not re-sent");
+    check(find_stimer(from) > find_write(from, _AUDF4, AUDF[CHAN4]), "dropped STIMER not re-sent after the AUDFs");
+
+    // Case 2: a dropped volume change only - the resync must not restart the counters
+    fill_ring();
+    POKEY_PutByte(_AUDC1, 0xa4);
+    drain_ring(POKEY_STREAM_SIZE - 1);
+    from = stream->head;
+    run_line();
+    check(find_write(from, _AUDC1, 0xa4) >= 0, "AUDC1 not re-sent");
+    check(find_stimer(from) < 0, "STIMER sent when none was dropped");
+
+    // Case 3: STIMER dropped, then only room for part of the resync - the next one has to carry the STIMER
+    fill_ring();
+    POKEY_PutByte(_AUDF2, 0x55);
+    POKEY_PutByte(_STIMER, 0x00);
+    drain_ring(3);
+    from = stream->head;
+    run_line();
+    check(find_stimer(from) < 0, "STIMER fitted in a ring with room for 3");
+    drain_ring(POKEY_STREAM_SIZE - 1);
+    from = stream->head;
+    run_line();
+    check(find_write(from, _AUDF2, 0x55) >= 0, "AUDF2 not re-sent after a partial resync");
+    check(find_stimer(from) >= 0, "STIMER lost in a partial resync");
+
+    printf("%s\n", failures ? "FAIL" : "PASS");
+    return failures ? 1 : 0;
+}
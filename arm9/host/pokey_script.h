@@ -0,0 +1,98 @@
+/*
+ * pokey_script.h - POKEY register scripts for the host sound tests
+ *
+ * A8DS - Atari 8-bit Emulator designed to run on the Nintendo DS/DSi is
+ * Copyright (c) 2021-2025 Dave Bernazzani (wavemotion-dave)
+
+ * Copying and distribution of this emulator, its source code and associated
+ * readme files, with or without modification, are permitted in any medium without
+ * royalty provided this full copyright notice (including the Atari800 one below)
+ * is used and wavemotion-dave, alekmaul (original port), Atari800 team (for the
+ * original source) and Avery Lee (Altirra OS) are credited and thanked profusely.
+ *
+ * The A8DS emulator is offered as-is, without any warranty.
+ *
+ * Since much of the original codebase came from the Atari800 project, and since
+ * that project is released under the GPL V2, this program and source must also
+ * be distributed using that same licensing model. See COPYING for the full license.
+ */
+#ifndef _HOST_POKEY_SCRIPT_H_
+#define _HOST_POKEY_SCRIPT_H_
+
+// ---------------------------------------------------------------------------------
+// Register scripts in the POKEY stream format (pokey_stream.h) - a list of register
+// writes with a TICK for every scanline, KEEP marking the samples to be heard. They
+// are recorded from a pretend game's music driver rather than a real one but they
+// hit the same cases: a burst of writes in the VBI, the odd write mid-frame and now
+// and then an AUDCTL, STIMER or a stretch of Fast Forward (only every Nth sample kept).
+// ---------------------------------------------------------------------------------
+#define SCRIPT_SCANLINES    262
+
+#define SCRIPT_MUSIC        0       // Mostly plain tones and volumes on the 64KHz clock
+#define SCRIPT_LOW          1       // Joined 16-bit channels, the 15KHz clock and filters - long channel events
+#define SCRIPT_QUIET        2       // Music after over ten seconds with every channel silent
+
+typedef struct
+{
+    u32 *entry;
+    int len;
+    int keeps;
+} Script_t;
+
+// Same as POKEY_Initialise() in pokey.c
+static void make_polys(UBYTE *poly9, UBYTE *poly17)
+{
+    ULONG reg = 0x1ff;
+    for (int i = 0; i < 511; i++) {
+        reg = ((((reg >> 5) ^ reg) & 1) << 8) + (reg >> 1);
+        poly9[i] = (UBYTE) reg;
+    }
+    reg = 0x1ffff;
+    for (int i = 0; i < 16385; i++) {
+        reg = ((((reg >> 5) ^ reg) & 0xff) << 9) + (reg >> 8);
+        poly17[i] = (UBYTE) (reg >> 1);
+    }
+}
+
+static void script_add(Script_t *script, u32 entry)
+{
+    script->entry[script->len++] = entry;
+    if (entry & POKEY_STREAM_KEEP) script->keeps++;
+}
+
+static UBYTE script_audctl(int style)
+{
+    if (style != SCRIPT_LOW) return (UBYTE) rand();
+    return (UBYTE) ((rand() & (POLY9 | CH1_FILTER | CH2_FILTER)) | ((rand() % 4) ? (CH1_CH2 | CH3_CH4) : 0) | ((rand() % 2) ? CLOCK_15 : 0));
+}
+
+static void make_script(Script_t *script, int frames, int style, int decimating, unsigned seed)
+{
+    UBYTE decimate = 1, ctr = 0;
+    int quiet = (style == SCRIPT_QUIET) ? 700 : 0;     // 700 frames is 11.7 seconds - Samp_n_cnt goes past 24 whole bits
+
+    script->entry = malloc(sizeof(u32) * frames * SCRIPT_SCANLINES * 3);
+    script->len = script->keeps = 0;
+
+    srand(seed);
+    for (int chan = CHAN1; chan <= CHAN4; chan++) script_add(script, POKEY_STREAM_WRITE(_AUDC1 + (chan << 1), 0));
+
+    for (int frame = 0; frame < frames; frame++) {
+        if (decimating && ((frame % 200) == 0)) decimate = (rand() % 3) ? 1 : 2 + rand() % 4;
+        for (int line = 0; line < SCRIPT_SCANLINES; line++) {
+            int writes = (frame < quiet) ? 0 : ((line == 248) ? 4 + rand() % 6 : ((rand() % 40) == 0));
+            while (writes--) {
+                int r = rand() % 100;
+                UBYTE reg = (r < 2) ? _AUDCTL : ((r < 3) ? _STIMER : rand() % 8);
+                UBYTE val = (reg == _AUDCTL) ? script_audctl(style) : (UBYTE) rand();
+                if ((reg & 1) && (reg < _AUDCTL) && (rand() % 4)) val = (val & 0xe0) | (val & 0x0f);    // Mostly plain tone/volume AUDC values
+                script_add(script, POKEY_STREAM_WRITE(reg, val));
+            }
+            UBYTE keep = (++ctr >= decimate);
+            if (keep) ctr = 0;
+            script_add(script, keep ? (POKEY_STREAM_TICK | POKEY_STREAM_KEEP) : POKEY_STREAM_TICK);
+        }
+    }
+}
+
+#endif
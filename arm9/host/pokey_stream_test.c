@@ -0,0 +1,219 @@
+/*
+ * pokey_stream_test.c - host test of the ARM9 to ARM7 POKEY register stream
+ *
+ * A8DS - Atari 8-bit Emulator designed to run on the Nintendo DS/DSi is
+ * Copyright (c) 2021-2025 Dave Bernazzani (wavemotion-dave)
+
+ * Copying and distribution of this emulator, its source code and associated
+ * readme files, with or without modification, are permitted in any medium without
+ * royalty provided this full copyright notice (including the Atari800 one below)
+ * is used and wavemotion-dave, alekmaul (original port), Atari800 team (for the
+ * original source) and Avery Lee (Altirra OS) are credited and thanked profusely.
+ *
+ * The A8DS emulator is offered as-is, without any warranty.
+ *
+ * Since much of the original codebase came from the Atari800 project, and since
+ * that project is released under the GPL V2, this program and source must also
+ * be distributed using that same licensing model. See COPYING for the full license.
+ */
+
+/*
+ * Plays the same register script through both sound paths and checks that
+ * every sample that is to be heard comes out the same:
+ *
+ *  - the ARM9 path: POKEY_PutByte()'s register bookkeeping, Update_pokey_sound()
+ *    on each write and Pokey_process() once per scanline, keeping every Nth
+ *    sample the way POKEY_Scanline() does with pokey_decimate.
+ *
+ *  - the ARM7 path: a producer thread pushing the writes and scanline TICKs
+ *    into the PokeyStream_t ring exactly as POKEY_StreamPush() does, and a
+ *    consumer thread calling the real pokeystream7.c timer handler.
+ *
+ * The producer runs in frame sized bursts and both sides sleep at random so
+ * the ring wraps many times, runs dry (underruns) and fills up. Both paths
+ * are the real pokeysnd.c built the ARM7 way. To build and run from arm9/:
+ *
+ *   gcc -O2 -pthread -Ihost -Isource/emu -Isource -I../arm7/source -o pokey_stream_test host/pokey_stream_test.c
+ *   ./pokey_stream_test
+ *
+ * Prints PASS and returns 0 when the two sample streams match.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#define ARM7
+#include "pokeystream7.c"
+#undef printf      // atari.h points it at the emulator's own printf_()
+
+#include "pokey_script.h"
+
+#define PLAYBACK_FREQ   15720           // One sample per NTSC scanline - what the ARM9 path makes
+#define FRAMES          3000
+
+u16 host_timer1_cr, host_timer1_data;
+VoidFn host_timer1_irq;
+
+UBYTE poly9_lookup[511];
+UBYTE poly17_lookup[16385];
+
+static Script_t script;
+static PokeyStream_t stream;
+static u16 stream_out[2];
+static unsigned char *want, *got;
+static volatile int producer_done = 0;
+static volatile u32 producer_stalls = 0;
+
+static void reset_registers(void)
+{
+    for (int i = 0; i < (4 * MAXPOKEYS); i++) AUDF[i] = AUDC[i] = 0;
+    for (int i = 0; i < MAXPOKEYS; i++) {
+        AUDCTL[i] = 0;
+        Base_mult[i] = DIV_64;
+    }
+}
+
+// The register side of POKEY_PutByte() followed by the sound update
+static void arm9_put(UBYTE reg, UBYTE val)
+{
+    if (reg < _AUDCTL) {
+        if (reg & 1) AUDC[reg >> 1] = val;
+        else         AUDF[reg >> 1] = val;
+    }
+    else if (reg == _AUDCTL) {
+        AUDCTL[0] = val;
+        Base_mult[0] = (val & CLOCK_15) ? DIV_15 : DIV_64;
+    }
+    Update_pokey_sound(reg, val, 0, SOUND_GAIN);
+}
+
+// ---------------------------------------------------------------------------------
+// The ARM9 path. POKEY_StreamEnable() always starts the ARM7 off with a resync of
+// all the registers so the reference gets the same writes first.
+// ---------------------------------------------------------------------------------
+static void run_arm9(void)
+{
+    int n = 0;
+
+    reset_registers();
+    pokey_poly9 = poly9_lookup;
+    pokey_poly17 = poly17_lookup;
+    Pokey_sound_init(FREQ_17_APPROX, PLAYBACK_FREQ, 1, 0);
+
+    arm9_put(_SKCTLS, 0);
+    arm9_put(_AUDCTL, 0);
+    for (int chan = CHAN1; chan <= CHAN4; chan++) {
+        arm9_put(_AUDF1 + (chan << 1), 0);
+        arm9_put(_AUDC1 + (chan << 1), 0);
+    }
+
+    for (int i = 0; i < script.len; i++) {
+        u32 entry = script.entry[i];
+        if (entry & POKEY_STREAM_TICK) {
+            unsigned char sample;
+            Pokey_process(&sample, 1);
+            if (entry & POKEY_STREAM_KEEP) want[n++] = sample;
+        }
+        else arm9_put(POKEY_STREAM_REG(entry), POKEY_STREAM_VAL(entry));
+    }
+}
+
+// ---------------------------------------------------------------------------------
+// The ARM7 path. The producer is POKEY_StreamPush() from pokey.c except that when
+// the ring is full it waits instead of dropping the entry and resyncing later - a
+// dropped TICK is an audible glitch on the DS too, so it can't match the reference.
+// ---------------------------------------------------------------------------------
+static u32 stream_head = 0, stream_room = 0;
+
+static void stream_push(u32 entry)
+{
+    while (stream_room == 0) {
+        stream_room = (stream.tail - stream_head - 1) & POKEY_STREAM_MASK;
+        if (stream_room == 0) {
+            producer_stalls++;
+            sched_yield();
+        }
+    }
+    stream_room--;
+    stream.ring[stream_head] = entry;
+    stream_head = (stream_head + 1) & POKEY_STREAM_MASK;
+    stream.head = stream_head;
+}
+
+static void *producer(void *arg)
+{
+    (void) arg;
+
+    stream_push(POKEY_STREAM_WRITE(_SKCTLS, 0));    // POKEY_StreamPushRegisters()
+    stream_push(POKEY_STREAM_WRITE(_AUDCTL, 0));
+    for (int chan = CHAN1; chan <= CHAN4; chan++) {
+        stream_push(POKEY_STREAM_WRITE(_AUDF1 + (chan << 1), 0));
+        stream_push(POKEY_STREAM_WRITE(_AUDC1 + (chan << 1), 0));
+    }
+
+    for (int i = 0, line = 0; i < script.len; i++) {
+        stream_push(script.entry[i]);
+        if ((script.entry[i] & POKEY_STREAM_TICK) && (++line == SCRIPT_SCANLINES)) {
+            line = 0;
+            if ((rand() % 4) == 0) usleep(rand() % 2000);  // End of frame - sometimes the ARM9 is well ahead, sometimes not
+        }
+    }
+    producer_done = 1;
+    return NULL;
+}
+
+static void *consumer(void *arg)
+{
+    int n = 0;
+    (void) arg;
+
+    while (n < script.keeps) {
+        u32 underruns = stream.underruns;
+        host_timer1_irq();
+        if (stream.underruns == underruns) got[n++] = stream_out[0] >> 8;
+        else if (producer_done && (stream.tail == stream.head)) break;     // Ran out for good - the counts won't match
+        if ((rand() % 1000) == 0) usleep(rand() % 3000);
+    }
+    return NULL;
+}
+
+int main()
+{
+    pthread_t prod, cons;
+    int failures = 0;
+
+    make_polys(poly9_lookup, poly17_lookup);
+    make_script(&script, FRAMES, SCRIPT_MUSIC, 1, 0xA8D5);
+    want = calloc(script.keeps, 1);
+    got = calloc(script.keeps, 1);
+
+    run_arm9();
+
+    memset(&stream, 0, sizeof(stream));
+    stream.poly9 = poly9_lookup;
+    stream.poly17 = poly17_lookup;
+    pokeyStreamStart(&stream, stream_out, PLAYBACK_FREQ);
+
+    pthread_create(&cons, NULL, consumer, NULL);
+    pthread_create(&prod, NULL, producer, NULL);
+    pthread_join(prod, NULL);
+    pthread_join(cons, NULL);
+    pokeyStreamStop();
+
+    for (int i = 0; i < script.keeps; i++) {
+        if (want[i] != got[i]) {
+            if (failures++ < 10) printf("FAIL sample %d: %02x, want %02x\n", i, got[i], want[i]);
+        }
+    }
+
+    free(want);
+    free(got);
+    free(script.entry);
+
+    printf("%d events, %d samples, %u underruns, %u producer stalls\n", script.len, script.keeps, (unsigned) stream.underruns, (unsigned) producer_stalls);
+    printf("%s\n", failures ? "FAIL" : "PASS");
+    return failures ? 1 : 0;
+}
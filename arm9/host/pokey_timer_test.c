@@ -0,0 +1,132 @@
+/*
+ * pokey_timer_test.c - host test of the POKEY timer event schedule
+ *
+ * A8DS - Atari 8-bit Emulator designed to run on the Nintendo DS/DSi is
+ * Copyright (c) 2021-2025 Dave Bernazzani (wavemotion-dave)
+
+ * Copying and distribution of this emulator, its source code and associated
+ * readme files, with or without modification, are permitted in any medium without
+ * royalty provided this full copyright notice (including the Atari800 one below)
+ * is used and wavemotion-dave, alekmaul (original port), Atari800 team (for the
+ * original source) and Avery Lee (Altirra OS) are credited and thanked profusely.
+ *
+ * The A8DS emulator is offered as-is, without any warranty.
+ *
+ * Since much of the original codebase came from the Atari800 project, and since
+ * that project is released under the GPL V2, this program and source must also
+ * be distributed using that same licensing model. See COPYING for the full license.
+ */
+
+/*
+ * Runs the real pokey.c timers scanline by scanline and frame by frame (the
+ * way Atari800_Frame() drives them) with the timer IRQs off for more than 2^31
+ * CPU cycles - past the reach of the wrap-safe cycle compare - then:
+ *
+ *  - checks that the cycles-to-underflow POKEY_SaveTimers() puts in a save
+ *    state are all within one timer period, and
+ *
+ *  - turns the IRQs on and checks that each one fires within a period, on
+ *    the same phase as if the timer had been running since STIMER.
+ *
+ * To build and run from arm9/:
+ *
+ *   gcc -O2 -Ihost -Isource/emu -Isource -o pokey_timer_test host/pokey_timer_test.c
+ *   ./pokey_timer_test
+ *
+ * Prints PASS and returns 0 when every check holds.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "pokey.c"
+#undef printf               // atari.h points it at the emulator's own printf_()
+
+#define SCANLINES       262
+#define IDLE_CYCLES     0x90000000u     // Well past 2^31
+
+// The few things pokey.c reaches for outside itself
+unsigned int screenline_cpu_clock = 0;
+int xpos = 0;
+int cur_screen_pos = NOT_DRAWING;
+const SBYTE *cpu2antic_ptr = NULL;
+UBYTE IRQ = 0;
+UBYTE PIA_IRQ = 0;
+UBYTE POTENA = 0;
+int CASSETTE_IOLineStatus(void) { return 0; }
+int CASSETTE_GetInputIRQDelay(void) { return 0; }
+int SIO_GetByte(void) { return 0; }
+void SIO_PutByte(int byte) { (void) byte; }
+void Pokey_process(void *sndbuffer, unsigned int sndn) { (void) sndbuffer; (void) sndn; }
+static void no_sound(uint16 addr, uint8 val, uint8 chip, uint8 gain) { (void) addr; (void) val; (void) chip; (void) gain; }
+void (*Update_pokey_sound)(uint16 addr, uint8 val, uint8 chip, uint8 gain) = no_sound;
+
+static void run_line(void)
+{
+    POKEY_Scanline();
+    screenline_cpu_clock += LINE_C;
+}
+
+static void run_frame(void)
+{
+    for (int line = 0; line < SCANLINES; line++) run_line();
+    POKEY_Frame();
+}
+
+int main()
+{
+    static const UBYTE irq_bit[4] = {0x01, 0x02, 0x00, 0x04};
+    int failures = 0;
+
+    POKEY_Initialise();
+    pokey_decimate = 0;                 // No sound wanted
+    screenline_cpu_clock = 0x7ffff000;  // Start near a sign change of the compare for good measure
+
+    // Three different periods on the 64KHz clock, CHAN3 too so the save state check covers it
+    POKEY_PutByte(_AUDCTL, 0x00);
+    POKEY_PutByte(_AUDF1, 0x3f);
+    POKEY_PutByte(_AUDF2, 0x81);
+    POKEY_PutByte(_AUDF3, 0x17);
+    POKEY_PutByte(_AUDF4, 0xf3);
+    POKEY_PutByte(_IRQEN, 0x00);
+    unsigned int stimer = cpu_clock;
+    POKEY_PutByte(_STIMER, 0x00);
+
+    unsigned int start = screenline_cpu_clock;
+    while ((screenline_cpu_clock - start) < IDLE_CYCLES) run_frame();
+
+    if (IRQ) { printf("FAIL: timer IRQ with IRQEN off\n"); failures++; }
+
+    POKEY_SaveTimers();
+    for (int chan = 0; chan < 4; chan++) {
+        if ((DivNIRQ[chan] < 0) || (DivNIRQ[chan] > DivNMax[chan])) {
+            printf("FAIL: timer %d saved %d cycles to go - period is %d\n", chan + 1, DivNIRQ[chan], DivNMax[chan]);
+            failures++;
+        }
+    }
+
+    for (int chan = 0; chan < 4; chan++) {
+        if (!irq_bit[chan]) continue;
+
+        run_frame();
+        IRQ = 0;
+        IRQST = 0xff;
+        unsigned int enabled = screenline_cpu_clock;
+        POKEY_PutByte(_IRQEN, irq_bit[chan]);
+        while (!IRQ && ((screenline_cpu_clock - enabled) <= (unsigned) DivNMax[chan] + LINE_C)) run_line();
+        UBYTE fired = IRQ;
+        POKEY_PutByte(_IRQEN, 0x00);    // Clears IRQ too
+
+        // POKEY_TimerEvents() has moved DivNDue on to the next underflow - it must still be on the STIMER phase
+        if (!fired) {
+            printf("FAIL: timer %d IRQ not seen within a period of being enabled\n", chan + 1);
+            failures++;
+        }
+        else if ((DivNDue[chan] - stimer) % DivNMax[chan]) {
+            printf("FAIL: timer %d IRQ out of phase by %u cycles\n", chan + 1, (DivNDue[chan] - stimer) % DivNMax[chan]);
+            failures++;
+        }
+    }
+
+    printf("%s\n", failures ? "FAIL" : "PASS");
+    return failures ? 1 : 0;
+}
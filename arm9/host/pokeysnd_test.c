@@ -0,0 +1,416 @@
+/*
+ * pokeysnd_test.c - host test and benchmark of the division-free Pokey_process()
+ *
+ * A8DS - Atari 8-bit Emulator designed to run on the Nintendo DS/DSi is
+ * Copyright (c) 2021-2025 Dave Bernazzani (wavemotion-dave)
+
+ * Copying and distribution of this emulator, its source code and associated
+ * readme files, with or without modification, are permitted in any medium without
+ * royalty provided this full copyright notice (including the Atari800 one below)
+ * is used and wavemotion-dave, alekmaul (original port), Atari800 team (for the
+ * original source) and Avery Lee (Altirra OS) are credited and thanked profusely.
+ *
+ * The A8DS emulator is offered as-is, without any warranty.
+ *
+ * Since much of the original codebase came from the Atari800 project, and since
+ * that project is released under the GPL V2, this program and source must also
+ * be distributed using that same licensing model. See COPYING for the full license.
+ */
+
+/*
+ * Plays register scripts (see pokey_script.h) through the current Pokey_process()
+ * and through the one it replaced - '%' on every poly position and the 40-bit
+ * Samp_n_cnt read and written a byte at a time - and checks that every sample and
+ * all of the synthesis state at the end come out the same. Each script is run at
+ * a few playback rates, including one low enough that the old code would have had
+ * Samp_n_max clamped.
+ *
+ * Then it times both over the same scripts. The host has a hardware divider so
+ * the numbers only hint at the gain on the DS - to see that build this file with
+ * the DS toolchain and run it there. To build and run from arm9/:
+ *
+ *   gcc -O2 -Ihost -Isource/emu -Isource -o pokeysnd_test host/pokeysnd_test.c
+ *   ./pokeysnd_test
+ *
+ * Prints PASS and returns 0 when the two match.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define ARM7                // Plain globals and no TCM placement
+#include "pokeysnd.c"
+#include "pokey_stream.h"
+#undef printf               // atari.h points it at the emulator's own printf_()
+
+#include "pokey_script.h"
+
+#define FRAMES          1500
+#define BENCH_RUNS      20
+#define BATCH_MAX       1024            // Pokey_process() counts in 16 bits
+
+UBYTE AUDF[4 * MAXPOKEYS];
+UBYTE AUDC[4 * MAXPOKEYS];
+UBYTE AUDCTL[MAXPOKEYS];
+int Base_mult[MAXPOKEYS];
+UBYTE poly9_lookup[511];
+UBYTE poly17_lookup[16385];
+const UBYTE *pokey_poly9 = poly9_lookup;
+const UBYTE *pokey_poly17 = poly17_lookup;
+
+typedef void (*ProcessFn)(void *sndbuffer, unsigned sndn);
+
+// Everything Pokey_process() reads or writes
+typedef struct
+{
+    uint32 p4, p5, p9, p17;
+    uint32 div_n_cnt[4 * MAXPOKEYS], div_n_max[4 * MAXPOKEYS];
+    uint32 samp_n_max, samp_n_cnt[2];
+    uint8  outvol[4 * MAXPOKEYS], outbit[4 * MAXPOKEYS], audv[4 * MAXPOKEYS];
+} SynthState_t;
+
+// ---------------------------------------------------------------------------------
+// Pokey_process() as it was before the wrap tables - kept word for word apart from
+// the name and the poly tables being reached through POKEY_POLY9/POKEY_POLY17.
+// ---------------------------------------------------------------------------------
+#define READ_U32(x) \
+  ((*(unsigned char *) (x)) | ((*((unsigned char *) (x) + 1)) << 8) | \
+  ((*((unsigned char *) (x) + 2)) << 16) | ((*((unsigned char *) (x) + 3)) << 24))
+#define WRITE_U32(x, d) \
+  { \
+  uint32 i = d; \
+  (*(unsigned char *)(x)) = ((i) & 255); \
+  (*((unsigned char *)(x) + 1)) = (((i) >> 8) & 255); \
+  (*((unsigned char *)(x) + 2)) = (((i) >> 16) & 255); \
+  (*((unsigned char *)(x) + 3)) = (((i) >> 24) & 255); \
+  }
+
+static void Pokey_process_div(void *sndbuffer, unsigned sndn)
+{
+    register char *buffer = (char  *) sndbuffer;
+    register uint16 n = sndn;
+
+    register uint32 *div_n_ptr;
+    register uint8 *samp_cnt_w_ptr;
+    register uint32 event_min;
+    register uint8 next_event;
+    register unsigned char cur_val;     /* otherwise we'll simplify as 8-bit unsigned */
+    register uint8 *out_ptr;
+    register uint8 audc;
+    register uint8 toggle;
+    register uint8 *vol_ptr;
+  
+    /* set a pointer to the whole portion of the samp_n_cnt */
+    samp_cnt_w_ptr = ((uint8 *) (&Samp_n_cnt[0]) + 1);
+
+    /* set a pointer for optimization */
+    out_ptr = Outvol;
+    vol_ptr = AUDV;
+
+    /* The current output is pre-determined and then adjusted based on each */
+    /* output change for increased performance (less over-all math). */
+    /* add the output values of all 4 channels */
+    cur_val = SAMP_MIN;
+    if (*out_ptr++) cur_val += *vol_ptr;
+    vol_ptr++;
+
+    if (*out_ptr++) cur_val += *vol_ptr;
+    vol_ptr++;
+
+    if (*out_ptr++) cur_val += *vol_ptr;
+    vol_ptr++;
+
+    if (*out_ptr++) cur_val += *vol_ptr;
+    vol_ptr++;
+
+    /* loop until the buffer is filled */
+    while (n) 
+    {
+        /* Normally the routine would simply decrement the 'div by N' */
+        /* counters and react when they reach zero.  Since we normally */
+        /* won't be processing except once every 80 or so counts, */
+        /* I've optimized by finding the smallest count and then */
+        /* 'accelerated' time by adjusting all pointers by that amount. */
+
+        /* find next smallest event (either sample or chan 1-4) */
+        next_event = SAMPLE;
+        event_min = READ_U32(samp_cnt_w_ptr);
+
+        div_n_ptr = Div_n_cnt;
+
+    /* Though I could have used a loop here, this is faster */
+    if (*div_n_ptr <= event_min) {
+        event_min = *div_n_ptr;
+        next_event = CHAN1;
+    }
+    div_n_ptr++;
+    if (*div_n_ptr <= event_min) {
+        event_min = *div_n_ptr;
+        next_event = CHAN2;
+    }
+    div_n_ptr++;
+    if (*div_n_ptr <= event_min) {
+        event_min = *div_n_ptr;
+        next_event = CHAN3;
+    }
+    div_n_ptr++;
+    if (*div_n_ptr <= event_min) {
+        event_min = *div_n_ptr;
+        next_event = CHAN4;
+    }
+    div_n_ptr++;
+
+        /* if the next event is a channel change */
+        if (next_event != SAMPLE) {
+            /* shift the polynomial counters */
+
+      /* decrement all counters by the smallest count found */
+      /* again, no loop for efficiency */
+      div_n_ptr--;
+      *div_n_ptr -= event_min;
+      div_n_ptr--;
+      *div_n_ptr -= event_min;
+      div_n_ptr--;
+      *div_n_ptr -= event_min;
+      div_n_ptr--;
+      *div_n_ptr -= event_min;
+
+            WRITE_U32(samp_cnt_w_ptr, READ_U32(samp_cnt_w_ptr) - event_min);
+
+            /* since the polynomials require a mod (%) function which is
+               division, I don't adjust the polynomials on the SAMPLE events,
+               only the CHAN events.  I have to keep track of the change,
+               though. */
+
+            P4 = (P4 + event_min) % POLY4_SIZE;
+            P5 = (P5 + event_min) % POLY5_SIZE;
+            P9 = (P9 + event_min) % POLY9_SIZE;
+            P17 = (P17 + event_min) % POLY17_SIZE;
+
+            /* adjust channel counter */
+            Div_n_cnt[next_event] += Div_n_max[next_event];
+
+            /* get the current AUDC into a register (for optimization) */
+            audc = AUDC[next_event];
+
+            /* set a pointer to the current output (for opt...) */
+            out_ptr = &Outvol[next_event];
+
+            /* assume no changes to the output */
+            toggle = FALSE;
+
+            /* From here, a good understanding of the hardware is required */
+            /* to understand what is happening.  I won't be able to provide */
+            /* much description to explain it here. */
+
+            /* if VOLUME only then nothing to process */
+            if (!(audc & VOL_ONLY)) {
+                /* if the output is pure or the output is poly5 and the poly5 bit */
+                /* is set */
+                if ((audc & NOTPOLY5) || bit5[P5]) {
+                    /* if the PURETONE bit is set */
+                    if (audc & PURETONE) {
+                        /* then simply toggle the output */
+                        toggle = TRUE;
+                    }
+                    /* otherwise if POLY4 is selected */
+                    else if (audc & POLY4) {
+                        /* then compare to the poly4 bit */
+                        toggle = (bit4[P4] == !(*out_ptr));
+                    }
+                    else {
+                        /* if 9-bit poly is selected on this chip */
+                        if (AUDCTL[next_event >> 2] & POLY9) {
+                            /* compare to the poly9 bit */
+                            toggle = ((POKEY_POLY9[P9] & 1) == !(*out_ptr));
+                        }
+                        else {
+                            /* otherwise compare to the poly17 bit */
+                            toggle = (((POKEY_POLY17[P17 >> 3] >> (P17 & 7)) & 1) == !(*out_ptr));
+                        }
+                    }
+                }
+            }
+
+            /* check channel 1 filter (clocked by channel 3) */
+            if ( AUDCTL[next_event >> 2] & CH1_FILTER) {
+                /* if we're processing channel 3 */
+                if ((next_event & 0x03) == CHAN3) {
+                    /* check output of channel 1 on same chip */
+                    if (Outvol[next_event & 0xfd]) {
+                        /* if on, turn it off */
+                        Outvol[next_event & 0xfd] = 0;
+                        cur_val -= AUDV[next_event & 0xfd];
+                    }
+                }
+            }
+
+            /* check channel 2 filter (clocked by channel 4) */
+            if ( AUDCTL[next_event >> 2] & CH2_FILTER) {
+                /* if we're processing channel 4 */
+                if ((next_event & 0x03) == CHAN4) {
+                    /* check output of channel 2 on same chip */
+                    if (Outvol[next_event & 0xfd]) {
+                        /* if on, turn it off */
+                        Outvol[next_event & 0xfd] = 0;
+                        cur_val -= AUDV[next_event & 0xfd];
+                    }
+                }
+            }
+
+            /* if the current output bit has changed */
+            if (toggle) {
+                if (*out_ptr) {
+                    /* remove this channel from the signal */
+                    cur_val -= AUDV[next_event];
+
+                    /* and turn the output off */
+                    *out_ptr = 0;
+                }
+                else {
+                    /* turn the output on */
+                    *out_ptr = 1;
+
+                    /* and add it to the output signal */
+                    cur_val += AUDV[next_event];
+                }
+            }
+        }
+        else {                  /* otherwise we're processing a sample */
+            /* adjust the sample counter - note we're using the 24.8 integer
+               which includes an 8 bit fraction for accuracy */
+      int iout;
+      iout = cur_val;
+      *buffer++ = (char) ((iout))+128;
+      *Samp_n_cnt += Samp_n_max;
+      /* and indicate one less byte in the buffer */
+      n--;
+        }    
+    }
+}
+
+
+static void save_state(SynthState_t *s)
+{
+    s->p4 = P4; s->p5 = P5; s->p9 = P9; s->p17 = P17;
+    memcpy(s->div_n_cnt, Div_n_cnt, sizeof(Div_n_cnt));
+    memcpy(s->div_n_max, Div_n_max, sizeof(Div_n_max));
+    s->samp_n_max = Samp_n_max;
+    memcpy(s->samp_n_cnt, Samp_n_cnt, sizeof(Samp_n_cnt));
+    memcpy(s->outvol, Outvol, sizeof(Outvol));
+    memcpy(s->outbit, Outbit, sizeof(Outbit));
+    memcpy(s->audv, AUDV, sizeof(AUDV));
+}
+
+// The register side of POKEY_PutByte() followed by the sound update
+static void put_register(UBYTE reg, UBYTE val)
+{
+    if (reg < _AUDCTL) {
+        if (reg & 1) AUDC[reg >> 1] = val;
+        else         AUDF[reg >> 1] = val;
+    }
+    else if (reg == _AUDCTL) {
+        AUDCTL[0] = val;
+        Base_mult[0] = (val & CLOCK_15) ? DIV_15 : DIV_64;
+    }
+    Update_pokey_sound(reg, val, 0, SOUND_GAIN);
+}
+
+// ---------------------------------------------------------------------------------
+// One sample per TICK the way POKEY_Scanline() asks for them, or (batch) the whole
+// run of TICKs between two writes in one call the way a buffered mixer would.
+// ---------------------------------------------------------------------------------
+static void play(const Script_t *script, ProcessFn process, int playback_freq, int batch, unsigned char *out, SynthState_t *end)
+{
+    int n = 0;
+
+    memset(AUDF, 0, sizeof(AUDF));
+    memset(AUDC, 0, sizeof(AUDC));
+    memset(AUDCTL, 0, sizeof(AUDCTL));
+    for (int i = 0; i < MAXPOKEYS; i++) Base_mult[i] = DIV_64;
+    Pokey_sound_init(FREQ_17_APPROX, playback_freq, 1, 0);
+
+    for (int i = 0; i < script->len; ) {
+        u32 entry = script->entry[i];
+        if (entry & POKEY_STREAM_TICK) {
+            int ticks = 1;
+            if (batch) while ((ticks < BATCH_MAX) && (i + ticks < script->len) && (script->entry[i + ticks] & POKEY_STREAM_TICK)) ticks++;
+            process(&out[n], ticks);
+            n += ticks;
+            i += ticks;
+        }
+        else {
+            put_register(POKEY_STREAM_REG(entry), POKEY_STREAM_VAL(entry));
+            i++;
+        }
+    }
+    if (end) save_state(end);
+}
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main()
+{
+    static const char *style_name[] = {"music", "low", "quiet"};
+    static const int rates[] = {15720, 31440, 48000, 4000};
+    Script_t scripts[3];
+    int failures = 0, samples = 0;
+
+    make_polys(poly9_lookup, poly17_lookup);
+    for (int style = SCRIPT_MUSIC; style <= SCRIPT_QUIET; style++) {
+        make_script(&scripts[style], FRAMES, style, 0, 0xA8D5 + style);
+        if (scripts[style].keeps > samples) samples = scripts[style].keeps;
+    }
+
+    unsigned char *want = malloc(samples), *got = malloc(samples);
+    for (int style = SCRIPT_MUSIC; style <= SCRIPT_QUIET; style++) {
+        for (int r = 0; r < (int) (sizeof(rates) / sizeof(rates[0])); r++) {
+            for (int batch = 0; batch <= 1; batch++) {
+                SynthState_t want_end, got_end;
+                const Script_t *script = &scripts[style];
+                play(script, Pokey_process_div, rates[r], batch, want, &want_end);
+                play(script, Pokey_process, rates[r], batch, got, &got_end);
+
+                int bad = 0;
+                while ((bad < script->keeps) && (want[bad] == got[bad])) bad++;
+                if (bad < script->keeps) {
+                    printf("FAIL %s @ %dHz%s: sample %d is %02x, want %02x\n", style_name[style], rates[r], batch ? " batched" : "", bad, got[bad], want[bad]);
+                    failures++;
+                }
+                else if (memcmp(&want_end, &got_end, sizeof(want_end))) {
+                    printf("FAIL %s @ %dHz%s: synthesis state differs at the end\n", style_name[style], rates[r], batch ? " batched" : "");
+                    failures++;
+                }
+            }
+        }
+    }
+
+    // The benchmark - per-scanline calls at the ARM9 rate, as in the emulator
+    for (int style = SCRIPT_MUSIC; style <= SCRIPT_QUIET; style++) {
+        double t_div = 1e9, t_new = 1e9;
+        for (int run = 0; run < BENCH_RUNS; run++) {
+            double t0 = now();
+            play(&scripts[style], Pokey_process_div, 15720, 0, want, NULL);
+            double t1 = now();
+            play(&scripts[style], Pokey_process, 15720, 0, got, NULL);
+            double t2 = now();
+            if (t1 - t0 < t_div) t_div = t1 - t0;
+            if (t2 - t1 < t_new) t_new = t2 - t1;
+        }
+        printf("%-6s %7d samples: old %6.2f ns/sample, new %6.2f ns/sample (%+.1f%%)\n", style_name[style], scripts[style].keeps,
+               t_div * 1e9 / scripts[style].keeps, t_new * 1e9 / scripts[style].keeps, (t_new - t_div) * 100.0 / t_div);
+    }
+
+    free(want);
+    free(got);
+    for (int style = SCRIPT_MUSIC; style <= SCRIPT_QUIET; style++) free(scripts[style].entry);
+
+    printf("%s\n", failures ? "FAIL" : "PASS");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,81 @@
+# ---------------------------------------------------------------------------------
+# itcmplace.awk - picks which C functions to move into ITCM from ARM9 PC samples.
+# Run by 'make placement SAMPLES="a.txt b.txt ..."' which passes, in this order:
+#
+#   1. 'nm --defined-only' of our own objects  - only these can be moved
+#   2. 'nm -S' of the .elf the samples came from (addresses and sizes)
+#   3. one or more A8DS_ARM9PC.TXT files from the profiler (one per workload)
+#
+# Each sample is folded into the function containing it, functions are ranked by
+# samples per byte and packed greedily into whatever ITCM the hand placed ITCM_CODE
+# and .s kernels leave free (less RESERVE bytes of headroom). The output is
+# placement.mk which the Makefile picks up on the next build. The samples must come
+# from the same build as the .elf - rebuild without placement.mk to re-profile.
+# ---------------------------------------------------------------------------------
+# Plain awk has no hex input (strtonum is a gawk extension)
+function hex(s,    i, v) {
+    v = 0
+    s = tolower(s)
+    for (i = 1; i <= length(s); i++) v = v * 16 + index("0123456789abcdef", substr(s, i, 1)) - 1
+    return v
+}
+
+BEGIN {
+    if (RESERVE == "") RESERVE = 1024
+    ITCM_BASE = 16777216;  ITCM_SIZE = 32 * 1024            # 0x01000000
+    DTCM_BASE = 184549376; DTCM_SIZE = 16 * 1024            # 0x0B000000
+    MAIN_BASE = 33554432;  MAIN_SIZE = 16 * 1024 * 1024     # 0x02000000 (DSi)
+}
+
+FNR == 1 { file++ }
+
+# 1. Function symbols defined in our objects: 'addr T name'
+file == 1 && NF == 3 && ($2 == "T" || $2 == "t") { ours[$3] = 1; next }
+
+# 2. The .elf: 'addr size type name' - anything without a size is skipped
+file == 2 && NF >= 4 {
+    addr = hex($1); len = hex($2)
+    if (addr >= ITCM_BASE && addr < ITCM_BASE + ITCM_SIZE) itcm_used += len
+    else if (addr >= DTCM_BASE && addr < DTCM_BASE + DTCM_SIZE) dtcm_used += len
+    else if (($3 == "T" || $3 == "t") && (addr >= MAIN_BASE && addr < MAIN_BASE + MAIN_SIZE)) {
+        n = nfuncs++
+        fname[n] = $4; fstart[n] = addr; flen[n] = len
+    }
+    next
+}
+
+# 3. Samples: 'PC COUNT' - anything outside a main RAM function (ITCM, libs without sizes) is ignored
+file >= 3 && $1 !~ /^#/ && NF == 2 {
+    pc = hex($1)
+    total += $2
+    for (i = 0; i < nfuncs; i++) {
+        if (pc >= fstart[i] && pc < fstart[i] + flen[i]) { hits[i] += $2; break }
+    }
+    if (i == nfuncs) missed += $2
+    next
+}
+
+END {
+    budget = ITCM_SIZE - itcm_used - RESERVE
+    printf "# Generated by itcmplace.awk - re-run 'make placement' rather than editing by hand\n"
+    printf "# Samples: %d from %d workload(s), %d outside main RAM functions\n", total, file - 2, missed
+    printf "# ITCM: %d bytes already used, %d byte budget (%d reserve)\n", itcm_used, budget, RESERVE
+    printf "# DTCM: %d of %d bytes used - data placement stays hand tuned (.dtcm)\n", dtcm_used, DTCM_SIZE
+    printf "ITCM_PLACE :=\n"
+
+    # Greedy by hits per byte - selection sort is plenty for a few hundred functions
+    used = 0
+    for (;;) {
+        best = -1
+        for (i = 0; i < nfuncs; i++) {
+            if (!hits[i] || taken[i] || !ours[fname[i]] || flen[i] > budget - used) continue
+            if (best < 0 || hits[i] * flen[best] > hits[best] * flen[i]) best = i
+        }
+        if (best < 0) break
+        taken[best] = 1
+        used += flen[best]
+        placed += hits[best]
+        printf "ITCM_PLACE += %-32s # %6d hits %6d bytes\n", fname[best], hits[best], flen[best]
+    }
+    printf "# Placed %d bytes covering %d of %d samples\n", used, placed, total
+}
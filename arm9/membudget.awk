@@ -0,0 +1,53 @@
+# ---------------------------------------------------------------------------------
+# membudget.awk - turns 'nm -S --size-sort' output for the ARM9 .elf into a memory
+# budget: how much of ITCM, DTCM and main RAM the link uses and the largest symbols
+# in each. Run by the Makefile after linking (writes A8DSi.mem.txt next to the .elf).
+# The heap and the hand placed VRAM carve-outs are only known at run time - see the
+# membudget.c report (X+A on a game to enable the debugger, written to /data).
+# ---------------------------------------------------------------------------------
+# Plain awk has no hex input (strtonum is a gawk extension)
+function hex(s,    i, v) {
+    v = 0
+    s = tolower(s)
+    for (i = 1; i <= length(s); i++) v = v * 16 + index("0123456789abcdef", substr(s, i, 1)) - 1
+    return v
+}
+
+BEGIN {
+    TOP = 15
+    name[0] = "ITCM";  base[0] = 16777216;  size[0] = 32 * 1024          # 0x01000000
+    name[1] = "DTCM";  base[1] = 184549376; size[1] = 16 * 1024          # 0x0B000000
+    name[2] = "MAIN";  base[2] = 33554432;  size[2] = 4 * 1024 * 1024    # 0x02000000
+}
+
+# addr size type symbol - anything without a size (labels, linker symbols) is skipped
+NF >= 4 {
+    addr = hex($1)
+    len  = hex($2)
+    for (r = 0; r < 3; r++) {
+        if (addr >= base[r] && addr < base[r] + size[r]) {
+            used[r] += len
+            n = count[r]++
+            sym[r, n] = $4
+            symlen[r, n] = len
+            symtype[r, n] = $3
+            break
+        }
+    }
+}
+
+END {
+    printf "A8DS ARM9 MEMORY BUDGET (from the link)\n\n"
+    printf "REGION      SIZE      USED      FREE\n"
+    for (r = 0; r < 3; r++)
+        printf "%-6s  %8d  %8d  %8d\n", name[r], size[r], used[r], size[r] - used[r]
+    printf "\nMAIN is the 4MB DS - the DSi has 16MB. The heap gets whatever MAIN has left.\n"
+    printf "DTCM free space is shared with the IRQ/SVC/USR stacks at the top of DTCM.\n"
+
+    # nm --size-sort lists smallest first so the largest are at the end
+    for (r = 0; r < 3; r++) {
+        printf "\nLARGEST %s SYMBOLS\n", name[r]
+        for (i = count[r] - 1; i >= 0 && i >= count[r] - TOP; i--)
+            printf "  %8d  %s  %s\n", symlen[r, i], symtype[r, i], sym[r, i]
+    }
+}
@@ -26,6 +26,7 @@
 #include <fat.h>
 #include <dirent.h>
 #include <unistd.h>
+#include <sys/stat.h>
 
 #include "main.h"
 #include "a8ds.h"
@@ -34,9 +35,11 @@
 #include "atari.h"
 #include "antic.h"
 #include "cartridge.h"
+#include "binload.h"
 #include "input.h"
 #include "esc.h"
 #include "memory.h"
+#include "pokey.h"
 #include "rtime.h"
 #include "emu/pia.h"
 
@@ -58,14 +61,20 @@
 #include "config.h"
 #include "highscore.h"
 #include "loadsave.h"
+#include "profiler.h"
+#include "cputest.h"
+#include "benchdev.h"
+#include "membudget.h"
 
 FICA_A8 *a8romlist;                         // For reading all the .ATR .XEX .CAR and .ROM files from the SD card
 u16 count8bit=0, countfiles=0, ucFicAct=0;  // Counters for all the 8-bit files found on the SD card
+u8 count_capped = 0;                        // The folder has more entries than those counters can hold - only the first DIR_MAX_ENTRIES are listed
 u16 gTotalAtariFrames = 0;                  // For FPS counting
 int bg0, bg1, bg2, bg3, bg0b, bg1b;         // Background screen "pointers"
 u16 emu_state;                              // Emulator State
 u16 atari_frames = 0;                       // Number of frames per second (60 for NTSC and 50 for PAL)
 u8  bShowKeyboard = false;                  // set to true when the virtual keyboard is showing
+u8  bFastForward = false;                   // set to true while the Fast Forward key is held (no frame pacing, reduced drawing)
 u8 bFirstLoad = true;                       // True if this is the first game being loaded
 u16 shift=0;                                // Used to track shift keyboard status
 u16 ctrl=0;                                 // Used to track control keyboard status
@@ -110,6 +119,7 @@ u8 manual_ctrl_now = 0;
 #define MAX_DEBUG 16
 int debug[MAX_DEBUG]={0};                   // Turn on DEBUG_DUMP to output some data to the lower screen... useful for emulator debug: just drop values into debug[] array.
 u8 DEBUG_DUMP = 0;                          // Pressing X and then A to select a game will enable the debugger output... it's not much but it's useful!
+u8 membudget_pending = 0;                   // Write the memory budget report once the game selected with the debugger on is up and running
 
 extern u8 *fake_heap_end;     // current heap start
 extern u8 *fake_heap_start;   // current heap end
@@ -175,11 +185,12 @@ static void DumpDebugData(void)
             dsPrintValue(0,3+i,0, dbgbuf);
         }
 
-        struct mallinfo mi = mallinfo();
-        siprintf(dbgbuf, "DYNAMIC MEM USED: %d ", mi.uordblks);
-        dsPrintValue(0,22,0, dbgbuf);
-        siprintf(dbgbuf, "FREE HEAP MEMORY: %d ", getMemFree());
-        dsPrintValue(0,23,0, dbgbuf);
+        MEMBUDGET_Show(19);
+        if (membudget_pending)
+        {
+            membudget_pending = 0;
+            MEMBUDGET_Report();
+        }
     }
 }
 
@@ -236,6 +247,7 @@ ITCM_CODE void VsoundHandler(void)
         *aptr = sample;
         *bptr = sample;
     }
+    else bench_audio_underruns++;   // Nothing new from the Pokey - the last sample plays again
 }
 
 // ---------------------------------------------------------------------------
@@ -778,7 +790,7 @@ void dsShowRomInfo(void)
         dsPrintValue(10,13,0, line2);
     }
 
-    siprintf(ramSizeBuf, "%4dK", RAM_SIZES[myConfig.machine_type]);
+    siprintf(ramSizeBuf, "%4dK", RAM_SIZES[mem_machine_type]);
     if      (myConfig.machine_type == MACHINE_5200)      siprintf(machineBuf, "%-5s A5200", " ");
     else if (myConfig.machine_type == MACHINE_800_48K)   siprintf(machineBuf, "%-5s A800", (myConfig.basic_enabled ? "BASIC": " "));
     else                                                 siprintf(machineBuf, "%-5s XL/XE", (myConfig.basic_enabled ? "BASIC": " "));
@@ -814,10 +826,17 @@ void dsLoadGame(char *filename, int disk_num, bool bRestart, bool bReadOnly)
 
     if (bRestart) // Only save last filename and hash if we are restarting...
     {
+        ResumeDiscard();    // A new boot makes any suspended state stale
+
         if (strcmp(filename, last_boot_file) != 0)
         {
              strcpy(last_boot_file, filename);
         }
+
+        // The name may live in the browser's directory cache - let that go before
+        // the machine is set up so the new game gets the memory back
+        filename = last_boot_file;
+        a8FreeDirCache();
         
         // Get the hash of the file
         if (isDisk(filename))
@@ -843,6 +862,7 @@ void dsLoadGame(char *filename, int disk_num, bool bRestart, bool bReadOnly)
 
           bAtariCrash = false;
           dsPrintValue(1,23,0, "                              ");
+          if (xe_mem_reduced) dsPrintValue(1,23,0, "NO MEMORY - RAM SIZE REDUCED  ");
 
           dsSetAtariPalette();
 
@@ -850,10 +870,7 @@ void dsLoadGame(char *filename, int disk_num, bool bRestart, bool bReadOnly)
           {
               // In case we switched PAL/NTSC
               dsInstallSoundEmuFIFO();
-
-              TIMER2_DATA = TIMER_FREQ(SOUND_FREQ+10);   // Very slightly faster to ensure we always swallow all samples produced by the Pokey
-              TIMER2_CR = TIMER_DIV_1 | TIMER_IRQ_REQ | TIMER_ENABLE;
-              irqSet(IRQ_TIMER2, VsoundHandler);
+              dsInstallSoundEngine();
 
               atari_frames = 0;
               TIMER0_CR=0;
@@ -861,6 +878,7 @@ void dsLoadGame(char *filename, int disk_num, bool bRestart, bool bReadOnly)
               TIMER0_CR=TIMER_ENABLE|TIMER_DIV_1024;
           }
       }
+      else dsPrintValue(1,23,0, "UNABLE TO LOAD FILE           ");
     }
       
     dsShowRomInfo();
@@ -1000,7 +1018,7 @@ void dsDisplayFiles(unsigned int NoDebGame,u32 ucSel)
 
   dsPrintValue(31,5,0,(char *) (NoDebGame>0 ? "<" : " "));
   dsPrintValue(31,22,0,(char *) (NoDebGame+14<count8bit ? ">" : " "));
-  siprintf(szName,"%s"," A=PICK B=BACK SEL=TV STA=BASIC ");
+  siprintf(szName,"%s",(count_capped ? "  FOLDER TOO BIG - FIRST 65535  " : " A=PICK B=BACK SEL=TV STA=BASIC "));
   dsPrintValue(0,23,0,szName);
   for (ucBcl=0;ucBcl<17; ucBcl++)
   {
@@ -1208,6 +1226,7 @@ unsigned int dsWaitForRom(void)
         bRet=true;
         bDone=true;
         DEBUG_DUMP = (keysCurrent() & KEY_X) ? 1:0;
+        membudget_pending = DEBUG_DUMP;
       }
       else
       {
@@ -1851,6 +1870,35 @@ void dsInstallSoundEmuFIFO(void)
     }
 }
 
+// -----------------------------------------------------------------------
+// Pick who runs the Pokey synthesis for this game. Normally the ARM9 does
+// it every scanline and VsoundHandler() feeds the samples to the ARM7.
+// With ARM7 SOUND on, the ARM9 only streams the register writes and the
+// ARM7 does the synthesis on its own timer (see pokey_stream.h) so we
+// don't need our timer 2 interrupt at all.
+// -----------------------------------------------------------------------
+void dsInstallSoundEngine(void)
+{
+    FifoMessage msg;
+
+    TIMER2_CR = 0;
+    msg.type = EMUARM7_POKEY_STREAM;
+    msg.SoundPlay.freq = SOUND_FREQ;
+    msg.SoundPlay.data = POKEY_StreamEnable(myConfig.sound_arm7);   // NULL tells the ARM7 to stop
+    fifoSendDatamsg(FIFO_USER_01, sizeof(msg), (u8*)&msg);
+
+    if (myConfig.sound_arm7)
+    {
+        swiWaitForVBlank();    // Let the ARM7 pick up the stream before we start filling it
+    }
+    else
+    {
+        TIMER2_DATA = TIMER_FREQ(SOUND_FREQ+10);   // Very slightly faster to ensure we always swallow all samples produced by the Pokey
+        TIMER2_CR = TIMER_DIV_1 | TIMER_IRQ_REQ | TIMER_ENABLE;
+        irqSet(IRQ_TIMER2, VsoundHandler);
+    }
+}
+
 // Called roughly every 1/60th of a second...
 void dsHandleDiskSounds(void)
 {
@@ -1879,6 +1927,22 @@ void dsHandleDiskSounds(void)
     }
 }
 
+// ---------------------------------------------------------------------------------
+// Run-Ahead needs the DSi horsepower and is suspended while Fast Forward is held,
+// while the disk/XEX loader is busy since file access can't be rolled back, or
+// while the profiler is running.
+// ---------------------------------------------------------------------------------
+u8 dsRunAheadAllowed(void)
+{
+    if (!isDSiMode()) return false;
+    if (bFastForward) return false;
+    if (profiler_enabled) return false;     // The profiler's counts aren't rolled back so hidden frames would be counted too
+    if (mem_machine_type > MACHINE_XLXE_128K) return false;
+    if (myConfig.cart_type == CART_CORINA_SRAM) return false;  // 512K of cart SRAM is more than we can snapshot
+    if (play_sio_sound || BINLOAD_ACTIVE()) return false;
+    return true;
+}
+
 void UserResetSystem(void)
 {
     dsLoadGame(last_boot_file, (isDisk(last_boot_file)) ? DISK_1 : DISK_XEX, true, last_read_only[0]);   // Reload the last bootable game
@@ -1889,11 +1953,41 @@ void UserResetSystem(void)
     atari_frames=0;
 }
 
+// -------------------------------------------------------------------------------
+// Tell ANTIC which part of the 384x240 Atari framebuffer is actually on the DS
+// screen so it can skip drawing the rest. This mirrors the affine setup in
+// vblankIntr() - the BG2PA/PD step times 256x192 screen pixels gives the size.
+// -------------------------------------------------------------------------------
+void dsUpdateViewport(void)
+{
+    if (bScreenZoom)
+    {
+        ANTIC_SetViewport(myConfig.xOffset + bZoomX, myConfig.yOffset + bZoomY, 256, 192);
+    }
+    else
+    {
+        ANTIC_SetViewport(myConfig.xOffset + screen_slide_x, myConfig.yOffset + screen_slide_y, xdxBG, (192 * ydyBG) >> 8);
+    }
+}
+
 void dsZoomScreen(void)
 {
     u32 savedTimer0 = TIMER0_DATA;
     bMute = 1;
     bScreenZoom = 1;    // vblankIntr() will zoom screen now
+
+    // The last frame was culled to the normal view - draw one full frame so we have the whole picture to pan around.
+    // That frame is run the way Run-Ahead runs its hidden ones (silent, always drawn) and rolled back afterwards so
+    // that zooming in only re-renders the screen and doesn't move the game on by a frame.
+    ANTIC_SetViewport(0, 0, ATARI_WIDTH, ATARI_HEIGHT);
+    if (SaveStateToRAM())
+    {
+        UBYTE saved_decimate = pokey_decimate;
+        pokey_decimate = 0;
+        Atari800_Frame();
+        pokey_decimate = saved_decimate;
+        LoadStateFromRAM();
+    }
     while (keysCurrent() & (KEY_LEFT | KEY_RIGHT | KEY_DOWN | KEY_UP | KEY_A | KEY_B | KEY_Y | KEY_X | KEY_L | KEY_R | KEY_START | KEY_SELECT)) {WAITVBL;}   // Wait for release
     dsPrintValue(0,0,0, "ZOOM MODE");
     while (true)
@@ -1957,16 +2051,24 @@ void dsMainLoop(void)
         emu_state = A8_MENUSHOW;
         break;
 
+      case A8_RESUME:
+        emu_state = (ResumeGame() ? A8_PLAYINIT : A8_MENUINIT);
+        break;
+
       case A8_MENUSHOW:
+        fifoSendValue32(FIFO_PM, PM_REQ_SLEEP_ENABLE);     // Lid closes sleep as normal in the menus
         Atari800_Initialise();
         emu_state = dsWaitOnMenu(A8_MENUSHOW);
         dsLoadGame(last_disk_filename[1], DISK_2, false, last_read_only[1]);  // Mount D2 if available
         break;
 
       case A8_PLAYINIT:
+        fifoSendValue32(FIFO_PM, PM_REQ_SLEEP_DISABLE);    // We handle the lid ourselves while playing - see below
         dsShowScreenEmu();
         irqEnable(IRQ_TIMER2);
         bMute = 0;
+        bFastForward = false;
+        pokey_decimate = 1;
         emu_state = A8_PLAYGAME;
 
         if (myConfig.keyboard_type == 5) // Star Raiders
@@ -1980,10 +2082,12 @@ void dsMainLoop(void)
         // 32,728.5 ticks = 1 second
         // 1 frame = 1/50 or 1/60 (0.02 or 0.016)
         // 655 -> 50 fps and 546 -> 60 fps
-        if (myConfig.fps_setting < 2)
+        if ((myConfig.fps_setting < 2) && !bFastForward)
         {
             while(TIMER0_DATA < ((myConfig.tv_type == TV_NTSC ? 546:656)*atari_frames))
-                ;
+            {
+                if (cart_paging) CART_Prefetch();   // Waiting anyway - bring in cart banks still out on the SD card
+            }
         }
 
         // ------------------------------------------------------------------------
@@ -1993,7 +2097,18 @@ void dsMainLoop(void)
         // frame. All of the NTSC and PAL scanlines are done here - and this is
         // where the Nitnendo DS is spending most of its CPU time.
         // ------------------------------------------------------------------------
-        Atari800_Frame();
+        dsUpdateViewport();
+        if (myConfig.run_ahead && dsRunAheadAllowed())
+        {
+            Atari800_FrameRunAhead(myConfig.run_ahead);
+        }
+        else
+        {
+            Atari800_Frame();
+        }
+
+        // Trickle in any cart banks still out on the SD card while we have time before the next frame
+        if (cart_paging) CART_Prefetch();
 
         // ----------------------------------------------------
         // If we have processed 60/50 frames we start anew...
@@ -2025,6 +2140,15 @@ void dsMainLoop(void)
                 dsPrintValue(0,0,0, fpsbuf); // Show FPS
                 if (myConfig.fps_setting==2) dsPrintValue(30,0,0,"FS");
             }
+            if (bFastForward)
+            {
+                // Show the speed multiple (in tenths) and keep only as many sound samples as we can play back in real time
+                u16 speed_x10 = (gTotalAtariFrames * 10) / (myConfig.tv_type == TV_NTSC ? 60:50);
+                char ffbuf[10];
+                siprintf(ffbuf, "FF X%d.%d", speed_x10 / 10, speed_x10 % 10);
+                dsPrintValue(22,0,0, ffbuf);
+                pokey_decimate = (speed_x10 < 15) ? 1 : ((speed_x10 + 5) / 10);
+            }
             gTotalAtariFrames = 0;
             DumpDebugData();
             if(bAtariCrash) dsPrintValue(1,23,0, "GAME CRASH - PICK ANOTHER GAME");
@@ -2046,6 +2170,22 @@ void dsMainLoop(void)
 
         if (keyboard_debounce > 0) keyboard_debounce--;
 
+        // Closing the lid suspends the game to the SD card before we sleep - the battery may run out while asleep
+        if (keys_pressed & KEY_LID)
+        {
+            u16 savedTimer0 = TIMER0_DATA;
+            bMute = 1;
+            SuspendGame();
+            systemSleep();
+            while (keysCurrent() & KEY_LID) swiWaitForVBlank();
+            ResumeDiscard();    // Awake and playing on - the state we just wrote is already old
+            dsPrintValue(0,0,0, "       ");
+            TIMER0_CR=0;
+            TIMER0_DATA=savedTimer0;
+            TIMER0_CR=TIMER_ENABLE|TIMER_DIV_1024;
+            bMute = 0;
+        }
+
         // For the 5200 emulation, the NDS B Key becomes the second fire button automatically...
         if (myConfig.machine_type == MACHINE_5200)
         {
@@ -2188,7 +2328,7 @@ void dsMainLoop(void)
                       bMute = 1;
                       swiWaitForVBlank();
                       soundPlaySample(clickNoQuit_wav, SoundFormat_16Bit, clickNoQuit_wav_size, 22050, 127, 64, false, 0);
-                      if (dsQuery("QUIT A8DS?", "")) emu_state=A8_QUITSTDS;
+                      if (dsQuery("QUIT A8DS?", "")) {SuspendGame(); emu_state=A8_QUITSTDS;}
                       else
                       {
                            TIMER0_CR=0;
@@ -2319,6 +2459,9 @@ void dsMainLoop(void)
         u8 start_pressed = 0;
         u8 select_pressed = 0;
         u8 option_pressed = 0;
+        u8 fast_forward_now = 0;
+        u8 profiler_now = 0;
+        u8 cputest_now = 0;
         for (int i=0; i<8; i++)
         {
             if (keys_pressed & nds_keys[i]) // Is this key pressed?
@@ -2388,9 +2531,9 @@ void dsMainLoop(void)
                     case 58: manual_shift_now = 1;          break;
                     case 59: manual_ctrl_now = 1;           break;
                     
-                    case 60: key_code = AKEY_NONE;          break;      // Spare 1
-                    case 61: key_code = AKEY_NONE;          break;      // Spare 2
-                    case 62: key_code = AKEY_NONE;          break;      // Spare 3
+                    case 60: fast_forward_now = 1;          break;
+                    case 61: profiler_now = 1;              break;
+                    case 62: cputest_now = 1;               break;
 
                     case 63: screen_slide_y = 12;  dampen_slide_y = 6;     break;
                     case 64: screen_slide_y = 24;  dampen_slide_y = 6;     break;
@@ -2425,6 +2568,68 @@ void dsMainLoop(void)
             }
         }
         
+        // -------------------------------------------------------------------------------
+        // Fast Forward runs the emulation unthrottled for as long as the key is held...
+        // -------------------------------------------------------------------------------
+        if (fast_forward_now != bFastForward)
+        {
+            bFastForward = fast_forward_now;
+            if (bFastForward)
+            {
+                pokey_decimate = 4; // A reasonable guess until we've measured the first second
+                dsPrintValue(22,0,0, "FF     ");
+            }
+            else
+            {
+                // Back to normal pacing - restart the frame timer so we don't stall waiting to catch up
+                pokey_decimate = 1;
+                dsPrintValue(22,0,0, "       ");
+                TIMER0_CR=0;
+                TIMER0_DATA=0;
+                TIMER0_CR=TIMER_ENABLE|TIMER_DIV_1024;
+                atari_frames=0;
+            }
+        }
+
+        // -------------------------------------------------------------------------------
+        // The Profiler key toggles 6502 sampling - the second press writes the report.
+        // -------------------------------------------------------------------------------
+        static u8 last_profiler_key = 0;
+        if (profiler_now && !last_profiler_key)
+        {
+            if (!profiler_enabled)
+            {
+                PROFILER_Start();
+                dsPrintValue(3,0,0, (char*)"PROF");
+            }
+            else
+            {
+                dsPrintValue(3,0,0, (char*)(PROFILER_Report() ? "ERR " : "SAVE"));
+                WAITVBL;WAITVBL;
+                dsPrintValue(3,0,0, (char*)"    ");
+            }
+        }
+        last_profiler_key = profiler_now;
+
+        // -------------------------------------------------------------------------------
+        // The CPU Test key runs the 6502 self test (see cputest.c) and puts the game back.
+        // -------------------------------------------------------------------------------
+        static u8 last_cputest_key = 0;
+        if (cputest_now && !last_cputest_key)
+        {
+            u16 savedTimer0 = TIMER0_DATA;
+            bMute = 1;
+            dsPrintValue(3,0,0, (char*)"TEST");
+            dsPrintValue(3,0,0, (char*)(CPUTEST_Run() ? "FAIL" : "PASS"));
+            WAITVBL;WAITVBL;
+            dsPrintValue(3,0,0, (char*)"    ");
+            TIMER0_CR=0;
+            TIMER0_DATA=savedTimer0;
+            TIMER0_CR=TIMER_ENABLE|TIMER_DIV_1024;
+            bMute = 0;
+        }
+        last_cputest_key = cputest_now;
+
         manual_shift = manual_shift_now; 
         manual_shift_now = 0;
     
@@ -2564,93 +2769,217 @@ int a8Filescmp (const void *c1, const void *c2) {
 
 
 //----------------------------------------------------------------------------------
-// Find files game available. We sort them directories first and then alphabetical.
+// The directory index. The names are stored back to back in a string pool, each one
+// preceded by a flag byte marking directories, and the list the browser walks is a
+// pointer per entry into that pool - so there is no per-directory file limit and a
+// big folder costs its names plus 8 bytes each. The last few sorted listings are
+// kept and reused while the path, the load filter and the directory time stamp all
+// match (the SD card can't change under us while we run, other than by us). It all
+// goes once a game is launched or when some other allocation comes up short.
 //----------------------------------------------------------------------------------
-void a8FindFiles(void)
+typedef struct
 {
-  static bool bFirstTime = true;
-  DIR *pdir;
-  struct dirent *pent;
-  static char filenametmp[300];
+  char     path[MAX_FILENAME+1];
+  time_t   mtime;
+  u8       no_xex;              // Built for D2 which only takes disk images
+  u32      age;                 // For picking the least recently used slot
+  u16      count, files;
+  u8       capped;              // Stopped at DIR_MAX_ENTRIES with more still to come
+  char    *pool;
+  FICA_A8 *list;
+} DirIndex_t;
+
+#define DIR_MAX_ENTRIES 0xFFFF  // The browser counts entries in u16 - see count8bit
+
+static DirIndex_t dir_cache[DIR_CACHE_SLOTS];
+static u32 dir_cache_age = 0;
+
+#define EXT3(a,b,c)     (((a) << 16) | ((b) << 8) | (c))
+#define KIND_NONE       0
+#define KIND_DISK       1       // Disk images can go into either drive
+#define KIND_PROGRAM    2       // Executables and carts only load from D1
+
+// Classify a file by its extension in one go rather than one strcasecmp() per type
+static u8 a8FileKind(const char *name)
+{
+  const char *dot = strrchr(name, '.');
+  if ((dot == NULL) || (strlen(dot) != 4)) return KIND_NONE;
+  switch (EXT3(dot[1] | 0x20, dot[2] | 0x20, dot[3] | 0x20))
+  {
+    case EXT3('a','t','r'):
+    case EXT3('a','t','x'):
+      return KIND_DISK;
+    case EXT3('x','e','x'):
+    case EXT3('c','a','r'):
+    case EXT3('r','o','m'):
+    case EXT3('a','5','2'):
+      return KIND_PROGRAM;
+  }
+  return KIND_NONE;
+}
 
-  if (a8romlist == NULL) a8romlist = malloc(MAX_FILES * sizeof(FICA_A8));
+// Append a flag byte and the name to the pool, growing it as needed. Returns 0 if out of memory.
+static u8 a8PoolAdd(DirIndex_t *idx, u32 *used, u32 *size, const char *name, u8 directory)
+{
+  u32 len = strlen(name) + 2;
+  if ((*used + len) > *size)
+  {
+    u32 new_size = (*size ? (*size * 2) : 16384);
+    while ((*used + len) > new_size) new_size *= 2;
+    char *pool = realloc(idx->pool, new_size);
+    if (pool == NULL) return 0;
+    idx->pool = pool;
+    *size = new_size;
+  }
+  idx->pool[*used] = directory;
+  strcpy(&idx->pool[*used + 1], name);
+  *used += len;
+  return 1;
+}
 
-  count8bit = countfiles= 0;
+static void a8IndexFree(DirIndex_t *idx)
+{
+  free(idx->pool);
+  free(idx->list);
+  memset(idx, 0x00, sizeof(DirIndex_t));
+}
 
-  // First time load... get into the root directory for easy navigation...
-  if (bFirstTime)
+// Drop every cached listing. Returns 1 if that gave any memory back.
+u8 a8FreeDirCache(void)
+{
+  u8 freed = 0;
+  for (int i=0; i<DIR_CACHE_SLOTS; i++)
   {
-    bFirstTime = false;
+    if (dir_cache[i].pool || dir_cache[i].list) freed = 1;
+    a8IndexFree(&dir_cache[i]);
   }
+  return freed;
+}
+
+// Read the current directory into the index slot and sort it. Returns 0 if out of memory.
+static u8 a8IndexBuild(DirIndex_t *idx)
+{
+  DIR *pdir;
+  struct dirent *pent;
+  u32 used = 0, size = 0;
+  u8 ok = 1;
+
+  idx->count = idx->files = 0;
+  idx->capped = 0;
   pdir = opendir(".");
 
   if (pdir) {
 
-    while (((pent=readdir(pdir))!=NULL))
+    while ((pent=readdir(pdir))!=NULL)
     {
-      if (count8bit > (MAX_FILES-1)) break;
-      strcpy(filenametmp,pent->d_name);
-      if (pent->d_type == DT_DIR)
+      u8 directory = (pent->d_type == DT_DIR);
+      if (directory)
       {
         // Filter out the emulator directories from the list
-        if (strcasecmp(filenametmp, "SAV") == 0) continue;
-        if (strcasecmp(filenametmp, "sav") == 0) continue;
-          
-        if (!( (filenametmp[0] == '.') && (strlen(filenametmp) == 1))) {
-          a8romlist[count8bit].directory = true;
-          strcpy(a8romlist[count8bit].filename,filenametmp);
-          count8bit++;
-        }
+        if (strcasecmp(pent->d_name, "SAV") == 0) continue;
+        if ((pent->d_name[0] == '.') && (pent->d_name[1] == 0)) continue;
       }
       else
       {
-          if (strcmp(file_load_id,"D2")!=0)      // For D2: we don't load .xex
-          {
-              if ( (strcasecmp(strrchr(filenametmp, '.'), ".xex") == 0) )  {
-                a8romlist[count8bit].directory = false;
-                strcpy(a8romlist[count8bit].filename,filenametmp);
-                count8bit++;countfiles++;
-              }
-              if ( (strcasecmp(strrchr(filenametmp, '.'), ".car") == 0) )  {
-                a8romlist[count8bit].directory = false;
-                strcpy(a8romlist[count8bit].filename,filenametmp);
-                count8bit++;countfiles++;
-              }
-              if ( (strcasecmp(strrchr(filenametmp, '.'), ".rom") == 0) )  {
-                a8romlist[count8bit].directory = false;
-                strcpy(a8romlist[count8bit].filename,filenametmp);
-                count8bit++;countfiles++;
-              }
-              if ( (strcasecmp(strrchr(filenametmp, '.'), ".a52") == 0) )  {
-                a8romlist[count8bit].directory = false;
-                strcpy(a8romlist[count8bit].filename,filenametmp);
-                count8bit++;countfiles++;
-              }
-          }
-          if ( (strcasecmp(strrchr(filenametmp, '.'), ".atr") == 0) )  {
-            a8romlist[count8bit].directory = false;
-            strcpy(a8romlist[count8bit].filename,filenametmp);
-            count8bit++;countfiles++;
-          }
-          if ( (strcasecmp(strrchr(filenametmp, '.'), ".atx") == 0) )  {
-            a8romlist[count8bit].directory = false;
-            strcpy(a8romlist[count8bit].filename,filenametmp);
-            count8bit++;countfiles++;
-          }
+        u8 kind = a8FileKind(pent->d_name);
+        if (kind == KIND_NONE) continue;
+        if ((kind == KIND_PROGRAM) && idx->no_xex) continue;     // For D2: we don't load .xex
+      }
+      if (idx->count == DIR_MAX_ENTRIES)
+      {
+        idx->capped = 1;    // dsDisplayFiles() says so rather than the rest quietly going missing
+        break;
       }
+      if (!(ok = a8PoolAdd(idx, &used, &size, pent->d_name, directory))) break;
+      idx->count++;
+      if (!directory) idx->files++;
     }
     closedir(pdir);
   }
-  if (count8bit)
+  if (!ok) return 0;
+
+  if (idx->count == 0)  // Failsafe... always provide a back directory...
+  {
+    if (!a8PoolAdd(idx, &used, &size, "..", true)) return 0;
+    idx->count = 1;
+  }
+
+  // The pool is final now - hand back the unused growth and point the list at the names
+  char *pool = realloc(idx->pool, used);
+  if (pool != NULL) idx->pool = pool;
+  idx->list = malloc(idx->count * sizeof(FICA_A8));
+  if (idx->list == NULL) return 0;
+  char *name = idx->pool;
+  for (u32 i=0; i<idx->count; i++)
+  {
+    idx->list[i].directory = name[0];
+    idx->list[i].filename = name + 1;
+    name += strlen(name + 1) + 2;
+  }
+  qsort (idx->list, idx->count, sizeof (FICA_A8), a8Filescmp);
+  return 1;
+}
+
+//----------------------------------------------------------------------------------
+// Find files game available. We sort them directories first and then alphabetical.
+//----------------------------------------------------------------------------------
+void a8FindFiles(void)
+{
+  static char path[MAX_FILENAME+1];
+  struct stat st;
+  DirIndex_t *idx = NULL;
+  u8 no_xex = (strcmp(file_load_id,"D2") == 0);
+
+  if (getcwd(path, MAX_FILENAME) == NULL) path[0] = 0;
+  time_t mtime = (stat(".", &st) == 0) ? st.st_mtime : 0;
+
+  for (int i=0; i<DIR_CACHE_SLOTS; i++)
   {
-    qsort (a8romlist, count8bit, sizeof (FICA_A8), a8Filescmp);
+    DirIndex_t *slot = &dir_cache[i];
+    if (slot->list && (slot->mtime == mtime) && (slot->no_xex == no_xex) && (strcmp(slot->path, path) == 0))
+    {
+      idx = slot;
+      break;
+    }
   }
-  else  // Failsafe... always provide a back directory...
+
+  if (idx == NULL)
   {
-    a8romlist[count8bit].directory = true;
-    strcpy(a8romlist[count8bit].filename,"..");
-    count8bit = 1;
+    // Reuse an empty slot or the one used longest ago
+    idx = &dir_cache[0];
+    for (int i=1; i<DIR_CACHE_SLOTS; i++)
+    {
+      if ((idx->list != NULL) && ((dir_cache[i].list == NULL) || (dir_cache[i].age < idx->age))) idx = &dir_cache[i];
+    }
+    a8IndexFree(idx);
+    strcpy(idx->path, path);
+    idx->mtime = mtime;
+    idx->no_xex = no_xex;
+
+    if (!a8IndexBuild(idx))
+    {
+      // Out of memory - drop the other listings and try once more
+      a8FreeDirCache();
+      strcpy(idx->path, path);
+      idx->mtime = mtime;
+      idx->no_xex = no_xex;
+      if (!a8IndexBuild(idx))
+      {
+        static FICA_A8 back = {"..", true};
+        a8IndexFree(idx);
+        dsPrintValue(0,0,0, "NO MEMORY FOR DIRECTORY");
+        a8romlist = &back;
+        count8bit = 1; countfiles = 0; count_capped = 0;
+        return;
+      }
+    }
   }
+
+  idx->age = ++dir_cache_age;
+  a8romlist = idx->list;
+  count8bit = idx->count;
+  countfiles = idx->files;
+  count_capped = idx->capped;
 }
 
 void _putchar(char character) {};   // Not used but needed to link printf()
@@ -27,11 +27,12 @@
 #define A8_PLAYINIT 0x03 
 #define A8_PLAYGAME 0x04 
 #define A8_QUITSTDS 0x05
+#define A8_RESUME   0x06
 
 #define WAITVBL swiWaitForVBlank(); swiWaitForVBlank(); swiWaitForVBlank(); swiWaitForVBlank(); swiWaitForVBlank();
 
-#define MAX_FILES       1024    // No more than this many files can be processed per directory
 #define MAX_FILENAME    249     // Filenames with full path no longer than this
+#define DIR_CACHE_SLOTS 4       // How many sorted directory listings we keep around
 
 extern unsigned short emu_state; 
 
@@ -39,10 +40,11 @@ typedef enum {
   EMUARM7_INIT_SND = 0x123C,
   EMUARM7_STOP_SND = 0x123D,
   EMUARM7_PLAY_SND = 0x123E,
+  EMUARM7_POKEY_STREAM = 0x123F,
 } FifoMesType;
 
 typedef struct FICtoLoad {
-  char filename[MAX_FILENAME];
+  char *filename;               // Points into the string pool of the directory index
   u8   directory;
 } FICA_A8;
 
@@ -51,6 +53,9 @@ extern int bg2, bg3;
 extern unsigned int video_height;                  // Actual video height
 extern u8 bFirstLoad;
 extern char last_boot_file[];
+extern char last_disk_filename[2][300];
+extern char last_working_dir[2][300];
+extern bool last_read_only[2];
 
 extern u16 gTotalAtariFrames;
 extern u16 emu_state;
@@ -70,6 +75,7 @@ extern void dsShowScreenMain(void);
 extern void dsFreeEmu(void);
 extern void VsoundHandler(void);
 extern void dsLoadGame(char *filename, int disk_num, bool bRestart, bool bReadOnly);
+extern bool isDisk(char *filename);
 extern unsigned int dsReadPad(void);
 extern bool dsWaitOnQuit(void);
 extern void dsDisplayFiles(unsigned int NoDebGame,u32 ucSel);
@@ -77,9 +83,12 @@ extern unsigned int dsWaitForRom(void);
 extern unsigned int dsWaitOnMenu(unsigned int actState);
 extern void dsPrintValue(int x, int y, unsigned int isSelect, char *pchStr);
 extern void dsInstallSoundEmuFIFO(void);
+extern void dsInstallSoundEngine(void);
 extern void dsMainLoop(void);
+extern void dsUpdateViewport(void);
 extern int a8Filescmp (const void *c1, const void *c2);
 extern void a8FindFiles(void);
+extern u8   a8FreeDirCache(void);
 extern void dsShowRomInfo(void);
 extern void InitGameSettings(void);
 extern void WriteGameSettings(void);
@@ -0,0 +1,254 @@
+/*
+ * benchdev.c contains the optional memory-mapped benchmark counter device
+ *
+ * A8DS - Atari 8-bit Emulator designed to run on the Nintendo DS/DSi is
+ * Copyright (c) 2021-2025 Dave Bernazzani (wavemotion-dave)
+
+ * Copying and distribution of this emulator, its source code and associated
+ * readme files, with or without modification, are permitted in any medium without
+ * royalty provided this full copyright notice (including the Atari800 one below)
+ * is used and wavemotion-dave, alekmaul (original port), Atari800 team (for the
+ * original source) and Avery Lee (Altirra OS) are credited and thanked profusely.
+ *
+ * The A8DS emulator is offered as-is, without any warranty.
+ *
+ * Since much of the original codebase came from the Atari800 project, and since
+ * that project is released under the GPL V2, this program and source must also
+ * be distributed using that same licensing model. See COPYING for the full license.
+ */
+#include <nds.h>
+#include <stdio.h>
+#include <string.h>
+#include "atari.h"
+#include "antic.h"
+#include "memory.h"
+#include "pokey.h"
+#include "config.h"
+#include "benchdev.h"
+
+// ---------------------------------------------------------------------------------
+// A debug device for benchmarking the emulator with real Atari programs. When the
+// BENCH DEVICE option is set it answers in the otherwise unused $D1xx (PBI select)
+// or $D6xx (PBI RAM window) page - see benchdev.h for the registers. A program picks
+// a region, writes START, runs the code under test and writes STOP; the region keeps
+// a running total of host clock ticks and emulated cycles (plus frames, skipped
+// frames and sound underruns for the profiler report) so you get the exact cost of
+// a BASIC loop or a nasty display list. Region commands are ignored in Run-Ahead
+// frames since those get rolled back and run again for real.
+//
+// The host clock is TIMER3 with an overflow IRQ extending it to 32 bits. The ARM9
+// PC sampler and the CPU self test also need TIMER3 so they take it over through
+// BENCH_ClockStart() which keeps the clock counting whatever the reload value.
+// ---------------------------------------------------------------------------------
+#define BENCH_PAGE_D1       1
+#define BENCH_PAGE_D6       2
+
+#define CPU_CLOCK_NTSC      1789773
+#define CPU_CLOCK_PAL       1773447
+
+enum {BC_HOST, BC_CYCLES, BC_FRAMES, BC_SKIPPED, BC_UNDERRUNS, BC_COUNTERS};
+
+typedef struct
+{
+    u32 count;
+    u32 total[BC_COUNTERS];
+    u32 start[BC_COUNTERS];
+    u8  running;
+} BenchRegion_t;
+
+u32 bench_frames = 0;
+u32 bench_frames_skipped = 0;
+u32 bench_audio_underruns __attribute__((section(".dtcm"))) = 0;    // Bumped from VsoundHandler() - keep it fast
+
+static BenchRegion_t bench_regions[BENCH_REGIONS];
+static u32    bench_latch[BC_COUNTERS];
+static u8     bench_region = 0;
+static u8     bench_mapped = 0;
+
+static u32    bench_clock_base = 0;          // Ticks counted by completed TIMER3 periods
+static u16    bench_clock_reload = 0;        // TIMER3 reload value of whoever is running it
+static u8     bench_clock_running = 0;
+static u8     bench_clock_borrowed = 0;      // The profiler or CPU test has TIMER3 right now
+static VoidFn bench_clock_handler = NULL;    // The TIMER3 owner's own IRQ work (if any)
+
+static void BenchClockIrq(void)
+{
+    bench_clock_base += 0x10000 - bench_clock_reload;
+    if (bench_clock_handler) bench_clock_handler();
+}
+
+u32 BENCH_HostClock(void)
+{
+    if (!bench_clock_running) return bench_clock_base;
+
+    int oldIME = enterCriticalSection();
+    u32 base = bench_clock_base;
+    u16 now = TIMER3_DATA;
+    if (REG_IF & IRQ_TIMER3)    // Wrapped but the IRQ hasn't been serviced yet - re-read so we know which side of the wrap we are on
+    {
+        now = TIMER3_DATA;
+        base += 0x10000 - bench_clock_reload;
+    }
+    leaveCriticalSection(oldIME);
+    return base + (u16)(now - bench_clock_reload);
+}
+
+static void BenchClockStop(void)
+{
+    bench_clock_base = BENCH_HostClock();   // Fold in the partial period so the clock carries on from here
+    TIMER3_CR = 0;
+    irqDisable(IRQ_TIMER3);
+    REG_IF = IRQ_TIMER3;
+    bench_clock_running = 0;
+    bench_clock_handler = NULL;
+}
+
+static void BenchClockRun(u16 reload, VoidFn handler)
+{
+    BenchClockStop();
+    bench_clock_reload = reload;
+    bench_clock_handler = handler;
+    TIMER3_DATA = reload;
+    TIMER3_CR = TIMER_DIV_1 | TIMER_IRQ_REQ | TIMER_ENABLE;
+    irqSet(IRQ_TIMER3, BenchClockIrq);
+    irqEnable(IRQ_TIMER3);
+    bench_clock_running = 1;
+}
+
+// ---------------------------------------------------------------------------------
+// Borrow TIMER3 at the given reload value (0 is the full 65536 tick period) with an
+// optional IRQ handler that runs on every overflow. The host clock runs while it is
+// borrowed even with the device off. BENCH_ClockRelease() hands it back - it then
+// stays running as the host clock only if the device is mapped.
+// ---------------------------------------------------------------------------------
+void BENCH_ClockStart(u16 reload, VoidFn handler)
+{
+    BenchClockRun(reload, handler);
+    bench_clock_borrowed = 1;
+}
+
+void BENCH_ClockRelease(void)
+{
+    bench_clock_borrowed = 0;
+    if (bench_mapped) BenchClockRun(0, NULL);
+    else BenchClockStop();
+}
+
+static void BenchSnapshot(u32 *out)
+{
+    out[BC_HOST]      = BENCH_HostClock();
+    out[BC_CYCLES]    = ANTIC_CPU_CLOCK;
+    out[BC_FRAMES]    = bench_frames;
+    out[BC_SKIPPED]   = bench_frames_skipped;
+    out[BC_UNDERRUNS] = bench_audio_underruns + POKEY_StreamUnderruns();
+}
+
+void BENCH_ResetRegions(void)
+{
+    memset(bench_regions, 0x00, sizeof(bench_regions));
+}
+
+static void BenchCommand(UBYTE cmd)
+{
+    BenchRegion_t *region = &bench_regions[bench_region];
+
+    switch (cmd)
+    {
+        case BENCH_CMD_LATCH:
+            BenchSnapshot(bench_latch);
+            break;
+
+        case BENCH_CMD_START:
+            BenchSnapshot(region->start);
+            region->running = 1;
+            break;
+
+        case BENCH_CMD_STOP:
+            if (!region->running) break;
+            BenchSnapshot(bench_latch);
+            for (int i=0; i<BC_COUNTERS; i++) region->total[i] += bench_latch[i] - region->start[i];
+            region->count++;
+            region->running = 0;
+            break;
+
+        case BENCH_CMD_RESET:
+            BENCH_ResetRegions();
+            break;
+    }
+}
+
+static UBYTE BENCH_GetByte(UWORD addr)
+{
+    BenchRegion_t *region = &bench_regions[bench_region];
+    UBYTE reg = addr & 0xFF;
+    UBYTE shift = (reg & 3) * 8;
+
+    if (reg > BENCH_CTRL) return 0;     // Not ours - reads like the PBI stubs we replaced
+
+    if (reg < BENCH_REGION_HOST)    return (UBYTE)(bench_latch[reg >> 2] >> shift);
+    if (reg < BENCH_REGION_CYCLES)  return (UBYTE)(region->total[BC_HOST] >> shift);
+    if (reg < BENCH_REGION_COUNT)   return (UBYTE)(region->total[BC_CYCLES] >> shift);
+
+    switch (reg)
+    {
+        case BENCH_REGION_COUNT:    return (UBYTE)region->count;
+        case BENCH_REGION:          return bench_region;
+        case BENCH_ID:              return BENCH_ID_VALUE;
+        default:                    return region->running;     // BENCH_CTRL
+    }
+}
+
+static void BENCH_PutByte(UWORD addr, UBYTE byte)
+{
+    if (pokey_decimate == 0) return;    // Run-Ahead frame - it will be run again for real
+
+    switch (addr & 0xFF)    // Only $xx00-$xx1F - the OS writes $D1FF to select PBI devices at reset
+    {
+        case BENCH_REGION:  bench_region = byte & (BENCH_REGIONS-1);    break;
+        case BENCH_CTRL:    BenchCommand(byte);                         break;
+    }
+}
+
+// ---------------------------------------------------------------------------------
+// Called from MEMORY_InitialiseMachine() after the D000 area is set up on every cold
+// start. The 5200 has no spare page in its I/O area so it never gets the device.
+// ---------------------------------------------------------------------------------
+void BENCH_InstallDevice(void)
+{
+    bench_mapped = 0;
+    if ((myConfig.machine_type != MACHINE_5200) && myConfig.bench_device)
+    {
+        UBYTE page = (myConfig.bench_device == BENCH_PAGE_D1) ? 0xd1 : 0xd6;
+        MEMORY_SetReadHandler(page, BENCH_GetByte);
+        MEMORY_SetWriteHandler(page, BENCH_PutByte);
+        bench_mapped = 1;
+        memset(bench_latch, 0x00, sizeof(bench_latch));
+        BENCH_ResetRegions();
+    }
+    if (!bench_clock_borrowed) BENCH_ClockRelease();
+}
+
+// ---------------------------------------------------------------------------------
+// The BENCH REGIONS section of the profiler report. Host time is shown in microseconds
+// and speed is emulated cycles against the real machine clock over the same host time
+// (100% is full speed). A '*' marks a region left running - only its finished runs
+// are counted. Totals are 32-bit so keep the host time per region under two minutes.
+// ---------------------------------------------------------------------------------
+void BENCH_WriteReport(FILE *fp)
+{
+    if (!bench_mapped) return;
+
+    u32 cpu_clock_hz = (myConfig.tv_type == TV_NTSC) ? CPU_CLOCK_NTSC : CPU_CLOCK_PAL;
+    fprintf(fp, "\nBENCH REGIONS ($%02X00)\n REG  COUNT        HOST_US       CYCLES  SPEED   FRAMES  SKIPPED  UNDERRUNS\n",
+            (myConfig.bench_device == BENCH_PAGE_D1) ? 0xD1 : 0xD6);
+    for (int i=0; i<BENCH_REGIONS; i++)
+    {
+        BenchRegion_t *region = &bench_regions[i];
+        if (region->count == 0) continue;
+        u32 *t = region->total;
+        u32 us = (u32)(((u64)t[BC_HOST] * 1000000) / BUS_CLOCK);
+        u32 speed = t[BC_HOST] ? (u32)(((u64)t[BC_CYCLES] * BUS_CLOCK * 100) / ((u64)t[BC_HOST] * cpu_clock_hz)) : 0;
+        fprintf(fp, " %d%c  %6u  %13u  %11u  %4u%%  %7u  %7u  %9u\n", i, region->running ? '*' : ' ', (unsigned)region->count,
+                (unsigned)us, (unsigned)t[BC_CYCLES], (unsigned)speed, (unsigned)t[BC_FRAMES], (unsigned)t[BC_SKIPPED], (unsigned)t[BC_UNDERRUNS]);
+    }
+}
@@ -0,0 +1,62 @@
+/*
+ * benchdev.h contains the optional memory-mapped benchmark counter device
+ *
+ * A8DS - Atari 8-bit Emulator designed to run on the Nintendo DS/DSi is
+ * Copyright (c) 2021-2025 Dave Bernazzani (wavemotion-dave)
+
+ * Copying and distribution of this emulator, its source code and associated
+ * readme files, with or without modification, are permitted in any medium without
+ * royalty provided this full copyright notice (including the Atari800 one below)
+ * is used and wavemotion-dave, alekmaul (original port), Atari800 team (for the
+ * original source) and Avery Lee (Altirra OS) are credited and thanked profusely.
+ *
+ * The A8DS emulator is offered as-is, without any warranty.
+ *
+ * Since much of the original codebase came from the Atari800 project, and since
+ * that project is released under the GPL V2, this program and source must also
+ * be distributed using that same licensing model. See COPYING for the full license.
+ */
+#ifndef __BENCHDEV_H
+#define __BENCHDEV_H
+
+#include <nds.h>
+#include <stdio.h>
+
+// ---------------------------------------------------------------------------------
+// Register layout - 32 registers at $xx00-$xx1F (the rest of the page is left as it
+// was so the XL OS PBI device select writes to $D1FF don't hit BENCH_CTRL). Counters are 32-bit
+// little endian and read from a snapshot taken by the LATCH (or STOP) command so a
+// multi-byte read is always consistent. The region registers show the selected region.
+// ---------------------------------------------------------------------------------
+#define BENCH_HOST          0x00    // Host clock (BUS_CLOCK ticks - 33.513982 MHz)
+#define BENCH_CYCLES        0x04    // Emulated 6502 cycles
+#define BENCH_FRAMES        0x08    // Emulated frames (not counting hidden Run-Ahead frames)
+#define BENCH_SKIPPED       0x0C    // Frames emulated but not drawn (frameskip or fast forward)
+#define BENCH_UNDERRUNS     0x10    // Sound ticks with no fresh sample to play
+#define BENCH_REGION_HOST   0x14    // Host clock total for the selected region
+#define BENCH_REGION_CYCLES 0x18    // Emulated cycle total for the selected region
+#define BENCH_REGION_COUNT  0x1C    // Times the selected region was stopped (low byte)
+#define BENCH_REGION        0x1D    // Selected region (0-7) - read/write
+#define BENCH_ID            0x1E    // Reads BENCH_ID_VALUE so a program can detect the device
+#define BENCH_CTRL          0x1F    // Write a BENCH_CMD_xxx - read back bit 0 set if the selected region is running
+
+#define BENCH_ID_VALUE      0xA8
+#define BENCH_REGIONS       8
+
+#define BENCH_CMD_LATCH     0x01    // Snapshot the counters
+#define BENCH_CMD_START     0x02    // Start the selected region
+#define BENCH_CMD_STOP      0x03    // Stop the selected region, add it to its totals and latch
+#define BENCH_CMD_RESET     0x04    // Clear all region totals
+
+extern u32 bench_frames;
+extern u32 bench_frames_skipped;
+extern u32 bench_audio_underruns;
+
+extern void BENCH_InstallDevice(void);
+extern void BENCH_ClockStart(u16 reload, VoidFn handler);
+extern void BENCH_ClockRelease(void);
+extern u32  BENCH_HostClock(void);
+extern void BENCH_ResetRegions(void);
+extern void BENCH_WriteReport(FILE *fp);
+
+#endif
@@ -54,6 +54,7 @@ struct GameSettings_t myConfig __attribute__((section(".dtcm")));
 UBYTE option_table        = 0;                // We have 2 pages of configuration options - this toggles between them
 UBYTE force_tv_type       = 99;               // When selecting a game, the user can force the TV type (NTSC vs PAL)
 UBYTE force_basic_enabled = 99;               // When selecting a game, the user can force the use of BASIC
+struct GameSettings_t *force_config = NULL;   // When resuming a suspended game, the exact settings it was running with
 
 const u16 RAM_SIZES[] = {16, 48, 64, 128, 320, 576, 1088}; // For the various machine_types
 
@@ -232,7 +233,11 @@ void ApplyGameSpecificSettings(void)
         if (ConfigDatabase.GameSettings[idx].game_crc == last_crc) break;
     }
 
-    if (idx < MAX_GAME_SETTINGS)    // We found a match in the database... use it!
+    if ((force_config != NULL) && (force_config->game_crc == last_crc))    // Resuming - use what it was suspended with
+    {
+        memcpy(&myConfig, force_config, sizeof(myConfig));
+    }
+    else if (idx < MAX_GAME_SETTINGS)    // We found a match in the database... use it!
     {
         memcpy(&myConfig, &ConfigDatabase.GameSettings[idx], sizeof(myConfig));
     }
@@ -254,6 +259,7 @@ void ApplyGameSpecificSettings(void)
         myConfig.basic_enabled = force_basic_enabled;
         if (!bFirstLoad) force_basic_enabled = 99;
     }
+    force_config = NULL;
 
     install_os();
  }
@@ -315,7 +321,7 @@ struct options_t
                       "KEY A", "KEY B", "KEY C", "KEY D", "KEY E", "KEY F", "KEY G", "KEY H", "KEY I", "KEY J", "KEY K", "KEY L", "KEY M", "KEY N", "KEY O",        \
                       "KEY P", "KEY Q", "KEY R", "KEY S", "KEY T", "KEY U", "KEY V", "KEY W", "KEY X", "KEY Y", "KEY Z", "KEY 0", "KEY 1", "KEY 2", "KEY 3",        \
                       "KEY 4", "KEY 5", "KEY 6", "KEY 7", "KEY 8", "KEY 9", "KEY UP", "KEY DOWN", "KEY LEFT", "KEY RIGHT", "SHIFT", "CONTROL",                      \
-                      "KEY SPARE1", "KEY SPARE2", "KEY SPARE3", "VERTICAL+", "VERTICAL++", "VERTICAL-", "VERTICAL--", "HORIZONTAL+", "HORIZONTAL++", "HORIZONTAL-", \
+                      "FAST FORWARD", "PROFILER", "CPU TEST", "VERTICAL+", "VERTICAL++", "VERTICAL-", "VERTICAL--", "HORIZONTAL+", "HORIZONTAL++", "HORIZONTAL-", \
                        "HORIZONTAL--", "OFFSET DPAD", "SCALE DPAD", "ZOOM SCREEN"}
 
 #define CART_TYPES {"00-NONE",       "01-STD8",       "02-STD16",      "03-OSS16-034M", "04-5200 32K",   "05-DB32",       "06-5200 16-EE", "07-5200 40K",   "08-WILLIAMS64", "09-EXP64",      \
@@ -343,6 +349,7 @@ const struct options_t Option_Table[2][20] =
         {"CART TYPE",   CART_TYPES,                                         &myConfig.cart_type,            OPT_NORMAL,116,  "ROM FILES DONT    ",   "ALWAYS AUTODETECT ",  "SO YOU CAN SET THE",  "CARTRIDGE TYPE    "},
         {"SKIP FRAMES", {"NO",          "MODERATE",     "AGGRESSIVE"},      &myConfig.skip_frames,          OPT_NORMAL, 3,   "OFF NORMALLY AS   ",   "SOME GAMES CAN    ",  "GLITCH WHEN SET   ",  "TO FRAMESKIP      "},
         {"FPS SETTING", {"OFF",         "ON", "ON-TURBO"},                  &myConfig.fps_setting,          OPT_NORMAL, 3,   "SHOW FPS ON MAIN  ",   "DISPLAY. OPTIONALY",  "RUN IN TURBO MODE ",  "FAST AS POSSIBLE  "},
+        {"RUN AHEAD",   {"OFF",         "1 FRAME",      "2 FRAMES"},        &myConfig.run_ahead,            OPT_NORMAL, 3,   "DSI ONLY. REDUCES ",   "INPUT LAG BUT NEED",  "SPARE CPU. 128K   ",  "MACHINES OR LESS  "},
         {"ARTIFACTING", {"OFF",         "1:BROWN/BLUE", "2:BLUE/BROWN",
                                         "3:RED/GREEN","4:GREEN/RED"},       &myConfig.artifacting,          OPT_NORMAL, 5,   "A FEW HIRES GAMES ",   "NEED ARTIFACING   ",  "TO LOOK RIGHT     ",  "OTHERWISE SET OFF "},
         {"SCREEN BLUR", {"NONE",        "LIGHT", "HEAVY"},                  &myConfig.blending,             OPT_NORMAL, 3,   "NORMALLY LIGHT    ",   "BLUR TO HELP WITH ",  "SCREEN SCALING    ",  "                  "},
@@ -350,6 +357,7 @@ const struct options_t Option_Table[2][20] =
         {"KEY CLICK",   {"OFF",         "ON"},                              &myConfig.key_click,            OPT_NORMAL, 2,   "NORMALLY ON       ",   "CAN BE USED TO    ",  "SILENCE KEY CLICKS",  "FOR KEYBOARD USE  "},
         {"DISK SPEED",  {"ACCURATE",    "FAST"},                            &myConfig.disk_speedup,         OPT_NORMAL, 2,   "NORMALLY FAST IS  ",   "DESIRED TO SPEED  ",  "UP FLOPPY DISK.   ",  "ACCURATE FOR SOME "},
         {"DISK SOUND",  {"DISABLED",    "ENABLED"},                         &myConfig.disk_sound,           OPT_NORMAL, 2,   "ENABLE FOR SOUND  ",   "EFFECTS ON SIO    ",  "ACCESS. OTHERWISE ",  "DISABLED.         "},
+        {"ARM7 SOUND",  {"OFF",         "ON"},                              &myConfig.sound_arm7,           OPT_NORMAL, 2,   "LET THE ARM7 DO   ",   "THE POKEY SOUND TO",  "FREE UP THE ARM9  ",  "FOR THE EMULATION "},
         {"EMULATOR TXT",{"OFF",         "ON"},                              &myConfig.emulatorText,         OPT_NORMAL, 2,   "NORMALLY ON       ",   "CAN BE USED TO    ",  "DISABLE FILENAME  ",  "INFO ON MAIN SCRN "},
         {"KEYBOARD",    {"800XL STYLE1","800XL STYLE2", "400 STYLE", 
                          "130XE STYLE", "ALPHANUMERIC", "STAR RAIDER"},     &myConfig.keyboard_type,        OPT_NORMAL, 6,   "CHOOSE THE STYLE  ",   "THAT BEST SUITS   ",  "YOUR TASTES.      ",  "                  "},
@@ -368,6 +376,7 @@ const struct options_t Option_Table[2][20] =
         {"D-PAD",       {"JOY 1", "JOY 2", "DIAGONALS", "CURSORS"},         &myConfig.dpad_type,            OPT_NORMAL, 4,   "CHOOSE HOW THE    ",   "JOYSTICK OPERATES ",  "CAN SWAP JOY1 AND ",  "JOY2 OR MAP CURSOR"},    
         {"AUTOFIRE",    {"OFF",         "SLOW",   "MED",  "FAST"},          &myConfig.auto_fire,            OPT_NORMAL, 4,   "TOGGLE AUTOFIRE   ",   "SLOW = 4x/SEC     ",  "MED  = 8x/SEC     ",  "FAST = 15x/SEC    "},
         {"5200 ANALOG",  {"FAST", "MEDIUM", "SLOW", "TRUE ANALOG"},         &myConfig.analog_speed,         OPT_NORMAL, 4,   "FOR THE A5200 THIS",   "REPRESENTS SPEED  ",  "OF THE ANALOG JOY ",  "STICK. EXPERIMENT."},
+        {"BENCH DEVICE",{"OFF",         "$D1XX",  "$D6XX"},                 &myConfig.bench_device,         OPT_NORMAL, 3,   "MAPS PERF COUNTERS",   "FOR ATARI BENCH   ",  "PROGRAMS. LEAVE   ",  "OFF NORMALLY.     "},
         {"X OFFSET",    {"XX"},                                     (UBYTE*)&myConfig.xOffset,              OPT_NUMERIC,0,   "SET SCREEN OFFSET ",   "                  ",  "                  ",  "                  "},
         {"Y OFFSET",    {"XX"},                                     (UBYTE*)&myConfig.yOffset,              OPT_NUMERIC,0,   "SET SCREEN OFFSET ",   "                  ",  "                  ",  "                  "},
         {"X SCALE",     {"XX"},                                     (UBYTE*)&myConfig.xScale,               OPT_NUMERIC,0,   "SET SCREEN SCALE  ",   "                  ",  "                  ",  "                  "},
@@ -56,9 +56,9 @@ struct GameSettings_t
     UBYTE alphaBlend;
     UBYTE disk_sound;
     UBYTE analog_speed;
-    UBYTE spare0;
-    UBYTE spare1;
-    UBYTE spare2;
+    UBYTE run_ahead;
+    UBYTE sound_arm7;
+    UBYTE bench_device;
     UBYTE spare3;
     UBYTE spare4;
     UBYTE spare5;
@@ -96,6 +96,7 @@ extern UBYTE option_table;
 extern UBYTE disable_basic;
 extern UBYTE force_tv_type;
 extern UBYTE force_basic_enabled;
+extern struct GameSettings_t *force_config;
 
 #define TV_NTSC     0
 #define TV_PAL      1
@@ -0,0 +1,308 @@
+/*
+ * cputest.c contains the on-device 6502 conformance and timing self test
+ *
+ * A8DS - Atari 8-bit Emulator designed to run on the Nintendo DS/DSi is
+ * Copyright (c) 2021-2025 Dave Bernazzani (wavemotion-dave)
+
+ * Copying and distribution of this emulator, its source code and associated
+ * readme files, with or without modification, are permitted in any medium without
+ * royalty provided this full copyright notice (including the Atari800 one below)
+ * is used and wavemotion-dave, alekmaul (original port), Atari800 team (for the
+ * original source) and Avery Lee (Altirra OS) are credited and thanked profusely.
+ *
+ * The A8DS emulator is offered as-is, without any warranty.
+ *
+ * Since much of the original codebase came from the Atari800 project, and since
+ * that project is released under the GPL V2, this program and source must also
+ * be distributed using that same licensing model. See COPYING for the full license.
+ */
+#include <nds.h>
+#include <stdio.h>
+#include <string.h>
+#ifndef CPUTEST_HOST
+#include <fat.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "a8ds.h"
+#endif
+#include "atari.h"
+#include "cpu.h"
+#include "memory.h"
+#include "antic.h"
+#ifndef CPUTEST_HOST
+#include "loadsave.h"
+#include "profiler.h"
+#include "cputest.h"
+#include "benchdev.h"
+#endif
+
+// ---------------------------------------------------------------------------------
+// A safety net for work on GO() in cpu.c - run it from the CPU TEST key and compare
+// the report before and after a change. The running game is snapshotted with the
+// Run-Ahead SaveStateToRAM() and the whole 64K is turned into plain RAM (no ROM, no
+// hardware, no cart windows) so GO() runs exactly as it does in a game minus the
+// device handlers. Everything is put back afterwards.
+//
+// 1. Timing: every documented opcode is single-stepped and the cycles GO() charged
+//    are checked against real NMOS 6502 timings - including the page crossing
+//    penalty (NCYCLES_X/NCYCLES_Y), branches taken, not taken and crossing a page
+//    (BRANCH) and the indexed writes / read-modify-writes that must not add one.
+// 2. Function: if the Klaus Dormann test binaries are on the SD card (they are not
+//    ours to ship) they are run to completion and the cycle rate is measured.
+//
+// The same tests build on a PC too - host/cpu_test.c defines CPUTEST_HOST and pulls
+// in this file and cpu.c, so a change to GO() can be checked in seconds without a DS.
+// ---------------------------------------------------------------------------------
+#ifndef CPUTEST_DIR
+#define CPUTEST_DIR         "/data/"            // Where the test binaries are looked for
+#endif
+#define CPUTEST_FILE        "/data/A8DS_CPUTEST.TXT"
+#define CPUTEST_CHUNK       30000               // Cycles per GO() call between trap checks
+#define CPUTEST_MAX_CYCLES  400000000           // About 4 minutes of real 6502 - the functional test needs ~100M
+#define CPUTEST_CODE        0x2000              // Where the single-stepped instructions are placed
+
+// Documented NMOS 6502 cycles with no page crossing and branches not taken. Zero = not tested.
+/*  0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F */
+static const UBYTE nmos_cycles[256] =
+{
+    7, 6, 0, 0, 0, 3, 5, 0, 3, 2, 2, 0, 0, 4, 6, 0,     /* 0x */
+    2, 5, 0, 0, 0, 4, 6, 0, 2, 4, 0, 0, 0, 4, 7, 0,     /* 1x */
+    6, 6, 0, 0, 3, 3, 5, 0, 4, 2, 2, 0, 4, 4, 6, 0,     /* 2x */
+    2, 5, 0, 0, 0, 4, 6, 0, 2, 4, 0, 0, 0, 4, 7, 0,     /* 3x */
+    6, 6, 0, 0, 0, 3, 5, 0, 3, 2, 2, 0, 3, 4, 6, 0,     /* 4x */
+    2, 5, 0, 0, 0, 4, 6, 0, 2, 4, 0, 0, 0, 4, 7, 0,     /* 5x */
+    6, 6, 0, 0, 0, 3, 5, 0, 4, 2, 2, 0, 5, 4, 6, 0,     /* 6x */
+    2, 5, 0, 0, 0, 4, 6, 0, 2, 4, 0, 0, 0, 4, 7, 0,     /* 7x */
+    0, 6, 0, 0, 3, 3, 3, 0, 2, 0, 2, 0, 4, 4, 4, 0,     /* 8x */
+    2, 6, 0, 0, 4, 4, 4, 0, 2, 5, 2, 0, 0, 5, 0, 0,     /* 9x */
+    2, 6, 2, 0, 3, 3, 3, 0, 2, 2, 2, 0, 4, 4, 4, 0,     /* Ax */
+    2, 5, 0, 0, 4, 4, 4, 0, 2, 4, 2, 0, 4, 4, 4, 0,     /* Bx */
+    2, 6, 0, 0, 3, 3, 5, 0, 2, 2, 2, 0, 4, 4, 6, 0,     /* Cx */
+    2, 5, 0, 0, 0, 4, 6, 0, 2, 4, 0, 0, 0, 4, 7, 0,     /* Dx */
+    2, 6, 0, 0, 3, 3, 5, 0, 2, 2, 2, 0, 4, 4, 6, 0,     /* Ex */
+    2, 5, 0, 0, 0, 4, 6, 0, 2, 4, 0, 0, 0, 4, 7, 0      /* Fx */
+};
+
+// The flags are all clear when we step, so these four branches are taken
+#define BRANCH_TAKEN(op)    (((op) == 0x10) || ((op) == 0x50) || ((op) == 0x90) || ((op) == 0xD0))
+#define IS_BRANCH(op)       (((op) & 0x1F) == 0x10)
+
+typedef struct
+{
+    UBYTE op;
+    UBYTE x, y;
+    UBYTE lo;               // Low byte of the operand (abs) or of the (zp) pointer
+    UBYTE at;               // Low byte of where the instruction sits - for branches across a page
+    UBYTE expected;
+    const char *what;
+} CpuTimingCase_t;
+
+// Operand $30F0 (or pointer to it) with X/Y=$20 crosses into $31xx
+static const CpuTimingCase_t crossing_cases[] =
+{
+    {0xBD, 0x20, 0x00, 0xF0, 0x00, 5, "LDA abs,X"},  {0xB9, 0x00, 0x20, 0xF0, 0x00, 5, "LDA abs,Y"},
+    {0xBC, 0x20, 0x00, 0xF0, 0x00, 5, "LDY abs,X"},  {0xBE, 0x00, 0x20, 0xF0, 0x00, 5, "LDX abs,Y"},
+    {0x1D, 0x20, 0x00, 0xF0, 0x00, 5, "ORA abs,X"},  {0x19, 0x00, 0x20, 0xF0, 0x00, 5, "ORA abs,Y"},
+    {0x3D, 0x20, 0x00, 0xF0, 0x00, 5, "AND abs,X"},  {0x39, 0x00, 0x20, 0xF0, 0x00, 5, "AND abs,Y"},
+    {0x5D, 0x20, 0x00, 0xF0, 0x00, 5, "EOR abs,X"},  {0x59, 0x00, 0x20, 0xF0, 0x00, 5, "EOR abs,Y"},
+    {0x7D, 0x20, 0x00, 0xF0, 0x00, 5, "ADC abs,X"},  {0x79, 0x00, 0x20, 0xF0, 0x00, 5, "ADC abs,Y"},
+    {0xDD, 0x20, 0x00, 0xF0, 0x00, 5, "CMP abs,X"},  {0xD9, 0x00, 0x20, 0xF0, 0x00, 5, "CMP abs,Y"},
+    {0xFD, 0x20, 0x00, 0xF0, 0x00, 5, "SBC abs,X"},  {0xF9, 0x00, 0x20, 0xF0, 0x00, 5, "SBC abs,Y"},
+    {0x11, 0x00, 0x20, 0xF0, 0x00, 6, "ORA (zp),Y"}, {0x31, 0x00, 0x20, 0xF0, 0x00, 6, "AND (zp),Y"},
+    {0x51, 0x00, 0x20, 0xF0, 0x00, 6, "EOR (zp),Y"}, {0x71, 0x00, 0x20, 0xF0, 0x00, 6, "ADC (zp),Y"},
+    {0xB1, 0x00, 0x20, 0xF0, 0x00, 6, "LDA (zp),Y"}, {0xD1, 0x00, 0x20, 0xF0, 0x00, 6, "CMP (zp),Y"},
+    {0xF1, 0x00, 0x20, 0xF0, 0x00, 6, "SBC (zp),Y"},
+    // Writes and read-modify-writes always take the extra cycle - crossing must not add another
+    {0x9D, 0x20, 0x00, 0xF0, 0x00, 5, "STA abs,X"},  {0x99, 0x00, 0x20, 0xF0, 0x00, 5, "STA abs,Y"},
+    {0x91, 0x00, 0x20, 0xF0, 0x00, 6, "STA (zp),Y"}, {0xFE, 0x20, 0x00, 0xF0, 0x00, 7, "INC abs,X"},
+    {0xDE, 0x20, 0x00, 0xF0, 0x00, 7, "DEC abs,X"},  {0x1E, 0x20, 0x00, 0xF0, 0x00, 7, "ASL abs,X"},
+    {0x3E, 0x20, 0x00, 0xF0, 0x00, 7, "ROL abs,X"},  {0x5E, 0x20, 0x00, 0xF0, 0x00, 7, "LSR abs,X"},
+    {0x7E, 0x20, 0x00, 0xF0, 0x00, 7, "ROR abs,X"},
+    // Taken branch from $20F0 by +$20 lands in the next page
+    {0x10, 0x00, 0x00, 0x20, 0xF0, 4, "BPL cross"},  {0x50, 0x00, 0x00, 0x20, 0xF0, 4, "BVC cross"},
+    {0x90, 0x00, 0x00, 0x20, 0xF0, 4, "BCC cross"},  {0xD0, 0x00, 0x00, 0x20, 0xF0, 4, "BNE cross"},
+    {0x30, 0x00, 0x00, 0x20, 0xF0, 2, "BMI no-take"},
+};
+
+typedef struct
+{
+    const char *name;
+    const char *file;       // Flat binary image
+    UWORD load;             // Where the image goes
+    UWORD start;            // Where execution begins
+    UWORD success;          // PC of the success trap - or 0 to judge by the result byte
+    UWORD result;           // Zero page byte that is 0 on success (when success is 0)
+} CpuTestImage_t;
+
+// As assembled from the stock sources with the end of test set to 'JMP *'
+static const CpuTestImage_t test_images[] =
+{
+    {"FUNCTIONAL", CPUTEST_DIR "6502_functional_test.bin", 0x0000, 0x0400, 0x3469, 0x0000},
+    {"DECIMAL",    CPUTEST_DIR "6502_decimal_test.bin",    0x0200, 0x0200, 0x0000, 0x000B},
+};
+
+// Set up a flat 64K of RAM. Zero page and the stack stay in fast_page as in a game.
+static void CpuFlatMemory(void)
+{
+    for (int i=0; i<256; i++)
+    {
+        MEMORY_SetReadHandler(i, NULL);
+        MEMORY_SetWriteHandler(i, NULL);
+    }
+    MEMORY_MapBank(0, fast_page);
+    for (int bank=1; bank<16; bank++) MEMORY_MapBank(bank, memory);
+    memset(fast_page, 0x00, sizeof(fast_page));
+    memset(memory + 0x1000, 0x00, 0xF000);
+}
+
+static void CpuSetRegs(UWORD pc, UBYTE x, UBYTE y)
+{
+    regPC = pc;
+    regA = 0x00; regX = x; regY = y;
+    regS = 0xFF;
+    regP = 0x34;            // I set, everything else clear
+    CPU_PutStatus();
+    IRQ = 0;
+    wsync_halt = 0;
+}
+
+// Execute exactly one instruction and return the cycles GO() charged for it
+static int CpuStep(void)
+{
+    xpos = 0;
+    GO(1);
+    return xpos;
+}
+
+static int CpuTimeInsn(UWORD at, UBYTE op, UBYTE lo, UBYTE x, UBYTE y)
+{
+    dPutByte(at, op);
+    dPutByte(at+1, lo);
+    dPutByte(at+2, 0x30);
+    dPutWord(0x3010, 0x3100);               // JMP ($3010) target
+    fast_page[lo] = 0xF0; fast_page[(UBYTE)(lo+1)] = 0x30;  // (zp) pointer -> $30F0
+    dPutWord(0xFFFE, CPUTEST_CODE + 0x80);  // BRK vector
+    CpuSetRegs(at, x, y);
+    return CpuStep();
+}
+
+static u32 CpuTimingTest(FILE *fp)
+{
+    u32 errors = 0, tested = 0;
+
+    fprintf(fp, "TIMING\n");
+    for (int op=0; op<256; op++)
+    {
+        if (nmos_cycles[op] == 0) continue;
+        int expected = nmos_cycles[op] + (BRANCH_TAKEN(op) ? 1 : 0);
+        int got = CpuTimeInsn(CPUTEST_CODE, op, 0x10, 0x00, 0x00);
+        tested++;
+        if (got != expected)
+        {
+            fprintf(fp, "  OP $%02X%s  expected %d  got %d\n", op, IS_BRANCH(op) ? " (branch)" : "", expected, got);
+            errors++;
+        }
+    }
+
+    for (int i=0; i<(sizeof(crossing_cases)/sizeof(crossing_cases[0])); i++)
+    {
+        const CpuTimingCase_t *t = &crossing_cases[i];
+        int got = CpuTimeInsn(CPUTEST_CODE | t->at, t->op, t->lo, t->x, t->y);
+        tested++;
+        if (got != t->expected)
+        {
+            fprintf(fp, "  %-12s expected %d  got %d\n", t->what, t->expected, got);
+            errors++;
+        }
+    }
+    fprintf(fp, "  %u checked  %u wrong\n\n", (unsigned)tested, (unsigned)errors);
+    return errors;
+}
+
+// Returns 0 pass, 1 fail, 2 not run (no image on the SD card)
+static u8 CpuImageTest(FILE *fp, const CpuTestImage_t *img)
+{
+    static UBYTE buf[256];
+    FILE *bin = fopen(img->file, "rb");
+    if (bin == NULL)
+    {
+        fprintf(fp, "%s: %s not found - skipped\n", img->name, img->file);
+        return 2;
+    }
+
+    CpuFlatMemory();
+    u32 addr = img->load;
+    size_t n;
+    while (((n = fread(buf, 1, sizeof(buf), bin)) > 0) && (addr < 0x10000))
+    {
+        for (size_t i=0; (i < n) && (addr < 0x10000); i++) dPutByte(addr++, buf[i]);
+    }
+    fclose(bin);
+    CpuSetRegs(img->start, 0x00, 0x00);
+
+    // The bench device host clock (BUS_CLOCK) - summed per chunk so a long run can't wrap it
+    u32 cycles = 0;
+    u64 ticks = 0;
+    BENCH_ClockStart(0, NULL);
+    u32 last_tick = BENCH_HostClock();
+
+    UWORD trap = 0;
+    while (cycles < CPUTEST_MAX_CYCLES)
+    {
+        xpos = 0;
+        GO(CPUTEST_CHUNK);
+        cycles += xpos;
+        u32 now = BENCH_HostClock();
+        ticks += (u32)(now - last_tick);
+        last_tick = now;
+
+        UWORD pc = regPC;           // A trap is an instruction that jumps to itself
+        cycles += CpuStep();
+        if (regPC == pc) {trap = pc; break;}
+    }
+    BENCH_ClockRelease();
+
+    u8 pass;
+    if (img->success) pass = (trap == img->success);
+    else pass = (trap != 0) && (dGetByte(img->result) == 0);
+
+    u32 ms = (u32)((ticks * 1000) / BUS_CLOCK);
+    u32 khz = ms ? (cycles / ms) : 0;
+    fprintf(fp, "%s: %s  trap $%04X  %u cycles in %u ms (%u.%03u MHz - real 6502 is 1.790)\n", img->name, pass ? "PASS" : "FAIL",
+            trap, (unsigned)cycles, (unsigned)ms, (unsigned)(khz / 1000), (unsigned)(khz % 1000));
+    return pass ? 0 : 1;
+}
+
+#ifndef CPUTEST_HOST
+u8 CPUTEST_Run(void)
+{
+    if (profiler_enabled) return 1;         // Don't run the test into the middle of a profile
+    if (!SaveStateToRAM()) return 1;
+    void (*saved_rts_handler)(void) = rts_handler;
+    rts_handler = NULL;
+
+    DIR* dir = opendir("/data");
+    if (dir) closedir(dir);
+    else mkdir("/data", 0777);
+
+    u8 failed = 0;
+    FILE *fp = fopen(CPUTEST_FILE, "w");
+    if (fp != NULL)
+    {
+        fprintf(fp, "A8DS 6502 SELF TEST\n\n");
+        CpuFlatMemory();
+        if (CpuTimingTest(fp)) failed = 1;
+        for (int i=0; i<(sizeof(test_images)/sizeof(test_images[0])); i++)
+        {
+            if (CpuImageTest(fp, &test_images[i]) == 1) failed = 1;
+        }
+        fclose(fp);
+    }
+    else failed = 1;
+
+    rts_handler = saved_rts_handler;
+    LoadStateFromRAM();
+    return failed;
+}
+#endif
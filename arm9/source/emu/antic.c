@@ -59,10 +59,22 @@
 #include "pokeysnd.h"
 #include "util.h"
 #include "input.h"
+#include "profiler.h"
 #ifdef NEW_CYCLE_EXACT
 #include "cycle_map.h"
 #endif
 
+// Use the hand scheduled ARM spans in antic_draw.s for modes E and F instead of the
+// plain C loops, which are the reference for what they draw. Left off until the real
+// kernels have passed host/antic_span_test.c under qemu-arm or been checked on a DS -
+// so far only its C model of them has. Turn it on here and in antic_draw.s together.
+//#define ANTIC_ASM_KERNELS
+
+#ifdef ANTIC_ASM_KERNELS
+int antic_span_e(int nchars, const UBYTE *src, UWORD *dst, const ULONG *pm, ULONG background);
+int antic_span_f(int nchars, const UBYTE *src, UWORD *dst, const ULONG *pm, ULONG background);
+#endif
+
 #define LCHOP 3         /* do not build lefmost 0..3 characters in wide mode */
 #define RCHOP 3         /* do not build rightmost 0..3 characters in wide mode */
 
@@ -77,8 +89,8 @@ void update_scanline_prior(UBYTE byte);
 void update_scanline_chbase(void);
 void update_scanline_invert(void);
 void update_scanline_blank(void);
-int *cpu2antic_ptr          __attribute__((section(".dtcm")));
-int *antic2cpu_ptr          __attribute__((section(".dtcm")));
+const SBYTE *cpu2antic_ptr  __attribute__((section(".dtcm")));
+const UBYTE *antic2cpu_ptr  __attribute__((section(".dtcm")));
 u8 delayed_wsync            __attribute__((section(".dtcm")))= 0;
 u8 dmactl_changed           __attribute__((section(".dtcm")))= 0;
 UBYTE DELAYED_DMACTL        __attribute__((section(".dtcm")));
@@ -831,9 +843,8 @@ void ANTIC_Initialise(void) {
     mode_e_an_lookup[2] = mode_e_an_lookup[8] = mode_e_an_lookup[0x20] = mode_e_an_lookup[0x80] = 1;
     mode_e_an_lookup[3] = mode_e_an_lookup[12] = mode_e_an_lookup[0x30] = mode_e_an_lookup[0xc0] = 2;
 #ifdef NEW_CYCLE_EXACT
-    create_cycle_map();
-    cpu2antic_ptr = &cpu2antic[0];
-    antic2cpu_ptr = &antic2cpu[0];
+    cpu2antic_ptr = CPU2ANTIC_ROW(0);
+    antic2cpu_ptr = ANTIC2CPU_ROW(0);
 #endif /* NEW_CYCLE_EXACT */
 }
 
@@ -1175,11 +1186,62 @@ static void draw_an_gtia11(const ULONG *t_pm_scanline_ptr)
     if (blank_lookup[screendata & blank_mask])\
         chdata ^= chptr[(screendata & 0x7f) << 3];
 
+// ---------------------------------------------------------------------------------
+// Pre-expanded character rows for the text modes. Rather than keying on the font
+// itself (which the game can rewrite at any time without us seeing it) we key on
+// the row bit pattern - every glyph row of every font is one of 256 patterns - and
+// hold the four finished screen words for it in the current colours. The rows are
+// filled in lazily and the whole lot is dropped (by bumping the generation) when
+// the colours they were built with change, so a DLI colour bar only costs us the
+// rows actually drawn on that line. With no PM on the char it is two long stores.
+// ---------------------------------------------------------------------------------
+static ULONG glyph_rows_2[256][2];         /* mode 2: chdata after invert/blank */
+static ULONG glyph_rows_4[2][256][2];      /* mode 4,5: inverse bit, chdata */
+static ULONG glyph_rows_6[64][2];          /* mode 6,7: colour, 4-bit half of chdata */
+static UBYTE glyph_tags_2[256];
+static UBYTE glyph_tags_4[2][256];
+static UBYTE glyph_tags_6[64];
+static UWORD glyph_key_2[4], glyph_key_4[5], glyph_key_6[5];
+static UBYTE glyph_gen_2 = 1, glyph_gen_4 = 1, glyph_gen_6 = 1;
+
+static UBYTE glyph_validate(UWORD *key, const UWORD *colours, int n, UBYTE *gen, UBYTE *tags, int ntags)
+{
+    if (memcmp(key, colours, n * sizeof(UWORD)) != 0) {
+        memcpy(key, colours, n * sizeof(UWORD));
+        if (++(*gen) == 0) {    /* wrapped - forget every row */
+            memset(tags, 0, ntags);
+            *gen = 1;
+        }
+    }
+    return *gen;
+}
+
+#define GLYPH_ROW(row, w0, w1, w2, w3) {\
+    (row)[0] = (w0) | ((ULONG) (w1) << 16);\
+    (row)[1] = (w2) | ((ULONG) (w3) << 16);\
+}
+
+#define DRAW_GLYPH_ROW(row) {\
+    if (((ULONG)ptr & 0x03) == 0) { \
+        WRITE_VIDEO_LONG(((ULONG *) ptr), (row)[0]); \
+        WRITE_VIDEO_LONG(((ULONG *) ptr)+1, (row)[1]); \
+        ptr += 4; \
+    } else \
+        { \
+         WRITE_VIDEO(ptr++, (UWORD) (row)[0]); \
+         WRITE_VIDEO(ptr++, (UWORD) ((row)[0] >> 16)); \
+         WRITE_VIDEO(ptr++, (UWORD) (row)[1]); \
+         WRITE_VIDEO(ptr++, (UWORD) ((row)[1] >> 16)); \
+        } \
+    }
+
 static void draw_antic_2(int nchars, const UBYTE *ANTIC_memptr, UWORD *ptr, const ULONG *t_pm_scanline_ptr)
 {
     INIT_BACKGROUND_6
     INIT_ANTIC_2
     INIT_HIRES
+    UWORD colours[4] = {hires_norm(0x00), hires_norm(0x40), hires_norm(0x80), hires_norm(0xc0)};
+    UBYTE gen = glyph_validate(glyph_key_2, colours, 4, &glyph_gen_2, glyph_tags_2, sizeof(glyph_tags_2));
 
     CHAR_LOOP_BEGIN
         UBYTE screendata = *ANTIC_memptr++;
@@ -1188,10 +1250,13 @@ static void draw_antic_2(int nchars, const UBYTE *ANTIC_memptr, UWORD *ptr, cons
         GET_CHDATA_ANTIC_2
         if (IS_ZERO_ULONG(t_pm_scanline_ptr)) {
             if (chdata) {
-                WRITE_VIDEO(ptr++, hires_norm(chdata & 0xc0));
-                WRITE_VIDEO(ptr++, hires_norm(chdata & 0x30));
-                WRITE_VIDEO(ptr++, hires_norm(chdata & 0x0c));
-                WRITE_VIDEO(ptr++, hires_norm((chdata & 0x03) << 2));
+                ULONG *row = glyph_rows_2[chdata];
+                if (glyph_tags_2[chdata] != gen) {
+                    GLYPH_ROW(row, hires_norm(chdata & 0xc0), hires_norm(chdata & 0x30),
+                                   hires_norm(chdata & 0x0c), hires_norm((chdata & 0x03) << 2))
+                    glyph_tags_2[chdata] = gen;
+                }
+                DRAW_GLYPH_ROW(row)
             }
             else
                 DRAW_BACKGROUND(C_PF2)
@@ -1445,6 +1510,8 @@ ITCM_CODE static void draw_antic_4(int nchars, const UBYTE *ANTIC_memptr, UWORD
     lookup2[0x80] = lookup2[0x20] = lookup2[0x08] = lookup2[0x02] = cl_lookup[C_PF1];
     lookup2[0xc0] = lookup2[0x30] = lookup2[0x0c] = lookup2[0x03] = cl_lookup[C_PF2];
     lookup2[0xcf] = lookup2[0x3f] = lookup2[0x1b] = lookup2[0x12] = cl_lookup[C_PF3];
+    UWORD colours[5] = {cl_lookup[C_BAK], cl_lookup[C_PF0], cl_lookup[C_PF1], cl_lookup[C_PF2], cl_lookup[C_PF3]};
+    UBYTE gen = glyph_validate(glyph_key_4, colours, 5, &glyph_gen_4, &glyph_tags_4[0][0], sizeof(glyph_tags_4));
 
     CHAR_LOOP_BEGIN
         UBYTE screendata = *ANTIC_memptr++;
@@ -1457,10 +1524,13 @@ ITCM_CODE static void draw_antic_4(int nchars, const UBYTE *ANTIC_memptr, UWORD
         chdata = chptr[(screendata & 0x7f) << 3];
         if (IS_ZERO_ULONG(t_pm_scanline_ptr)) {
             if (chdata) {
-                WRITE_VIDEO(ptr++, lookup[chdata & 0xc0]);
-                WRITE_VIDEO(ptr++, lookup[chdata & 0x30]);
-                WRITE_VIDEO(ptr++, lookup[chdata & 0x0c]);
-                WRITE_VIDEO(ptr++, lookup[chdata & 0x03]);
+                ULONG *row = glyph_rows_4[screendata >> 7][chdata];
+                if (glyph_tags_4[screendata >> 7][chdata] != gen) {
+                    GLYPH_ROW(row, lookup[chdata & 0xc0], lookup[chdata & 0x30],
+                                   lookup[chdata & 0x0c], lookup[chdata & 0x03])
+                    glyph_tags_4[screendata >> 7][chdata] = gen;
+                }
+                DRAW_GLYPH_ROW(row)
             }
             else
                 DRAW_BACKGROUND(C_BAK)
@@ -1519,6 +1589,10 @@ ITCM_CODE static void draw_antic_6(int nchars, const UBYTE *ANTIC_memptr, UWORD
     else
         chptr = AnticMainMemLookup(((anticmode == 6 ? dctr & 7 : dctr >> 1) ^ chbase_20));
 
+    UWORD colours[5] = {cl_lookup[C_BAK], COLOUR(playfield_lookup[0x40]), COLOUR(playfield_lookup[0x80]),
+                        COLOUR(playfield_lookup[0xc0]), COLOUR(playfield_lookup[0x100])};
+    UBYTE gen = glyph_validate(glyph_key_6, colours, 5, &glyph_gen_6, glyph_tags_6, sizeof(glyph_tags_6));
+
     ADD_FONT_CYCLES;
     CHAR_LOOP_BEGIN
         UBYTE screendata = *ANTIC_memptr++;
@@ -1530,30 +1604,14 @@ ITCM_CODE static void draw_antic_6(int nchars, const UBYTE *ANTIC_memptr, UWORD
         do {
             if (IS_ZERO_ULONG(t_pm_scanline_ptr)) {
                 if (chdata & 0xf0) {
-                    if (chdata & 0x80) {
-                        WRITE_VIDEO(ptr++, colour);
-                    }
-                    else {
-                        WRITE_VIDEO(ptr++, cl_lookup[C_BAK]);
-                    }
-                    if (chdata & 0x40) {
-                        WRITE_VIDEO(ptr++, colour);
-                    }
-                    else {
-                        WRITE_VIDEO(ptr++, cl_lookup[C_BAK]);
-                    }
-                    if (chdata & 0x20) {
-                        WRITE_VIDEO(ptr++, colour);
-                    }
-                    else {
-                        WRITE_VIDEO(ptr++, cl_lookup[C_BAK]);
-                    }
-                    if (chdata & 0x10) {
-                        WRITE_VIDEO(ptr++, colour);
-                    }
-                    else {
-                        WRITE_VIDEO(ptr++, cl_lookup[C_BAK]);
+                    int idx = ((screendata & 0xc0) >> 2) | (chdata >> 4);
+                    ULONG *row = glyph_rows_6[idx];
+                    if (glyph_tags_6[idx] != gen) {
+                        GLYPH_ROW(row, (chdata & 0x80) ? colour : cl_lookup[C_BAK], (chdata & 0x40) ? colour : cl_lookup[C_BAK],
+                                       (chdata & 0x20) ? colour : cl_lookup[C_BAK], (chdata & 0x10) ? colour : cl_lookup[C_BAK])
+                        glyph_tags_6[idx] = gen;
                     }
+                    DRAW_GLYPH_ROW(row)
                 }
                 else {
                     WRITE_VIDEO(ptr++, cl_lookup[C_BAK]);
@@ -1812,8 +1870,21 @@ static void draw_antic_e(int nchars, const UBYTE *ANTIC_memptr, UWORD *ptr, cons
     lookup2[0x40] = lookup2[0x10] = lookup2[0x04] = lookup2[0x01] = cl_lookup[C_PF0];
     lookup2[0x80] = lookup2[0x20] = lookup2[0x08] = lookup2[0x02] = cl_lookup[C_PF1];
     lookup2[0xc0] = lookup2[0x30] = lookup2[0x0c] = lookup2[0x03] = cl_lookup[C_PF2];
+#ifdef ANTIC_ASM_KERNELS
+    const int span_ok = ((((ULONG) ptr | (ULONG) t_pm_scanline_ptr) & 3) == 0);
+#endif
 
     CHAR_LOOP_BEGIN
+#ifdef ANTIC_ASM_KERNELS
+        if (span_ok) {  /* draw up to the next char with PM on it in one go */
+            int done = antic_span_e(nchars, ANTIC_memptr, ptr, t_pm_scanline_ptr, background);
+            if (done == nchars) break;
+            ANTIC_memptr += done;
+            ptr += done * 4;
+            t_pm_scanline_ptr += done;
+            nchars -= done;
+        }
+#endif
         UBYTE screendata = *ANTIC_memptr++;
         if (IS_ZERO_ULONG(t_pm_scanline_ptr)) {
             if (screendata) {
@@ -1916,8 +1987,21 @@ static void draw_antic_f(int nchars, const UBYTE *ANTIC_memptr, UWORD *ptr, cons
 {
     INIT_BACKGROUND_6
     INIT_HIRES
+#ifdef ANTIC_ASM_KERNELS
+    const int span_ok = ((((ULONG) ptr | (ULONG) t_pm_scanline_ptr) & 3) == 0);
+#endif
 
     CHAR_LOOP_BEGIN
+#ifdef ANTIC_ASM_KERNELS
+        if (span_ok) {  /* draw up to the next char with PM on it in one go */
+            int done = antic_span_f(nchars, ANTIC_memptr, ptr, t_pm_scanline_ptr, background);
+            if (done == nchars) break;
+            ANTIC_memptr += done;
+            ptr += done * 4;
+            t_pm_scanline_ptr += done;
+            nchars -= done;
+        }
+#endif
         int screendata = *ANTIC_memptr++;
         if (IS_ZERO_ULONG(t_pm_scanline_ptr)) {
             if (screendata) {
@@ -2383,6 +2467,47 @@ static void ANTIC_load(void)
 
 #ifdef NEW_CYCLE_EXACT
 int cur_screen_pos __attribute__((section(".dtcm"))) = NOT_DRAWING;
+
+// ---------------------------------------------------------------------------------
+// Viewport culling. The DS only shows a 256x192 window of the Atari framebuffer so
+// ANTIC_SetViewport() is told (once per frame) which words and scanlines are on
+// screen and draw_partial_scanline() clips to that. Anything outside the window is
+// still drawn if a player/missile pixel lands there so playfield collisions stay
+// exact - and the mode line data is still fetched so the lines below are right.
+// ---------------------------------------------------------------------------------
+short int antic_view_left   = (LCHOP * 4);
+short int antic_view_right  = ((48 - RCHOP) * 4);
+int antic_view_top          = 8;
+int antic_view_bottom       = ATARI_HEIGHT + 8;
+static short int clip_left  __attribute__((section(".dtcm"))) = (LCHOP * 4);
+static short int clip_right __attribute__((section(".dtcm"))) = ((48 - RCHOP) * 4);
+
+/* x,y,width,height are in framebuffer pixels - row 0 is scanline 8 */
+void ANTIC_SetViewport(int x, int y, int width, int height)
+{
+    /* one word of slop either side for the blend jitter and rounding... */
+    int left = (x >> 1) - 1;
+    int right = ((x + width + 1) >> 1) + 1;
+    /* ...and an extra line above as the GTIA mode 11 delay ORs in the previous line */
+    int top = y + 8 - 2;
+    int bottom = y + height + 8 + 1;
+
+    antic_view_left = (left < (LCHOP * 4)) ? (LCHOP * 4) : ((left > ((48 - RCHOP) * 4)) ? ((48 - RCHOP) * 4) : left);
+    antic_view_right = (right > ((48 - RCHOP) * 4)) ? ((48 - RCHOP) * 4) : ((right < antic_view_left) ? antic_view_left : right);
+    antic_view_top = (top < 8) ? 8 : top;
+    antic_view_bottom = (bottom > ATARI_HEIGHT + 8) ? ATARI_HEIGHT + 8 : bottom;
+}
+
+/* is there any player/missile pixel between words l and r? */
+static int pm_in_range(int l, int r)
+{
+    if (!pm_dirty)
+        return FALSE;
+    for (; l < r; l++)
+        if (pm_scanline[l])
+            return TRUE;
+    return FALSE;
+}
 #endif
 
 
@@ -2447,6 +2572,7 @@ ITCM_CODE void ANTIC_Frame(int draw_display)
 
     do {
         POKEY_Scanline();       /* check and generate IRQ */
+        PROFILER_SCANLINE();
         if (missile_or_player_dma_enabled)
         {
             pmg_dma();
@@ -2558,8 +2684,8 @@ ITCM_CODE void ANTIC_Frame(int draw_display)
             else if (anticmode >=0x0d)
                 cpu2antic_index += 17 * 4;
         }
-        cpu2antic_ptr = &cpu2antic[CPU2ANTIC_SIZE * cpu2antic_index];
-        antic2cpu_ptr = &antic2cpu[CPU2ANTIC_SIZE * cpu2antic_index];
+        cpu2antic_ptr = CPU2ANTIC_ROW(cpu2antic_index);
+        antic2cpu_ptr = ANTIC2CPU_ROW(cpu2antic_index);
 #endif /* NEW_CYCLE_EXACT */
 
         if ((IR & 0x4f) == 1 && (DMACTL & 0x20)) {
@@ -2571,6 +2697,12 @@ ITCM_CODE void ANTIC_Frame(int draw_display)
         /* begin drawing here */
         if (draw_display) {
             cur_screen_pos = LBORDER_START;
+            if (ypos >= antic_view_top && ypos < antic_view_bottom) {
+                clip_left = antic_view_left;
+                clip_right = antic_view_right;
+            }
+            else
+                clip_left = clip_right = (48 - RCHOP) * 4; /* off screen - only PM pixels get drawn */
             xpos = antic2cpu_ptr[xpos]; /* convert antic to cpu(need for WSYNC) */
             if (dctr == lastline) {
                 if (no_jvb)
@@ -2790,6 +2922,7 @@ ITCM_CODE void ANTIC_Frame(int draw_display)
 
     do {
         POKEY_Scanline();       /* check and generate IRQ */
+        PROFILER_SCANLINE();
         OVERSCREEN_LINE;
     } while (ypos < max_ypos);
     ypos = 0; /* just for monitor.c */
@@ -2975,6 +3108,21 @@ void draw_partial_scanline(int l, int r)
         r = lborder_start;
     if (l >= r)
         return;
+    /* viewport culling: drop what the DS can't show unless PM pixels need the collisions */
+    {
+        int full_r = r;
+        if (l < clip_left && !pm_in_range(l, (clip_left < r) ? clip_left : r))
+            l = clip_left;
+        if (r > clip_right && !pm_in_range((clip_right > l) ? clip_right : l, r))
+            r = clip_right;
+        if (l >= r) {
+            if (need_load && full_r > lborder_end) {
+                ANTIC_load();
+                need_load = FALSE;
+            }
+            return;
+        }
+    }
     if (l < lborder_end) {
         /* left point is within left border */
         sv_bufstart = (l & (~3)); /* high order bits give buffer start */
@@ -3250,8 +3398,8 @@ void ANTIC_PutByte(UWORD addr, UBYTE byte)
                     update_scanline();
                     /*fix for a minor glitch in fasteddie*/
                     /*don't steal cycles after DMACTL off*/
-                    cpu2antic_ptr = &cpu2antic[0];
-                    antic2cpu_ptr = &antic2cpu[0];
+                    cpu2antic_ptr = CPU2ANTIC_ROW(0);
+                    antic2cpu_ptr = ANTIC2CPU_ROW(0);
                     xpos = antic2cpu_ptr[antic_xpos];
                     xpos_limit = antic2cpu_ptr[antic_limit];
                 }
@@ -111,8 +111,8 @@ extern UBYTE PENV_input;
 #ifdef NEW_CYCLE_EXACT
 #define NOT_DRAWING -999
 #define DRAWING_SCREEN (cur_screen_pos!=NOT_DRAWING)
-extern int *cpu2antic_ptr;
-extern int *antic2cpu_ptr;
+extern const SBYTE *cpu2antic_ptr;
+extern const UBYTE *antic2cpu_ptr;
 extern UBYTE delayed_wsync;
 extern UBYTE dmactl_changed;
 extern UBYTE DELAYED_DMACTL;
@@ -187,6 +187,7 @@ extern const UBYTE *pm_lookup_ptr;
 void ANTIC_Initialise(void);
 void ANTIC_Reset(void);
 void ANTIC_Frame(int draw_display);
+void ANTIC_SetViewport(int x, int y, int width, int height);
 UBYTE ANTIC_GetByte(UWORD addr);
 void ANTIC_PutByte(UWORD addr, UBYTE byte);
 UBYTE ANTIC_GetDLByte(UWORD *paddr);
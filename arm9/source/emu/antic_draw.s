@@ -0,0 +1,99 @@
+@ ---------------------------------------------------------------------------------
+@ ANTIC_DRAW.S contains hand scheduled ARM kernels for the plain ANTIC bitmap
+@ modes E and F - the bulk of the pixels for most games.
+@
+@ A8DS - Atari 8-bit Emulator designed to run on the Nintendo DS/DSi is
+@ Copyright (c) 2021-2025 Dave Bernazzani (wavemotion-dave)
+@
+@ Copying and distribution of this emulator, its source code and associated
+@ readme files, with or without modification, are permitted in any medium without
+@ royalty provided this full copyright notice (including the Atari800 one below)
+@ is used and wavemotion-dave, alekmaul (original port), Atari800 team (for the
+@ original source) and Avery Lee (Altirra OS) are credited and thanked profusely.
+@
+@ The A8DS emulator is offered as-is, without any warranty.
+@ ---------------------------------------------------------------------------------
+@ Both routines draw a run of characters that have no player/missile pixels on
+@ them and hand back to the C loop in antic.c as soon as they reach one that does
+@ (or the run is finished). The C loops in draw_antic_e() and draw_antic_f() are
+@ the reference - these must produce exactly the same screen words:
+@
+@   int antic_span_e(int nchars, const UBYTE *src, UWORD *dst, const ULONG *pm, ULONG background)
+@   int antic_span_f(int nchars, const UBYTE *src, UWORD *dst, const ULONG *pm, ULONG background)
+@
+@ The return value is the number of chars drawn. dst and pm must be word aligned
+@ (the caller checks) so we can test the 4 PM bytes with one load and store the
+@ 8 pixels as an STM pair. Mode E looks up lookup2[] by the masked bit pair, mode F
+@ looks up hires_lookup_n[] via the hires_norm() indexing - both tables are in DTCM.
+@ host/antic_span_test.c checks both against the C loops - see there for how to run
+@ it. They are only assembled with ANTIC_ASM_KERNELS set, which must match antic.c,
+@ so they don't take up ITCM while the C loops are in use.
+@ ---------------------------------------------------------------------------------
+@ ANTIC_ASM_KERNELS = 1
+
+    .ifdef  ANTIC_ASM_KERNELS
+
+    .arm
+    .section .itcm,"ax",%progbits
+    .align  2
+
+@ r0=chars left  r1=src  r2=dst  r3=pm  r12=table  r8=chars asked for
+@ r9=lr=background  r4-r7 scratch. The src byte load is issued before the PM
+@ test so its result is ready by the time we need it.
+    .macro  ANTIC_SPAN table, sh, m0, m1, m2, m3, hires
+    stmfd   sp!, {r4-r9, lr}
+    ldr     r9, [sp, #28]           @ background - 5th arg sits above the 7 saved regs
+    ldr     r12, =\table
+    mov     lr, r9
+    mov     r8, r0
+1:
+    ldr     r4, [r3], #4            @ PM for these 8 pixels
+    ldrb    r5, [r1]
+    cmp     r4, #0
+    bne     9f                      @ PM here - let the C code draw this one
+    add     r1, r1, #1
+    movs    r4, r5, lsl #\sh        @ byte offset scaled for the table
+    beq     2f
+    and     r5, r4, #\m0
+    and     r6, r4, #\m1
+    ldrh    r5, [r12, r5]
+    and     r7, r4, #\m2
+    ldrh    r6, [r12, r6]
+    .if \hires
+    and     r4, r4, #\m3
+    mov     r4, r4, lsl #2          @ hires_norm((data & 0x03) << 2)
+    .else
+    and     r4, r4, #\m3
+    .endif
+    ldrh    r7, [r12, r7]
+    ldrh    r4, [r12, r4]
+    orr     r5, r5, r6, lsl #16
+    orr     r6, r7, r4, lsl #16
+    stmia   r2!, {r5, r6}
+    subs    r0, r0, #1
+    bne     1b
+    b       9f
+2:
+    stmia   r2!, {r9, lr}           @ blank byte - background in both words
+    subs    r0, r0, #1
+    bne     1b
+9:
+    sub     r0, r8, r0
+    ldmfd   sp!, {r4-r9, pc}
+    .endm
+
+    .global antic_span_e
+    .type   antic_span_e, %function
+antic_span_e:
+    ANTIC_SPAN lookup2, 1, 0x180, 0x060, 0x018, 0x006, 0
+    .size   antic_span_e, .-antic_span_e
+
+    .global antic_span_f
+    .type   antic_span_f, %function
+antic_span_f:
+    ANTIC_SPAN hires_lookup_n, 0, 0xc0, 0x30, 0x0c, 0x03, 1
+    .size   antic_span_f, .-antic_span_f
+
+    .ltorg
+
+    .endif
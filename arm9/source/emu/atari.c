@@ -68,6 +68,9 @@
 #include "util.h"
 #include "cartridge.h"
 #include "pokeysnd.h"
+#include "pokey.h"
+#include "loadsave.h"
+#include "benchdev.h"
 
 char disk_filename[DISK_MAX][256];
 int  disk_readonly[DISK_MAX] = {true,true,true};
@@ -248,10 +251,54 @@ int Atari800_Exit(int run_monitor)
 
 void Atari800_Frame() 
 {
+    int draw;
     INPUT_Frame();
     GTIA_Frame();
-    ANTIC_Frame(myConfig.skip_frames ? (gTotalAtariFrames & (myConfig.skip_frames==1 ? 0x07:0x03)) : TRUE);  // Skip every 8th frame... or every 4th frame if we are "aggressive"
+    if (bFastForward)
+    {
+        draw = ((gTotalAtariFrames & FAST_FORWARD_DRAW_MASK) == 0);  // Fast Forward - emulate everything but only draw 1 in every 8 frames
+    }
+    else if (pokey_decimate == 0)
+    {
+        draw = TRUE;    // Hidden Run-Ahead frame - see Atari800_FrameRunAhead()
+    }
+    else
+    {
+        draw = (myConfig.skip_frames ? (gTotalAtariFrames & (myConfig.skip_frames==1 ? 0x07:0x03)) : TRUE);  // Skip every 8th frame... or every 4th frame if we are "aggressive"
+    }
+    ANTIC_Frame(draw);
     POKEY_Frame();
     
     gTotalAtariFrames++;
+    if (pokey_decimate)     // Run-Ahead frames are rolled back (as is ANTIC_CPU_CLOCK) so only the real ones are counted
+    {
+        bench_frames++;
+        if (!draw) bench_frames_skipped++;
+    }
+}
+
+// ---------------------------------------------------------------------------------------
+// Run-Ahead: run the real frame, snapshot the machine, then run 'frames_ahead' more
+// frames with the same input and sound off. The last of those is what ends up on screen
+// and then we roll back to the snapshot so the next real frame carries on as normal.
+// The net effect is that the player sees the result of their input one (or more) frames
+// sooner. Collisions are only evaluated while drawing, and the last hidden frame is
+// what is shown, so the hidden frames are always drawn even with frameskip on (the
+// real frame still skips as normal - whatever it draws is drawn over anyway).
+// ---------------------------------------------------------------------------------------
+void Atari800_FrameRunAhead(UBYTE frames_ahead)
+{
+    Atari800_Frame();
+
+    if (SaveStateToRAM())
+    {
+        UBYTE saved_decimate = pokey_decimate;
+        pokey_decimate = 0;
+        for (UBYTE i=0; i<frames_ahead; i++)
+        {
+            Atari800_Frame();
+        }
+        pokey_decimate = saved_decimate;
+        LoadStateFromRAM();
+    }
 }
@@ -90,6 +90,21 @@ extern int disk_readonly[DISK_MAX];
 
 /* Fundamental declarations ---------------------------------------------- */
 
+// ---------------------------------------------------------------------------------
+// Machine state: there is exactly one emulated machine and its state is the set of
+// file-scope globals in cpu.c, antic.c, gtia.c, pokey.c, pokeysnd.c, pia.c, sio.c,
+// memory.c and cartridge.c - the hot parts pinned to DTCM and a few large buffers
+// placed at fixed VRAM addresses (under_atarixl_os, cart_shadow, grafp_lookup and
+// atari_os_pristine). That single static instance is deliberate - every access is
+// a direct load from a known address and nothing has to carry a context pointer.
+// The Run-Ahead snapshot in loadsave.c is the list of what makes up a running
+// machine - the fixed snap_regions[] table plus the buffers SaveStateToRAM() copies
+// on the side: under_atarixl_os, the 130XE banks and the Telelink II NVRAM or
+// Corina 1MB EEPROM inside cart_image[]. It does not cover XE banks past 128K or
+// the Corina SRAM (Run-Ahead is off for those), the cart ROM, the disk images or
+// the sound output. Anything added to the core must be added there too.
+// ---------------------------------------------------------------------------------
+
 #ifndef FALSE
 #define FALSE  0
 #endif
@@ -186,6 +201,9 @@ struct AFILE_ATR_Header {
 #define MAGIC2  0x02
 
 extern unsigned short gTotalAtariFrames;
+extern u8 bFastForward;
+
+#define FAST_FORWARD_DRAW_MASK  0x07    // While Fast Forward is held, only every 8th frame is rendered
 
 extern UBYTE file_type;
 
@@ -195,6 +213,9 @@ int Atari800_Initialise(void);
 /* Emulates one frame (1/50sec for PAL, 1/60sec for NTSC). */
 void Atari800_Frame(void);
 
+/* Emulates one frame and then 'frames_ahead' more which are shown but rolled back. */
+void Atari800_FrameRunAhead(UBYTE frames_ahead);
+
 #define Atari800_Coldstart Coldstart
 #define Atari800_Warmstart Warmstart
 
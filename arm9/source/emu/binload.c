@@ -50,6 +50,8 @@
 
 #include <nds.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "atari.h"
 #include "a8ds.h"
 #include "binload.h"
@@ -57,12 +59,40 @@
 #include "esc.h"
 #include "memory.h"
 #include "sio.h"
+#include "util.h"
 
 int BINLOAD_start_binloading = FALSE;
 int BINLOAD_loading_basic = 0;
 int BINLOAD_slow_xex_loading = FALSE;
 FILE *BINLOAD_bin_file = NULL;
 
+// ---------------------------------------------------------------------------------
+// The XEX is read into memory in one go and the segment table is worked out (and
+// checked) before we ever reboot the machine. The loader then just walks the table
+// and copies each segment in a page at a time rather than fread()ing 2 bytes here
+// and 1 byte there off the SD card while the emulated OS waits on us. If the file
+// is too big for that (or we can't get the memory) we fall back to streaming it off
+// the SD card as it loads like the original Atari800 loader did.
+// ---------------------------------------------------------------------------------
+#define XEX_MAX_SIZE    (1024 * 1024)   // Far bigger than anything that will fit in an Atari... but some multi-load XEX files are a few hundred K
+
+typedef struct
+{
+    UWORD from;         // First address of the segment
+    UWORD to;           // Last address of the segment (inclusive - as stored in the XEX header)
+    ULONG offset;       // Where the segment data starts in xex_image[]
+    ULONG len;          // Bytes of data actually present - only less than to-from+1 for a truncated last segment
+} XexSegment_t;
+
+UBYTE *BINLOAD_xex_image = NULL;
+static ULONG xex_size = 0;
+static XexSegment_t *xex_segments = NULL;
+static int xex_num_segments = 0;
+static int xex_segment = 0;     // Next segment to be loaded
+static ULONG xex_pos = 0;       // Next byte to be loaded from xex_image[]
+static ULONG xex_seg_end = 0;   // End of the data for the segment being loaded
+static int xex_streaming = FALSE;   // No xex_image[] - segments are read from BINLOAD_bin_file as we go
+
 /* These variables are for slow XEX loading only. */
 
 /* Number of CPU instructions elapsed since last loaded byte. */
@@ -77,27 +107,137 @@ static int init2e3 = FALSE;
 static int segfinished = TRUE;
 int BINLOAD_pause_loading;
 
-/* Read a word from file */
-static int read_word(void)
+static void xex_free(void)
 {
-    UBYTE buf[2];
-    if (fread(buf, 1, 2, BINLOAD_bin_file) != 2) {
+    if (BINLOAD_xex_image) free(BINLOAD_xex_image);
+    if (xex_segments) free(xex_segments);
+    BINLOAD_xex_image = NULL;
+    xex_segments = NULL;
+    xex_num_segments = 0;
+}
+
+// ---------------------------------------------------------------------------------
+// Walk the XEX segment headers. With segs == NULL this just counts them. Returns the
+// number of segments or -1 if the file is malformed. A partial header at the very end
+// is ignored and a truncated last segment is loaded as far as it goes - both are
+// common in the wild and the old byte-at-a-time loader was happy with them.
+// ---------------------------------------------------------------------------------
+static int xex_parse(XexSegment_t *segs)
+{
+    const UBYTE *img = BINLOAD_xex_image;
+    ULONG pos = 0;
+    int count = 0;
+
+    if (xex_size < 2 || img[0] != 0xff || img[1] != 0xff) return -1;
+
+    while (pos + 4 <= xex_size)
+    {
+        UWORD start = img[pos] | (img[pos+1] << 8);
+        if (start == 0xffff) {pos += 2; continue;}     // Segment headers may be (re)introduced by $FFFF at any point
+        UWORD end = img[pos+2] | (img[pos+3] << 8);
+        pos += 4;
+
+        if (end < start) return -1;                     // Not an XEX we can make sense of - don't boot it
+
+        ULONG len = (ULONG)(end - start) + 1;
+        if (pos + len > xex_size) len = xex_size - pos;
+
+        if (segs)
+        {
+            segs[count].from = start;
+            segs[count].to = end;
+            segs[count].offset = pos;
+            segs[count].len = len;
+        }
+        count++;
+        pos += len;
+    }
+
+    return (count > 0) ? count : -1;
+}
+
+// ---------------------------------------------------------------------------------
+// Copy a block into Atari memory. Plain RAM pages take a single memcpy() via the
+// page_wr[] descriptors - anything else (ROM, hardware registers, bank hotspots) goes
+// through PutByte() one byte at a time exactly as if the loader had written it.
+// ---------------------------------------------------------------------------------
+static void xex_write_block(UWORD addr, const UBYTE *src, ULONG len)
+{
+    while (len)
+    {
+        ULONG n = 0x100 - (addr & 0xff);
+        if (n > len) n = len;
+
+        UBYTE *page = page_wr[addr >> 8];
+        if (page)
+        {
+            memcpy(page + addr, src, n);
+        }
+        else
+        {
+            for (ULONG i = 0; i < n; i++) PutByte((UWORD)(addr + i), src[i]);
+        }
+        addr = (UWORD)(addr + n);
+        src += n;
+        len -= n;
+    }
+}
+
+// Loading is over (one way or another) - let go of the image or the streamed file
+static void xex_done(void)
+{
+    xex_free();
+    if (xex_streaming) {
         fclose(BINLOAD_bin_file);
         BINLOAD_bin_file = NULL;
-        if (BINLOAD_start_binloading) {
-            BINLOAD_start_binloading = FALSE;
-            return -1;
-        }
-        CPU_regPC = dGetWord(0x2e0);
+        xex_streaming = FALSE;
+    }
+}
+
+// Streaming only: read the next little endian word or -1 at the end of the file
+static int xex_read_word(void)
+{
+    UBYTE buf[2];
+    if (fread(buf, 1, 2, BINLOAD_bin_file) != 2)
         return -1;
+    return buf[0] | (buf[1] << 8);
+}
+
+// Streaming only: read the next segment header into from/to. FALSE at the end of the file.
+static int xex_stream_header(void)
+{
+    int temp;
+    do
+        temp = xex_read_word();
+    while (temp == 0xffff);
+    if (temp < 0)
+        return FALSE;
+    from = (UWORD) temp;
+    temp = xex_read_word();
+    if (temp < 0)
+        return FALSE;
+    to = (UWORD) temp;
+    return TRUE;
+}
+
+// We've run off the end of the data in the middle of a segment - run what we have
+static void xex_truncated(void)
+{
+    xex_done();
+    CPU_regPC = dGetWord(0x2e0);
+    if (dGetByte(0x2e3) != 0xd7) {
+        /* run INIT routine which RTSes directly to RUN routine */
+        CPU_regPC--;
+        dPutByte(0x0100 + CPU_regS--, CPU_regPC >> 8);      /* high */
+        dPutByte(0x0100 + CPU_regS--, CPU_regPC & 0xff);    /* low */
+        CPU_regPC = dGetWord(0x2e2);
     }
-    return buf[0] + (buf[1] << 8);
 }
 
 /* Start or continue loading */
 static void loader_cont(void)
 {
-    if (BINLOAD_bin_file == NULL)
+    if (BINLOAD_xex_image == NULL && !xex_streaming)
         return;
     if (BINLOAD_start_binloading) {
         dPutByte(0x244, 0);
@@ -111,18 +251,30 @@ static void loader_cont(void)
     init2e3=FALSE;
     do {
         if((!BINLOAD_wait_active || !BINLOAD_slow_xex_loading) && segfinished){
-            int temp;
-            do
-                temp = read_word();
-            while (temp == 0xffff);
-            if (temp < 0)
-                return;
-            from = (UWORD) temp;
-
-            temp = read_word();
-            if (temp < 0)
-                return;
-            to = (UWORD) temp;
+            if (xex_streaming) {
+                if (!xex_stream_header()) {
+                    /* end of file - off to RUNAD (unless there was nothing to load at all) */
+                    xex_done();
+                    if (BINLOAD_start_binloading)
+                        BINLOAD_start_binloading = FALSE;
+                    else
+                        CPU_regPC = dGetWord(0x2e0);
+                    return;
+                }
+            }
+            else {
+                if (xex_segment >= xex_num_segments) {
+                    /* all segments loaded - off to RUNAD */
+                    xex_free();
+                    CPU_regPC = dGetWord(0x2e0);
+                    return;
+                }
+                from = xex_segments[xex_segment].from;
+                to = xex_segments[xex_segment].to;
+                xex_pos = xex_segments[xex_segment].offset;
+                xex_seg_end = xex_pos + xex_segments[xex_segment].len;
+                xex_segment++;
+            }
 
             if (BINLOAD_start_binloading) {
                 dPutWord(0x2e0, from);
@@ -131,9 +283,8 @@ static void loader_cont(void)
             to++;
             segfinished = FALSE;
         }
-        do {
-            int byte;
-            if (BINLOAD_slow_xex_loading) {
+        if (BINLOAD_slow_xex_loading) {
+            do {
                 instr_elapsed++;
                 if ((instr_elapsed < 300) || BINLOAD_pause_loading) {
                     CPU_regS--;
@@ -145,24 +296,51 @@ static void loader_cont(void)
                 }
                 instr_elapsed = 0;
                 BINLOAD_wait_active = FALSE;
-            }
-            byte = fgetc(BINLOAD_bin_file);
-            if (byte == EOF) {
-                fclose(BINLOAD_bin_file);
-                BINLOAD_bin_file = NULL;
-                CPU_regPC = dGetWord(0x2e0);
-                if (dGetByte(0x2e3) != 0xd7) {
-                    /* run INIT routine which RTSes directly to RUN routine */
-                    CPU_regPC--;
-                    dPutByte(0x0100 + CPU_regS--, CPU_regPC >> 8);      /* high */
-                    dPutByte(0x0100 + CPU_regS--, CPU_regPC & 0xff);    /* low */
-                    CPU_regPC = dGetWord(0x2e2);
+                if (xex_streaming) {
+                    int byte = fgetc(BINLOAD_bin_file);
+                    if (byte == EOF) {
+                        xex_truncated();
+                        return;
+                    }
+                    PutByte(from, (UBYTE) byte);
+                }
+                else {
+                    if (xex_pos >= xex_seg_end) {
+                        xex_truncated();
+                        return;
+                    }
+                    PutByte(from, BINLOAD_xex_image[xex_pos++]);
                 }
+                from++;
+            } while (from != to);
+        }
+        else if (xex_streaming) {
+            /* a page at a time straight off the file */
+            UBYTE page[256];
+            do {
+                ULONG want = (UWORD)(to - from) ? (UWORD)(to - from) : 0x10000;
+                if (want > sizeof(page)) want = sizeof(page);
+                ULONG have = fread(page, 1, want, BINLOAD_bin_file);
+                xex_write_block(from, page, have);
+                if (have < want) {
+                    xex_truncated();
+                    return;
+                }
+                from = (UWORD)(from + want);
+            } while (from != to);
+        }
+        else {
+            /* the whole segment in one burst - to-from wraps to 0 for a full 64K segment */
+            ULONG want = (UWORD)(to - from) ? (UWORD)(to - from) : 0x10000;
+            ULONG have = xex_seg_end - xex_pos;
+            xex_write_block(from, &BINLOAD_xex_image[xex_pos], (have < want) ? have : want);
+            if (have < want) {
+                xex_truncated();
                 return;
             }
-            PutByte(from, (UBYTE) byte);
-            from++;
-        } while (from != to);
+            xex_pos += want;
+            from = to;
+        }
         segfinished = TRUE;
     } while (dGetByte(0x2e3) == 0xd7);
 
@@ -194,6 +372,7 @@ int BINLOAD_LoaderStart(UBYTE *buffer)
     BINLOAD_wait_active = FALSE;
     init2e3 = TRUE;
     segfinished = TRUE;
+    xex_segment = 0;
     return 'C';
 }
 
@@ -206,6 +385,8 @@ int BINLOAD_Loader(const char *filename)
         BINLOAD_bin_file = NULL;
         BINLOAD_loading_basic = 0;
     }
+    xex_free();
+    xex_streaming = FALSE;
     BINLOAD_bin_file = fopen(filename, "rb");
     if (BINLOAD_bin_file == NULL) { /* open */
         return FALSE;
@@ -215,9 +396,37 @@ int BINLOAD_Loader(const char *filename)
         SIO_DisableDrive(1);
     if (fread(buf, 1, 2, BINLOAD_bin_file) == 2) {
         if (buf[0] == 0xff && buf[1] == 0xff) {
-            BINLOAD_start_binloading = TRUE; /* force SIO to call BINLOAD_LoaderStart at boot */
-            Atari800_Coldstart();             /* reboot */
-            return TRUE;
+            /* Read the whole XEX and check the segments before we commit to rebooting into it */
+            xex_size = Util_flen(BINLOAD_bin_file);
+            fseek(BINLOAD_bin_file, 0, SEEK_SET);
+            if (xex_size <= XEX_MAX_SIZE && (BINLOAD_xex_image = malloc(xex_size)) != NULL) {
+                if (fread(BINLOAD_xex_image, 1, xex_size, BINLOAD_bin_file) == xex_size) {
+                    xex_num_segments = xex_parse(NULL);
+                    if (xex_num_segments > 0 && (xex_segments = malloc(xex_num_segments * sizeof(XexSegment_t))) != NULL) {
+                        xex_parse(xex_segments);
+                        fclose(BINLOAD_bin_file);
+                        BINLOAD_bin_file = NULL;
+                        xex_segment = 0;
+                        BINLOAD_start_binloading = TRUE; /* force SIO to call BINLOAD_LoaderStart at boot */
+                        Atari800_Coldstart();             /* reboot */
+                        return TRUE;
+                    }
+                    if (xex_num_segments <= 0) {
+                        xex_free();     /* malformed - don't reboot into it */
+                        fclose(BINLOAD_bin_file);
+                        BINLOAD_bin_file = NULL;
+                        return FALSE;
+                    }
+                }
+            }
+            /* too big to hold in memory (or the read failed) - stream it instead */
+            xex_free();
+            if (fseek(BINLOAD_bin_file, 2, SEEK_SET) == 0) {
+                xex_streaming = TRUE;
+                BINLOAD_start_binloading = TRUE;
+                Atari800_Coldstart();
+                return TRUE;
+            }
         }
         else if (buf[0] == 0 && buf[1] == 0) {
             BINLOAD_loading_basic = BINLOAD_LOADING_BASIC_SAVED;
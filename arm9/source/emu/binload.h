@@ -54,6 +54,9 @@
 #include "atari.h" /* UBYTE */
 
 extern FILE *BINLOAD_bin_file;
+extern UBYTE *BINLOAD_xex_image;    /* The XEX being loaded - NULL once the last segment is in */
+
+#define BINLOAD_ACTIVE()    ((BINLOAD_bin_file != NULL) || (BINLOAD_xex_image != NULL))
 
 int BINLOAD_Loader(const char *filename);
 extern int BINLOAD_start_binloading;
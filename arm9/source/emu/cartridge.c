@@ -65,10 +65,11 @@ char *strcasestr(const char *haystack, const char *needle);
 #include "rtime.h"
 #include "esc.h"
 #include "altirra_basic.h"
+#include "membudget.h"
 
 extern UBYTE ROM_basic[];
 
-UBYTE cart_image[CART_MAX_SIZE];    // Big enough to hold the largest carts we support ... 1MB
+UBYTE *cart_image = NULL;           // Sized to the cart at insert time - see CART_AllocImage()
 UBYTE cart_header[16];
 
 int bank            __attribute__((section(".dtcm"))) = 0;
@@ -76,193 +77,179 @@ UBYTE cart_sic_data __attribute__((section(".dtcm"))) = 0x00;
 UWORD last_bb1_bank __attribute__((section(".dtcm"))) = 1;
 UWORD last_bb2_bank __attribute__((section(".dtcm"))) = 5;
 
-UBYTE *cart_shadow = (UBYTE *)0x06880000; // Mostly for BBSB for copy of memory
-
-/* DB_32, XEGS_32, XEGS_64, XEGS_128, XEGS_256, XEGS_512, XEGS_1024 */
-/* SWXEGS_32, SWXEGS_64, SWXEGS_128, SWXEGS_256, SWXEGS_512, SWXEGS_1024 */
-static void set_bank_809F(int b, int main)
+UBYTE *cart_shadow = (UBYTE *)VRAM_CART_SHADOW; // Mostly for BBSB for copy of memory
+
+// -----------------------------------------------------------------------------
+// Table driven bank switching. Most banked carts are nothing more than "pick a
+// bank number out of the $D5xx address (or the byte written there), maybe turn
+// a window off with one of the bits". Those are described by a CartMapper_t and
+// at CART_Start() we expand the descriptor into cart_map[] - one entry for each
+// of the 256 possible select values holding the final mem_map[] pointers. A
+// bank switch is then one table load and a couple of pointer stores. Carts with
+// oddball behavior (OSS, SDX 128, SIC+, DCART, Corina, Bounty Bob, etc.) are
+// still handled by their own set_bank_xxx() routine further below.
+// -----------------------------------------------------------------------------
+#define CART_MAP_ACCESS     0x01    // Selected by the low byte of the address on any read or write
+#define CART_MAP_WRITE      0x02    // Selected by the byte written
+#define CART_MAP_LATCH      0x04    // The select byte can be read back (SIC!)
+
+#define CART_WIN_A0BF       0       // 8K bank at A000-BFFF
+#define CART_WIN_809F       1       // 8K bank at 8000-9FFF with the last 8K bank fixed at A000-BFFF
+#define CART_WIN_80BF       2       // 16K bank at 8000-BFFF
+
+typedef struct
 {
-    if (b != bank)
-    {
-        if (b & 0x80)
-        {
-            Cart809F_Disable();
-            CartA0BF_Disable();
-        }
-        else
-        {
-            Cart809F_Enable();
-            CartA0BF_Enable();
-            mem_map[0x8] = (cart_image + b*0x2000) + 0x0000 - 0x8000;
-            mem_map[0x9] = (cart_image + b*0x2000) + 0x1000 - 0x9000;
-
-            if (bank & 0x80)
-            {
-                mem_map[0xA] = (cart_image + main) + 0x0000 - 0xA000;
-                mem_map[0xB] = (cart_image + main) + 0x1000 - 0xB000;
-            }
-        }
-        bank = b;
-    }
-}
-
-/* OSS_16, OSS_16 */
-static void set_bank_A0AF(int b, int main)
+    UBYTE type;         // CART_xxx this descriptor is for
+    UBYTE trigger;      // CART_MAP_xxx
+    UBYTE addr_mask;    // Only $D5xx addresses with (addr & addr_mask) == addr_match do anything
+    UBYTE addr_match;
+    UBYTE shift;        // Bank is ((sel >> shift) & bank_mask) ^ bank_xor
+    UBYTE bank_mask;
+    UBYTE bank_xor;
+    UBYTE off_809F;     // Any of these bits set turns off 8000-9FFF
+    UBYTE on_809F;      // If non-zero, one of these bits must be set for 8000-9FFF to be on
+    UBYTE off_A0BF;     // Any of these bits set turns off A000-BFFF
+    UBYTE limit;        // Select values at or above this are ignored (0 = no limit)
+    UBYTE window;       // CART_WIN_xxx
+} CartMapper_t;
+
+static const CartMapper_t cart_mappers[] =
 {
-    if (b != bank)
-    {
-        if (b < 0)
-            CartA0BF_Disable();
-        else
-        {
-            CartA0BF_Enable();
-            mem_map[0xA] = (cart_image + b*0x1000) - 0xA000;
-            if (bank < 0)
-            {
-                mem_map[0xB] = (cart_image + main) - 0xB000;
-            }
-        }
-        bank = b;
-    }
-}
-
-/* EXP_64, DIAMOND_64, SDX_64, MIO_8, etc. */
-static void set_bank_A0BF(int b)
+    // type                 trigger                         addr mask/match  shift  mask  xor  809F off/on  A0BF off  limit  window
+    {CART_DB_32,            CART_MAP_ACCESS,                0x00, 0x00,      0,     0x03, 0,   0x00, 0x00,  0x00,     0x00,  CART_WIN_809F},
+    {CART_XEGS_32,          CART_MAP_WRITE,                 0x00, 0x00,      0,     0x03, 0,   0x00, 0x00,  0x00,     0x00,  CART_WIN_809F},
+    {CART_XEGS_64,          CART_MAP_WRITE,                 0x00, 0x00,      0,     0x07, 0,   0x00, 0x00,  0x00,     0x00,  CART_WIN_809F},
+    {CART_XEGS_128,         CART_MAP_WRITE,                 0x00, 0x00,      0,     0x0f, 0,   0x00, 0x00,  0x00,     0x00,  CART_WIN_809F},
+    {CART_XEGS_256,         CART_MAP_WRITE,                 0x00, 0x00,      0,     0x1f, 0,   0x00, 0x00,  0x00,     0x00,  CART_WIN_809F},
+    {CART_XEGS_512,         CART_MAP_WRITE,                 0x00, 0x00,      0,     0x3f, 0,   0x00, 0x00,  0x00,     0x00,  CART_WIN_809F},
+    {CART_XEGS_1024,        CART_MAP_WRITE,                 0x00, 0x00,      0,     0x7f, 0,   0x00, 0x00,  0x00,     0x00,  CART_WIN_809F},
+    {CART_SWXEGS_32,        CART_MAP_WRITE,                 0x00, 0x00,      0,     0x03, 0,   0x80, 0x00,  0x80,     0x00,  CART_WIN_809F},
+    {CART_SWXEGS_64,        CART_MAP_WRITE,                 0x00, 0x00,      0,     0x07, 0,   0x80, 0x00,  0x80,     0x00,  CART_WIN_809F},
+    {CART_SWXEGS_128,       CART_MAP_WRITE,                 0x00, 0x00,      0,     0x0f, 0,   0x80, 0x00,  0x80,     0x00,  CART_WIN_809F},
+    {CART_SWXEGS_256,       CART_MAP_WRITE,                 0x00, 0x00,      0,     0x1f, 0,   0x80, 0x00,  0x80,     0x00,  CART_WIN_809F},
+    {CART_SWXEGS_512,       CART_MAP_WRITE,                 0x00, 0x00,      0,     0x3f, 0,   0x80, 0x00,  0x80,     0x00,  CART_WIN_809F},
+    {CART_SWXEGS_1024,      CART_MAP_WRITE,                 0x00, 0x00,      0,     0x7f, 0,   0x80, 0x00,  0x80,     0x00,  CART_WIN_809F},
+    {CART_MEGA_16,          CART_MAP_WRITE,                 0x00, 0x00,      0,     0x00, 0,   0x80, 0x00,  0x80,     0x00,  CART_WIN_80BF},
+    {CART_MEGA_32,          CART_MAP_WRITE,                 0x00, 0x00,      0,     0x01, 0,   0x80, 0x00,  0x80,     0x00,  CART_WIN_80BF},
+    {CART_MEGA_64,          CART_MAP_WRITE,                 0x00, 0x00,      0,     0x03, 0,   0x80, 0x00,  0x80,     0x00,  CART_WIN_80BF},
+    {CART_MEGA_128,         CART_MAP_WRITE,                 0x00, 0x00,      0,     0x07, 0,   0x80, 0x00,  0x80,     0x00,  CART_WIN_80BF},
+    {CART_MEGA_256,         CART_MAP_WRITE,                 0x00, 0x00,      0,     0x0f, 0,   0x80, 0x00,  0x80,     0x00,  CART_WIN_80BF},
+    {CART_MEGA_512,         CART_MAP_WRITE,                 0x00, 0x00,      0,     0x1f, 0,   0x80, 0x00,  0x80,     0x00,  CART_WIN_80BF},
+    {CART_MEGA_1024,        CART_MAP_WRITE,                 0x00, 0x00,      0,     0x3f, 0,   0x80, 0x00,  0x80,     0x00,  CART_WIN_80BF},
+    {CART_SIC_128,          CART_MAP_WRITE|CART_MAP_LATCH,  0xe0, 0x00,      0,     0x07, 0,   0x00, 0x20,  0x40,     0x00,  CART_WIN_80BF},
+    {CART_SIC_256,          CART_MAP_WRITE|CART_MAP_LATCH,  0xe0, 0x00,      0,     0x0f, 0,   0x00, 0x20,  0x40,     0x00,  CART_WIN_80BF},
+    {CART_SIC_512,          CART_MAP_WRITE|CART_MAP_LATCH,  0xe0, 0x00,      0,     0x1f, 0,   0x00, 0x20,  0x40,     0x00,  CART_WIN_80BF},
+    {CART_ATRAX_128,        CART_MAP_WRITE,                 0x00, 0x00,      0,     0x0f, 0,   0x00, 0x00,  0x80,     0x00,  CART_WIN_A0BF},
+    {CART_JRC_64,           CART_MAP_WRITE,                 0x80, 0x00,      4,     0x07, 0,   0x00, 0x00,  0x80,     0x00,  CART_WIN_A0BF},
+    {CART_WILL_64,          CART_MAP_ACCESS,                0x00, 0x00,      0,     0x07, 0,   0x00, 0x00,  0x08,     0x00,  CART_WIN_A0BF},
+    {CART_WILL_32,          CART_MAP_ACCESS,                0x00, 0x00,      0,     0x03, 0,   0x00, 0x00,  0x08,     0x00,  CART_WIN_A0BF},
+    {CART_WILL_16,          CART_MAP_ACCESS,                0x00, 0x00,      0,     0x01, 0,   0x00, 0x00,  0x08,     0x00,  CART_WIN_A0BF},
+    {CART_EXP_64,           CART_MAP_ACCESS,                0xf0, 0x70,      0,     0x07, 7,   0x00, 0x00,  0x08,     0x00,  CART_WIN_A0BF},
+    {CART_DIAMOND_64,       CART_MAP_ACCESS,                0xf0, 0xd0,      0,     0x07, 7,   0x00, 0x00,  0x08,     0x00,  CART_WIN_A0BF},
+    {CART_SDX_64,           CART_MAP_ACCESS,                0xf0, 0xe0,      0,     0x07, 7,   0x00, 0x00,  0x08,     0x00,  CART_WIN_A0BF},
+    {CART_ATRAX_SDX_64,     CART_MAP_ACCESS,                0xf0, 0xe0,      0,     0x07, 7,   0x00, 0x00,  0x08,     0x00,  CART_WIN_A0BF},
+    {CART_MIO_8,            CART_MAP_ACCESS,                0xf0, 0xe0,      0,     0x07, 7,   0x00, 0x00,  0x08,     0x00,  CART_WIN_A0BF},
+    {CART_ATMAX_128,        CART_MAP_ACCESS,                0x00, 0x00,      0,     0x0f, 0,   0x00, 0x00,  0x10,     0x20,  CART_WIN_A0BF},
+    {CART_ATMAX_1024,       CART_MAP_ACCESS,                0x00, 0x00,      0,     0x7f, 0,   0x00, 0x00,  0x80,     0x00,  CART_WIN_A0BF},
+    {CART_ATMAX_NEW_1024,   CART_MAP_ACCESS,                0x00, 0x00,      0,     0x7f, 0,   0x00, 0x00,  0x80,     0x00,  CART_WIN_A0BF},
+    {CART_TURBOSOFT_64,     CART_MAP_ACCESS,                0x00, 0x00,      0,     0x07, 0,   0x00, 0x00,  0x10,     0x00,  CART_WIN_A0BF},
+    {CART_TURBOSOFT_128,    CART_MAP_ACCESS,                0x00, 0x00,      0,     0x0f, 0,   0x00, 0x00,  0x10,     0x00,  CART_WIN_A0BF},
+    {CART_JATARI_8,         CART_MAP_ACCESS,                0x00, 0x00,      0,     0x00, 0,   0x00, 0x00,  0x80,     0x00,  CART_WIN_A0BF},
+    {CART_JATARI_16,        CART_MAP_ACCESS,                0x00, 0x00,      0,     0x01, 0,   0x00, 0x00,  0x80,     0x00,  CART_WIN_A0BF},
+    {CART_JATARI_32,        CART_MAP_ACCESS,                0x00, 0x00,      0,     0x03, 0,   0x00, 0x00,  0x80,     0x00,  CART_WIN_A0BF},
+    {CART_JATARI_64,        CART_MAP_ACCESS,                0x00, 0x00,      0,     0x07, 0,   0x00, 0x00,  0x80,     0x00,  CART_WIN_A0BF},
+    {CART_JATARI_128,       CART_MAP_ACCESS,                0x00, 0x00,      0,     0x0f, 0,   0x00, 0x00,  0x80,     0x00,  CART_WIN_A0BF},
+    {CART_JATARI_256,       CART_MAP_ACCESS,                0x00, 0x00,      0,     0x1f, 0,   0x00, 0x00,  0x80,     0x00,  CART_WIN_A0BF},
+    {CART_JATARI_512,       CART_MAP_ACCESS,                0x00, 0x00,      0,     0x3f, 0,   0x00, 0x00,  0x80,     0x00,  CART_WIN_A0BF},
+    {CART_JATARI_1024,      CART_MAP_ACCESS,                0x00, 0x00,      0,     0x7f, 0,   0x00, 0x00,  0x80,     0x00,  CART_WIN_A0BF},
+};
+
+typedef struct
 {
-    if (b != bank)
+    UBYTE *lo;          // Pre-offset mem_map[] pointer for 8000-9FFF or NULL if the window is off
+    UBYTE *hi;          // Pre-offset mem_map[] pointer for A000-BFFF or NULL if the window is off
+    UBYTE  ignore;      // This select value doesn't change anything
+} CartMapEntry_t;
+
+static CartMapEntry_t cart_map[256];
+const CartMapper_t *cart_mapper __attribute__((section(".dtcm"))) = NULL;  // NULL if this cart isn't table driven
+UBYTE cart_map_lo               __attribute__((section(".dtcm"))) = 0;     // Non-zero if the mapper also drives 8000-9FFF
+
+// -------------------------------------------------------------------
+// Find the descriptor for the current cart type (if any) and expand
+// it into the 256 entry cart_map[]. Called once from CART_Start().
+// -------------------------------------------------------------------
+static void CART_BuildMap(void)
+{
+    cart_mapper = NULL;
+    for (int i = 0; i < (int)(sizeof(cart_mappers) / sizeof(cart_mappers[0])); i++)
     {
-        if (b & 0x0008)
-        {
-            CartA0BF_Disable();
-        }
-        else
-        {
-            CartA0BF_Enable();
-            mem_map[0xA] = (cart_image + (~b&7)*0x2000) + 0x0000 - 0xA000;
-            mem_map[0xB] = (cart_image + (~b&7)*0x2000) + 0x1000 - 0xB000;
-        }
-        bank = b;
+        if (cart_mappers[i].type == myConfig.cart_type) cart_mapper = &cart_mappers[i];
     }
-}
+    if (cart_mapper == NULL) return;
 
-/* CART_WILL_64, CART_WILL_32, CART_WILL_16 */
-static void set_bank_A0BF_WILLIAMS(int b, int mask)
-{
-    if (b != bank) {
-        if (b & 0x08)
-        {
-            CartA0BF_Disable();
-        }
-        else
-        {
-            CartA0BF_Enable();
-            mem_map[0xA] = (cart_image + (b&mask)*0x2000) + 0x0000 - 0xA000;
-            mem_map[0xB] = (cart_image + (b&mask)*0x2000) + 0x1000 - 0xB000;
-        }
-        bank = b;
-    }
-}
+    const CartMapper_t *m = cart_mapper;
+    cart_map_lo = (m->window != CART_WIN_A0BF);
 
-/* TURBOSOFT_64, TURBOSOFT_128 */
-static void set_bank_A0BF_TURBOSOFT(UBYTE b, UBYTE mask)
-{
-    if (b != bank)
+    for (int sel = 0; sel < 256; sel++)
     {
-        if (b & 0x10)
-        {
-            CartA0BF_Disable();
-        }
-        else
+        CartMapEntry_t *e = &cart_map[sel];
+        u32 b = ((sel >> m->shift) & m->bank_mask) ^ m->bank_xor;
+
+        switch (m->window)
         {
-            CartA0BF_Enable();
-            mem_map[0xA] = (cart_image + (b&mask)*0x2000) + 0x0000 - 0xA000;
-            mem_map[0xB] = (cart_image + (b&mask)*0x2000) + 0x1000 - 0xB000;
+        case CART_WIN_809F:
+            e->lo = cart_image + (b*0x2000) - 0x8000;
+            e->hi = cart_image + (m->bank_mask*0x2000) - 0xA000;
+            break;
+        case CART_WIN_80BF:
+            e->lo = cart_image + (b*0x4000) + 0x0000 - 0x8000;
+            e->hi = cart_image + (b*0x4000) + 0x2000 - 0xA000;
+            break;
+        default:
+            e->lo = NULL;
+            e->hi = cart_image + (b*0x2000) - 0xA000;
+            break;
         }
-        bank = b;
+
+        if ((sel & m->off_809F) || (m->on_809F && !(sel & m->on_809F))) e->lo = NULL;
+        if (sel & m->off_A0BF) e->hi = NULL;
+        e->ignore = (m->limit && (sel >= m->limit));
     }
 }
 
-
-/* CART_ATMAX_128 */
-static void set_bank_A0BF_ATMAX128(int b)
+// -------------------------------------------------------------------
+// Apply one select value from the table. The two 4K banks of a window
+// share the same pre-offset pointer so each window is two stores.
+// Windows already mapped to the right place are left alone.
+// -------------------------------------------------------------------
+ITCM_CODE static void CART_MapSelect(UBYTE sel)
 {
-    if (b != bank)
-    {
-        if (b >= 0x20)
-            return;
-        else if (b >= 0x10)
-        {
-            CartA0BF_Disable();
-        }
-        else {
-            CartA0BF_Enable();
-            mem_map[0xA] = (cart_image + b*0x2000) + 0x0000 - 0xA000;
-            mem_map[0xB] = (cart_image + b*0x2000) + 0x1000 - 0xB000;
-        }
-        bank = b;
-    }
-}
+    const CartMapEntry_t *e = &cart_map[sel];
 
+    if (e->ignore) return;
 
-/* CART_ATMAX_1024 */
-void set_bank_A0BF_ATMAX1024(int b)
-{
-    if (b != bank)
+    if (cart_map_lo)
     {
-        if (b & 0x80)
+        if (e->lo == NULL) Cart809F_Disable();
+        else if (!cart809F_enabled || (mem_map[0x8] != e->lo))
         {
-            CartA0BF_Disable();
-        }
-        else
-        {
-            CartA0BF_Enable();
-            mem_map[0xA] = (cart_image + b*0x2000) + 0x0000 - 0xA000;
-            mem_map[0xB] = (cart_image + b*0x2000) + 0x1000 - 0xB000;
+            Cart809F_Enable();
+            MEMORY_MapBank(0x8, e->lo);
+            MEMORY_MapBank(0x9, e->lo);
         }
-        bank = b;
     }
-}
 
-/* CART_JATARI_8 thru CART_JATARI_1024 */
-void set_bank_A0BF_JATARI(int b, int mask)
-{
-    if (b != bank)
+    if (e->hi == NULL) CartA0BF_Disable();
+    else if (!cartA0BF_enabled || (mem_map[0xA] != e->hi))
     {
-        if (b & 0x80)
-        {
-            CartA0BF_Disable();
-        }
-        else
-        {
-            CartA0BF_Enable();
-            mem_map[0xA] = (cart_image + (b&mask)*0x2000) + 0x0000 - 0xA000;
-            mem_map[0xB] = (cart_image + (b&mask)*0x2000) + 0x1000 - 0xB000;
-        }
-        bank = (b&mask);
+        CartA0BF_Enable();
+        MEMORY_MapBank(0xA, e->hi);
+        MEMORY_MapBank(0xB, e->hi);
     }
-}
 
-/* CART_MEGA_16 to CART_MEGA_1024 */
-static void set_bank_80BF(int b)
-{
-    if (b != bank)
-    {
-        if (b & 0x80)
-        {
-            Cart809F_Disable();
-            CartA0BF_Disable();
-        }
-        else
-        {
-            Cart809F_Enable();
-            CartA0BF_Enable();
-            mem_map[0x8] = (cart_image + b*0x4000) + 0x0000 - 0x8000;
-            mem_map[0x9] = (cart_image + b*0x4000) + 0x1000 - 0x9000;
-            mem_map[0xA] = (cart_image + b*0x4000) + 0x2000 - 0xA000;
-            mem_map[0xB] = (cart_image + b*0x4000) + 0x3000 - 0xB000;
-        }
-        bank = b;
-    }
+    if (cart_mapper->trigger & CART_MAP_LATCH) cart_sic_data = sel;
+    bank = sel;
 }
 
 /* CART_SDX_128 */
@@ -277,8 +264,8 @@ static void set_bank_SDX_128(UWORD addr)
         else
         {
             CartA0BF_Enable();
-            mem_map[0xA] = (cart_image + ((((addr & 7) + ((addr & 0x10) >> 1)) ^ 0xf)*0x2000)) + 0x0000 - 0xA000;
-            mem_map[0xB] = (cart_image + ((((addr & 7) + ((addr & 0x10) >> 1)) ^ 0xf)*0x2000)) + 0x1000 - 0xB000;
+            MEMORY_MapBank(0xA, (cart_image + ((((addr & 7) + ((addr & 0x10) >> 1)) ^ 0xf)*0x2000)) + 0x0000 - 0xA000);
+            MEMORY_MapBank(0xB, (cart_image + ((((addr & 7) + ((addr & 0x10) >> 1)) ^ 0xf)*0x2000)) + 0x1000 - 0xB000);
         }
         bank = addr;
     }
@@ -289,8 +276,8 @@ static void set_bank_blizzard32(UBYTE bank)
 {
     if (bank < 4)
     {
-        mem_map[0xA] = cart_image + (bank*0x2000) + 0x0000 - 0xA000;
-        mem_map[0xB] = cart_image + (bank*0x2000) + 0x1000 - 0xB000;
+        MEMORY_MapBank(0xA, cart_image + (bank*0x2000) + 0x0000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + (bank*0x2000) + 0x1000 - 0xB000);
     }
     else
     {
@@ -303,8 +290,8 @@ static void set_bank_ultracart(UBYTE bank)
 {
     if (bank < 4)
     {
-        mem_map[0xA] = cart_image + (bank*0x2000) + 0x0000 - 0xA000;
-        mem_map[0xB] = cart_image + (bank*0x2000) + 0x1000 - 0xB000;
+        MEMORY_MapBank(0xA, cart_image + (bank*0x2000) + 0x0000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + (bank*0x2000) + 0x1000 - 0xB000);
     }
     else if (bank == 4)
     {
@@ -313,42 +300,11 @@ static void set_bank_ultracart(UBYTE bank)
     else
     {
         bank = 0;
-        mem_map[0xA] = cart_image + (bank*0x2000) + 0x0000 - 0xA000;
-        mem_map[0xB] = cart_image + (bank*0x2000) + 0x1000 - 0xB000;
+        MEMORY_MapBank(0xA, cart_image + (bank*0x2000) + 0x0000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + (bank*0x2000) + 0x1000 - 0xB000);
     }
 }
 
-/* CART_SIC_128, CART_SIC_256, CART_SIC_512 */
-static void set_bank_SIC(UBYTE data, UBYTE bank_mask)
-{
-    UBYTE b = data & bank_mask;
-
-    if (!(data & 0x20))
-    {
-        Cart809F_Disable();
-    }
-    else
-    {
-        Cart809F_Enable();
-        mem_map[0x8] = cart_image + (b*0x4000) + 0x0000 - 0x8000;
-        mem_map[0x9] = cart_image + (b*0x4000) + 0x1000 - 0x9000;
-    }
-
-    if (data & 0x40)
-    {
-        CartA0BF_Disable();
-    }
-    else
-    {
-        CartA0BF_Enable();
-        mem_map[0xA] = cart_image + (b*0x4000) + 0x2000 - 0xA000;
-        mem_map[0xB] = cart_image + (b*0x4000) + 0x3000 - 0xB000;
-    }
-
-    cart_sic_data = data;
-    bank = b;
-}
-
 /* CART_SIC_PLUS */
 static void set_bank_SICPLUS(UBYTE data)
 {
@@ -361,8 +317,8 @@ static void set_bank_SICPLUS(UBYTE data)
     else
     {
         Cart809F_Enable();
-        mem_map[0x8] = cart_image + (b*0x4000) + 0x0000 - 0x8000;
-        mem_map[0x9] = cart_image + (b*0x4000) + 0x1000 - 0x9000;
+        MEMORY_MapBank(0x8, cart_image + (b*0x4000) + 0x0000 - 0x8000);
+        MEMORY_MapBank(0x9, cart_image + (b*0x4000) + 0x1000 - 0x9000);
     }
 
     if (data & 0x40)
@@ -372,8 +328,8 @@ static void set_bank_SICPLUS(UBYTE data)
     else
     {
         CartA0BF_Enable();
-        mem_map[0xA] = cart_image + (b*0x4000) + 0x2000 - 0xA000;
-        mem_map[0xB] = cart_image + (b*0x4000) + 0x3000 - 0xB000;
+        MEMORY_MapBank(0xA, cart_image + (b*0x4000) + 0x2000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + (b*0x4000) + 0x3000 - 0xB000);
     }
 
     cart_sic_data = data;
@@ -398,24 +354,8 @@ static void set_bank_A0BF_DCART(UBYTE b)
     else  // Enable 8K bank in the A000-BFFF memory range
     {
         CartA0BF_Enable();
-        mem_map[0xA] = cart_image + (bank*0x2000) + 0x0000 - 0xA000;
-        mem_map[0xB] = cart_image + (bank*0x2000) + 0x1000 - 0xB000;
-    }
-}
-
-/* CART_JRC_64 */
-static void set_bank_A0BF_JRC(UBYTE data)
-{
-    bank = (data >> 4) & 0x7; // Bank is selected by the 3 bits in D6...D4
-    if (data & 0x80)    // High bit disables cart
-    {
-        CartA0BF_Disable();
-    }
-    else  // Enable 8K bank in the A000-BFFF memory range
-    {
-        CartA0BF_Enable();
-        mem_map[0xA] = cart_image + (bank*0x2000) + 0x0000 - 0xA000;
-        mem_map[0xB] = cart_image + (bank*0x2000) + 0x1000 - 0xB000;
+        MEMORY_MapBank(0xA, cart_image + (bank*0x2000) + 0x0000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + (bank*0x2000) + 0x1000 - 0xB000);
     }
 }
 
@@ -431,8 +371,8 @@ static void set_bank_A0BF_JRCi(UBYTE data)
     else  // Enable 8K bank in the A000-BFFF memory range
     {
         CartA0BF_Enable();
-        mem_map[0xA] = cart_image + (jrc_interleave[bank]*0x2000) + 0x0000 - 0xA000;
-        mem_map[0xB] = cart_image + (jrc_interleave[bank]*0x2000) + 0x1000 - 0xB000;
+        MEMORY_MapBank(0xA, cart_image + (jrc_interleave[bank]*0x2000) + 0x0000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + (jrc_interleave[bank]*0x2000) + 0x1000 - 0xB000);
     }
 }
 
@@ -442,8 +382,8 @@ static void set_bank_ADAWLIAH(UBYTE b)
 {
     bank = b;
     CartA0BF_Enable();
-    mem_map[0xA] = cart_image + (bank*0x2000) + 0x0000 - 0xA000;
-    mem_map[0xB] = cart_image + (bank*0x2000) + 0x1000 - 0xB000;
+    MEMORY_MapBank(0xA, cart_image + (bank*0x2000) + 0x0000 - 0xA000);
+    MEMORY_MapBank(0xB, cart_image + (bank*0x2000) + 0x1000 - 0xB000);
 }
 
 static void set_bank_xe_multicart(UBYTE b)
@@ -454,17 +394,17 @@ static void set_bank_xe_multicart(UBYTE b)
     {
         Cart809F_Enable(); 
         CartA0BF_Enable();
-        mem_map[0x8] = cart_image + (bank*0x2000) - 0x2000 - 0x8000;
-        mem_map[0x9] = cart_image + (bank*0x2000) - 0x1000 - 0x9000;
-        mem_map[0xA] = cart_image + (bank*0x2000) + 0x0000 - 0xA000;
-        mem_map[0xB] = cart_image + (bank*0x2000) + 0x1000 - 0xB000;
+        MEMORY_MapBank(0x8, cart_image + (bank*0x2000) - 0x2000 - 0x8000);
+        MEMORY_MapBank(0x9, cart_image + (bank*0x2000) - 0x1000 - 0x9000);
+        MEMORY_MapBank(0xA, cart_image + (bank*0x2000) + 0x0000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + (bank*0x2000) + 0x1000 - 0xB000);
     }
     else // 8K mapping
     {   
         Cart809F_Disable(); 
         CartA0BF_Enable();
-        mem_map[0xA] = cart_image + (bank*0x2000) + 0x0000 - 0xA000;
-        mem_map[0xB] = cart_image + (bank*0x2000) + 0x1000 - 0xB000;
+        MEMORY_MapBank(0xA, cart_image + (bank*0x2000) + 0x0000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + (bank*0x2000) + 0x1000 - 0xB000);
     }    
 }
 
@@ -474,10 +414,10 @@ static void set_bank_corina_1mb(UBYTE b)
     {
         Cart809F_Disable();
         CartA0BF_Disable();
-        mem_map[0x8] = memory;
-        mem_map[0x9] = memory;
-        mem_map[0xA] = memory;
-        mem_map[0xB] = memory;
+        MEMORY_MapBank(0x8, memory);
+        MEMORY_MapBank(0x9, memory);
+        MEMORY_MapBank(0xA, memory);
+        MEMORY_MapBank(0xB, memory);
     }
     else
     {
@@ -485,10 +425,10 @@ static void set_bank_corina_1mb(UBYTE b)
         {
             Cart809F_Disable();
             CartA0BF_Disable();
-            mem_map[0x8] = cart_image + (1024*1024) + 0x0000 - 0x8000;
-            mem_map[0x9] = cart_image + (1024*1024) + 0x1000 - 0x9000;
-            mem_map[0xA] = cart_image + (1024*1024) + 0x0000 - 0xA000;
-            mem_map[0xB] = cart_image + (1024*1024) + 0x1000 - 0xB000;
+            MEMORY_MapBank(0x8, cart_image + (1024*1024) + 0x0000 - 0x8000);
+            MEMORY_MapBank(0x9, cart_image + (1024*1024) + 0x1000 - 0x9000);
+            MEMORY_MapBank(0xA, cart_image + (1024*1024) + 0x0000 - 0xA000);
+            MEMORY_MapBank(0xB, cart_image + (1024*1024) + 0x1000 - 0xB000);
             SetRAM(0x8000, 0xbfff); // We treat the EE as RAM
         }
         else // ROM 1MB (banked in)
@@ -496,10 +436,10 @@ static void set_bank_corina_1mb(UBYTE b)
             Cart809F_Enable();
             CartA0BF_Enable();
             bank = b & 0x3f;
-            mem_map[0x8] = cart_image + (bank*0x4000) + 0x0000 - 0x8000;
-            mem_map[0x9] = cart_image + (bank*0x4000) + 0x1000 - 0x9000;
-            mem_map[0xA] = cart_image + (bank*0x4000) + 0x2000 - 0xA000;
-            mem_map[0xB] = cart_image + (bank*0x4000) + 0x3000 - 0xB000;
+            MEMORY_MapBank(0x8, cart_image + (bank*0x4000) + 0x0000 - 0x8000);
+            MEMORY_MapBank(0x9, cart_image + (bank*0x4000) + 0x1000 - 0x9000);
+            MEMORY_MapBank(0xA, cart_image + (bank*0x4000) + 0x2000 - 0xA000);
+            MEMORY_MapBank(0xB, cart_image + (bank*0x4000) + 0x3000 - 0xB000);
             SetROM(0x8000, 0xbfff);
         }
     }
@@ -511,10 +451,10 @@ static void set_bank_corina_sram(UBYTE b)
     {
         Cart809F_Disable();
         CartA0BF_Disable();
-        mem_map[0x8] = memory;
-        mem_map[0x9] = memory;
-        mem_map[0xA] = memory;
-        mem_map[0xB] = memory;
+        MEMORY_MapBank(0x8, memory);
+        MEMORY_MapBank(0x9, memory);
+        MEMORY_MapBank(0xA, memory);
+        MEMORY_MapBank(0xB, memory);
     }
     else
     {
@@ -525,10 +465,10 @@ static void set_bank_corina_sram(UBYTE b)
         {
             Cart809F_Disable();
             CartA0BF_Disable();
-            mem_map[0x8] = cart_image + (512*1024) + 0x0000 - 0x8000;
-            mem_map[0x9] = cart_image + (512*1024) + 0x1000 - 0x9000;
-            mem_map[0xA] = cart_image + (512*1024) + 0x0000 - 0xA000;
-            mem_map[0xB] = cart_image + (512*1024) + 0x1000 - 0xB000;
+            MEMORY_MapBank(0x8, cart_image + (512*1024) + 0x0000 - 0x8000);
+            MEMORY_MapBank(0x9, cart_image + (512*1024) + 0x1000 - 0x9000);
+            MEMORY_MapBank(0xA, cart_image + (512*1024) + 0x0000 - 0xA000);
+            MEMORY_MapBank(0xB, cart_image + (512*1024) + 0x1000 - 0xB000);
             SetRAM(0x8000, 0xbfff); // We treat the EE as RAM
         }
         else if (b & 0x20) // SRAM - we reuse the back-end empty Cart Image
@@ -536,10 +476,10 @@ static void set_bank_corina_sram(UBYTE b)
             Cart809F_Disable();
             CartA0BF_Disable();
             bank = b & 0x1f;
-            mem_map[0x8] = cart_image + (520*1024) + (bank*0x4000) + 0x0000 - 0x8000;
-            mem_map[0x9] = cart_image + (520*1024) + (bank*0x4000) + 0x1000 - 0x9000;
-            mem_map[0xA] = cart_image + (520*1024) + (bank*0x4000) + 0x2000 - 0xA000;
-            mem_map[0xB] = cart_image + (520*1024) + (bank*0x4000) + 0x3000 - 0xB000;
+            MEMORY_MapBank(0x8, cart_image + (520*1024) + (bank*0x4000) + 0x0000 - 0x8000);
+            MEMORY_MapBank(0x9, cart_image + (520*1024) + (bank*0x4000) + 0x1000 - 0x9000);
+            MEMORY_MapBank(0xA, cart_image + (520*1024) + (bank*0x4000) + 0x2000 - 0xA000);
+            MEMORY_MapBank(0xB, cart_image + (520*1024) + (bank*0x4000) + 0x3000 - 0xB000);
             SetRAM(0x8000, 0xbfff);
         }
         else // Normal ROM mapping area
@@ -547,10 +487,10 @@ static void set_bank_corina_sram(UBYTE b)
             Cart809F_Enable();
             CartA0BF_Enable();
             bank = b & 0x1f;
-            mem_map[0x8] = cart_image + (bank*0x4000) + 0x0000 - 0x8000;
-            mem_map[0x9] = cart_image + (bank*0x4000) + 0x1000 - 0x9000;
-            mem_map[0xA] = cart_image + (bank*0x4000) + 0x2000 - 0xA000;
-            mem_map[0xB] = cart_image + (bank*0x4000) + 0x3000 - 0xB000;
+            MEMORY_MapBank(0x8, cart_image + (bank*0x4000) + 0x0000 - 0x8000);
+            MEMORY_MapBank(0x9, cart_image + (bank*0x4000) + 0x1000 - 0x9000);
+            MEMORY_MapBank(0xA, cart_image + (bank*0x4000) + 0x2000 - 0xA000);
+            MEMORY_MapBank(0xB, cart_image + (bank*0x4000) + 0x3000 - 0xB000);
             SetROM(0x8000, 0xbfff);
         }
     }
@@ -625,14 +565,14 @@ void BountyBob2PutByte(UWORD addr, UBYTE value)
 
 void BryanBank(UBYTE b)
 {
-    mem_map[0x4] = cart_image + ((int)b*0x8000L) + 0x0000 - 0x4000;
-    mem_map[0x5] = cart_image + ((int)b*0x8000L) + 0x1000 - 0x5000;
-    mem_map[0x6] = cart_image + ((int)b*0x8000L) + 0x2000 - 0x6000;
-    mem_map[0x7] = cart_image + ((int)b*0x8000L) + 0x3000 - 0x7000;
-    mem_map[0x8] = cart_image + ((int)b*0x8000L) + 0x4000 - 0x8000;
-    mem_map[0x9] = cart_image + ((int)b*0x8000L) + 0x5000 - 0x9000;
-    mem_map[0xA] = cart_image + ((int)b*0x8000L) + 0x6000 - 0xA000;
-    mem_map[0xB] = cart_image + ((int)b*0x8000L) + 0x7000 - 0xB000;
+    MEMORY_MapBank(0x4, cart_image + ((int)b*0x8000L) + 0x0000 - 0x4000);
+    MEMORY_MapBank(0x5, cart_image + ((int)b*0x8000L) + 0x1000 - 0x5000);
+    MEMORY_MapBank(0x6, cart_image + ((int)b*0x8000L) + 0x2000 - 0x6000);
+    MEMORY_MapBank(0x7, cart_image + ((int)b*0x8000L) + 0x3000 - 0x7000);
+    MEMORY_MapBank(0x8, cart_image + ((int)b*0x8000L) + 0x4000 - 0x8000);
+    MEMORY_MapBank(0x9, cart_image + ((int)b*0x8000L) + 0x5000 - 0x9000);
+    MEMORY_MapBank(0xA, cart_image + ((int)b*0x8000L) + 0x6000 - 0xA000);
+    MEMORY_MapBank(0xB, cart_image + ((int)b*0x8000L) + 0x7000 - 0xB000);
 }
 
 UBYTE BryanGetByte64(UWORD addr)
@@ -807,6 +747,255 @@ u8 Guess5200CartType(const char *filename)
     return CART_5200_NS_16; // The more common 16K
 }
 
+// ---------------------------------------------------------------------
+// The cart_image[] is sized to the cart we are inserting rather than
+// always holding on to a full 1MB. Most carts are 8K-128K so this
+// leaves the rest of the heap for everything else. Some cart types
+// can bank beyond the end of a short file (or use space past the end
+// of the image as scratch/NVRAM) so we size to whatever the mapper can
+// reach. Anything past the end of the file reads back as 0xFF.
+// ---------------------------------------------------------------------
+ULONG cart_image_size = 0;
+
+static ULONG CART_ImageSize(int type, ULONG file_size)
+{
+    ULONG reach = 0;
+
+    for (int i = 0; i < (int)(sizeof(cart_mappers) / sizeof(cart_mappers[0])); i++)
+    {
+        if (cart_mappers[i].type == type)
+        {
+            reach = (cart_mappers[i].bank_mask + 1) * ((cart_mappers[i].window == CART_WIN_80BF) ? 0x4000 : 0x2000);
+        }
+    }
+
+    switch (type)
+    {
+    case CART_NONE:
+        if (file_size == 0) return 0;
+        break;
+    case CART_STD_16:       case CART_BLIZZARD_16:  case CART_TELELINK2:    case CART_5200_NS_16:   case CART_5200_EE_16:
+    case CART_OSS_16:       case CART_OSS_8:        case CART_OSS_16_034M:  case CART_OSS_16_043M:
+        reach = 16 * 1024;
+        break;
+    case CART_BLIZZARD_32:  case CART_ULTRACART:    case CART_ADAWLIAH32:   case CART_5200_32:
+        reach = 32 * 1024;
+        break;
+    case CART_BBSB_40:      case CART_5200_40:
+        reach = 40 * 1024;
+        break;
+    case CART_JRC_64i:      case CART_ADAWLIAH64:   case CART_5200_64:
+        reach = 64 * 1024;
+        break;
+    case CART_AST_32:
+        reach = 0x12000;                // The 256 byte window is replicated into the 8K past the 64K
+        break;
+    case CART_SDX_128:      case CART_5200_128:
+        reach = 128 * 1024;
+        break;
+    case CART_ATRAX_SDX_64:
+    case CART_ATRAX_SDX_128:
+        reach = (512 + 64) * 1024;      // UnscrambleAtrax() works in the space at 512K
+        break;
+    case CART_DCART:
+        reach = 512 * 1024;
+        break;
+    case CART_SIC_PLUS:
+    case CART_XE_MULTI_8:   case CART_XE_MULTI_16:  case CART_XE_MULTI_32:  case CART_XE_MULTI_64:
+    case CART_XE_MULTI_128: case CART_XE_MULTI_256: case CART_XE_MULTI_512: case CART_XE_MULTI_1024:
+        reach = 1024 * 1024;
+        break;
+    case CART_CORINA_1MB:
+    case CART_CORINA_SRAM:
+        reach = CART_MAX_SIZE;          // EEPROM and SRAM live past the ROM
+        break;
+    }
+
+    ULONG size = (file_size + 0x1FFF) & ~0x1FFF;   // Whole 8K chunks for the demand pager
+    if (size < reach) size = reach;
+    if (size < 0x2000) size = 0x2000;
+    if (size > CART_MAX_SIZE) size = CART_MAX_SIZE;
+    return size;
+}
+
+static void CART_FreeImage(void)
+{
+    free(cart_image);
+    cart_image = NULL;
+    cart_image_size = 0;
+}
+
+// Returns non-zero if we got the memory. The whole image starts out as 0xFF.
+static UBYTE CART_AllocImage(ULONG size)
+{
+    if (size != cart_image_size)
+    {
+        CART_FreeImage();
+        if (size == 0) return 1;
+        cart_image = (UBYTE *) malloc(size);
+        if (cart_image == NULL)
+        {
+            dsPrintValue(0,0,0, "NO MEMORY FOR CART");
+            return 0;
+        }
+        cart_image_size = size;
+    }
+    if (cart_image) memset(cart_image, 0xFF, cart_image_size);
+    return 1;
+}
+
+// ---------------------------------------------------------------------
+// Large bank-switched carts (over 128K) are demand paged into the
+// cart_image[] in 8K chunks. Reading a full 1MB cart off the SD card
+// is the bulk of the startup time and most games only touch a handful
+// of banks in the first few seconds. The remaining chunks are brought
+// in by CART_Prefetch() while the main loop waits for the next frame
+// so the SD card reads come out of idle time. A bank the game maps
+// before its chunk has arrived can't wait - MEMORY_MapBank() calls in
+// to CART_PageIn() which reads it there and then. Once every chunk is
+// resident the file is closed and the paging hook is switched off. A
+// failed read leaves the chunk out for the prefetch to try again; if
+// the card keeps failing we give up and say so.
+// Only mappers that reach the cart_image[] strictly through mem_map[]
+// are eligible - anything that memcpy()s from the image is loaded up
+// front as before.
+// ---------------------------------------------------------------------
+#define CART_CHUNK_SIZE     0x2000
+#define CART_CHUNKS         ((CART_MAX_SIZE + CART_CHUNK_SIZE - 1) / CART_CHUNK_SIZE)
+#define CART_LAZY_MIN_SIZE  (128 * 1024)
+#define CART_READ_RETRIES   8
+
+UBYTE cart_paging __attribute__((section(".dtcm"))) = 0;   // Non-zero while some chunks of the cart are still out on the SD card
+static FILE *cart_fp = NULL;
+static unsigned int cart_file_base = 0;
+static unsigned int cart_file_size = 0;
+static unsigned int cart_read_errors = 0;
+static unsigned int cart_chunks_left = 0;
+static unsigned int cart_prefetch_chunk = 0;
+static UBYTE cart_resident[(CART_CHUNKS + 7) / 8];
+
+static UBYTE CART_IsLazyType(int type)
+{
+    switch (type)
+    {
+        case CART_XEGS_256:     case CART_XEGS_512:     case CART_XEGS_1024:
+        case CART_SWXEGS_256:   case CART_SWXEGS_512:   case CART_SWXEGS_1024:
+        case CART_MEGA_256:     case CART_MEGA_512:     case CART_MEGA_1024:
+        case CART_XE_MULTI_256: case CART_XE_MULTI_512: case CART_XE_MULTI_1024:
+        case CART_JATARI_256:   case CART_JATARI_512:   case CART_JATARI_1024:
+        case CART_SIC_256:      case CART_SIC_512:
+        case CART_ATMAX_1024:   case CART_ATMAX_NEW_1024:
+            return 1;
+    }
+    return 0;
+}
+
+static void CART_CloseFile(void)
+{
+    if (cart_fp != NULL) fclose(cart_fp);
+    cart_fp = NULL;
+    cart_paging = 0;
+    cart_chunks_left = 0;
+}
+
+static void CART_LoadChunk(unsigned int chunk)
+{
+    if (cart_resident[chunk >> 3] & (1 << (chunk & 7))) return;
+
+    unsigned int offset = chunk * CART_CHUNK_SIZE;
+    unsigned int len = ((cart_file_size - offset) < CART_CHUNK_SIZE) ? (cart_file_size - offset) : CART_CHUNK_SIZE;
+    if ((fseek(cart_fp, cart_file_base + offset, SEEK_SET) != 0) || (fread(cart_image + offset, 1, len, cart_fp) != len))
+    {
+        if (++cart_read_errors >= CART_READ_RETRIES)
+        {
+            CART_CloseFile();   // Whatever is still out stays 0xFF
+            dsPrintValue(1,23,0, "CART READ ERROR - RELOAD GAME ");
+        }
+        return;
+    }
+    cart_resident[chunk >> 3] |= (1 << (chunk & 7));
+
+    if (--cart_chunks_left == 0) CART_CloseFile();
+}
+
+// Called from MEMORY_MapBank() with the real (un-offset) start of the 4K bank being mapped
+void CART_PageIn(const UBYTE *ptr)
+{
+    unsigned int offset = (unsigned int)(ptr - cart_image);
+    if (offset < cart_image_size) CART_LoadChunk(offset / CART_CHUNK_SIZE);
+}
+
+// Called while the emulation is idle - brings in the next chunk still out on the SD card
+void CART_Prefetch(void)
+{
+    for (unsigned int tries = 0; cart_paging && (tries < CART_CHUNKS); tries++)
+    {
+        unsigned int chunk = cart_prefetch_chunk;
+        cart_prefetch_chunk = (cart_prefetch_chunk + 1) % CART_CHUNKS;     // Wraps so a chunk that failed gets another go
+        if (!(cart_resident[chunk >> 3] & (1 << (chunk & 7))))
+        {
+            CART_LoadChunk(chunk);
+            break;
+        }
+    }
+}
+
+// Used before anything that needs the entire image (e.g. restoring a save state)
+void CART_LoadAll(void)
+{
+    for (unsigned int chunk = 0; cart_paging && (chunk < CART_CHUNKS); chunk++)
+    {
+        CART_LoadChunk(chunk);
+    }
+}
+
+// ---------------------------------------------------------------------
+// Read the cart image (starting 'base' bytes into the file) either all
+// at once or, for the large bank-switched types, just the first chunk
+// with the rest demand paged as above. Returns the image size.
+// ---------------------------------------------------------------------
+static int CART_ReadImage(FILE *fp, unsigned int base, int type)
+{
+    fseek(fp, 0, SEEK_END);
+    int size = ftell(fp) - base;
+    fseek(fp, base, SEEK_SET);
+    if (size < 0) size = 0;
+    if (size > CART_MAX_SIZE) size = CART_MAX_SIZE;
+
+    if (!CART_AllocImage(CART_ImageSize(type, size)))
+    {
+        fclose(fp);
+        myConfig.cart_type = CART_NONE;
+        return 0;
+    }
+
+    if ((size > CART_LAZY_MIN_SIZE) && CART_IsLazyType(type))
+    {
+        // Anything past the end of the file stays 0xFF and is considered resident
+        unsigned int file_chunks = (size + CART_CHUNK_SIZE - 1) / CART_CHUNK_SIZE;
+        memset(cart_resident, 0xFF, sizeof(cart_resident));
+        for (unsigned int chunk = 0; chunk < file_chunks; chunk++)
+        {
+            cart_resident[chunk >> 3] &= ~(1 << (chunk & 7));
+        }
+        cart_fp = fp;
+        cart_file_base = base;
+        cart_file_size = size;
+        cart_read_errors = 0;
+        cart_chunks_left = file_chunks;
+        cart_prefetch_chunk = 0;
+        cart_paging = 1;
+        CART_LoadChunk(0);  // Some mappers copy the first 8K into RAM on startup
+    }
+    else
+    {
+        fread(cart_image, 1, size, fp);
+        fclose(fp);
+    }
+
+    return size;
+}
+
 // ---------------------------------------------------------------------
 // We support both .CAR and .ROM files and instead of copying chunks
 // of memory around, we use the mem_map[] to point to various rom
@@ -816,7 +1005,8 @@ u8 Guess5200CartType(const char *filename)
 int cart_size = 0;
 int CART_Insert(int enabled, int file_type, const char *filename)
 {
-    memset(cart_image, 0xFF, sizeof(cart_image));   // Fill with 0xFF until we read in the cart
+    CART_CloseFile();
+    CART_FreeImage();   // Hand back the last cart before we size up the new one
     bank = 0;
 
     CART_Remove();
@@ -827,9 +1017,8 @@ int CART_Insert(int enabled, int file_type, const char *filename)
         if (fp != NULL)
         {
             fread(cart_header, 1, 16, fp);
-            fread(cart_image, 1, CART_MAX_SIZE, fp);
-            fclose(fp);
             myConfig.cart_type = cart_header[7];
+            cart_size = CART_ReadImage(fp, 16, myConfig.cart_type);
         }
     }
     else if (file_type == AFILE_ROM)
@@ -837,8 +1026,9 @@ int CART_Insert(int enabled, int file_type, const char *filename)
         FILE * fp = fopen(filename, "rb");
         if (fp != NULL)
         {
-            cart_size = fread(cart_image, 1, CART_MAX_SIZE, fp);
-            fclose(fp);
+            fseek(fp, 0, SEEK_END);
+            cart_size = ftell(fp);
+            if (cart_size > CART_MAX_SIZE) cart_size = CART_MAX_SIZE;
             int size = cart_size / 1024;
             // If configuration hasn't been set for a Cartridge Type, guess at the type based on ROM size
             if (myConfig.cart_type == CART_NONE)
@@ -855,6 +1045,7 @@ int CART_Insert(int enabled, int file_type, const char *filename)
                 if (size == 512)    myConfig.cart_type = CART_XEGS_512;
                 if (size == 1024)   myConfig.cart_type = CART_ATMAX_1024;
             }
+            cart_size = CART_ReadImage(fp, 0, myConfig.cart_type);
         }
     }
     else if (file_type == AFILE_A52)
@@ -862,8 +1053,9 @@ int CART_Insert(int enabled, int file_type, const char *filename)
         FILE * fp = fopen(filename, "rb");
         if (fp != NULL)
         {
-            cart_size = fread(cart_image, 1, CART_MAX_SIZE, fp);
-            fclose(fp);
+            fseek(fp, 0, SEEK_END);
+            cart_size = ftell(fp);
+            if (cart_size > CART_MAX_SIZE) cart_size = CART_MAX_SIZE;
             int size = cart_size / 1024;
             // If configuration hasn't been set for an A52 type, guess at the type based on ROM size
             if (myConfig.cart_type == CART_NONE)
@@ -880,9 +1072,16 @@ int CART_Insert(int enabled, int file_type, const char *filename)
                 install_os();
                 MEMORY_InitialiseMachine();
             }
+            cart_size = CART_ReadImage(fp, 0, myConfig.cart_type);
         }
     }
 
+    // Some configurations have a cart type without a cart file (e.g. a disk game set to a Right-Slot type)
+    if ((cart_image == NULL) && !CART_AllocImage(CART_ImageSize(myConfig.cart_type, 0)))
+    {
+        myConfig.cart_type = CART_NONE;
+    }
+
     if (enabled)
     {
         CART_Start(cart_size);
@@ -914,6 +1113,8 @@ void CART_Start(int cart_size)
     last_bb1_bank = 1;
     last_bb2_bank = 5;
 
+    CART_BuildMap();
+
     switch (myConfig.cart_type)
     {
     case CART_STD_2:
@@ -921,54 +1122,54 @@ void CART_Start(int cart_size)
         CartA0BF_Enable();
         memcpy(cart_image+0x800, cart_image, 0x800);    // Move the 2K ROM out
         memset(cart_image, 0xFF, 0x800);                // And back-fill 0xFF
-        mem_map[0xA] = cart_image + 0x1000 - 0xA000;    // There will just be 0xFF out here...
-        mem_map[0xB] = cart_image - 0x0000 - 0xB000;    // The 2K is mapped at the back end
+        MEMORY_MapBank(0xA, cart_image + 0x1000 - 0xA000);    // There will just be 0xFF out here...
+        MEMORY_MapBank(0xB, cart_image - 0x0000 - 0xB000);    // The 2K is mapped at the back end
         break;
     case CART_STD_4:
         Cart809F_Disable();
         CartA0BF_Enable();
-        mem_map[0xA] = cart_image + 0x0000 - 0xA000;
-        mem_map[0xB] = cart_image + 0x0000 - 0xB000;
+        MEMORY_MapBank(0xA, cart_image + 0x0000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + 0x0000 - 0xB000);
         break;
     case CART_STD_8:
     case CART_PHOENIX_8:
         Cart809F_Disable();
         CartA0BF_Enable();
-        mem_map[0xA] = cart_image + 0x0000 - 0xA000;
-        mem_map[0xB] = cart_image + 0x1000 - 0xB000;
+        MEMORY_MapBank(0xA, cart_image + 0x0000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + 0x1000 - 0xB000);
         break;
     case CART_STD_16:
     case CART_BLIZZARD_16:
         Cart809F_Enable();
         CartA0BF_Enable();
-        mem_map[0x8] = cart_image + 0x0000 - 0x8000;
-        mem_map[0x9] = cart_image + 0x1000 - 0x9000;
-        mem_map[0xA] = cart_image + 0x2000 - 0xA000;
-        mem_map[0xB] = cart_image + 0x3000 - 0xB000;
+        MEMORY_MapBank(0x8, cart_image + 0x0000 - 0x8000);
+        MEMORY_MapBank(0x9, cart_image + 0x1000 - 0x9000);
+        MEMORY_MapBank(0xA, cart_image + 0x2000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + 0x3000 - 0xB000);
         break;
     case CART_OSS_16_034M:
     case CART_OSS_16_043M:
         Cart809F_Disable();
         CartA0BF_Enable();
-        mem_map[0xA] = cart_image + 0x0000 - 0xA000;
-        mem_map[0xB] = cart_image + 0x3000 - 0xB000;
+        MEMORY_MapBank(0xA, cart_image + 0x0000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + 0x3000 - 0xB000);
         bank = 0;
         break;
     case CART_OSS_16:
     case CART_OSS_8:
         Cart809F_Disable();
         CartA0BF_Enable();
-        mem_map[0xA] = cart_image + 0x1000 - 0xA000;
-        mem_map[0xB] = cart_image + 0x0000 - 0xB000;
+        MEMORY_MapBank(0xA, cart_image + 0x1000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + 0x0000 - 0xB000);
         bank = 0;
         break;
     case CART_DB_32:
         Cart809F_Enable();
         CartA0BF_Enable();
-        mem_map[0x8] = cart_image + 0x0000 - 0x8000;
-        mem_map[0x9] = cart_image + 0x1000 - 0x9000;
-        mem_map[0xA] = cart_image + 0x6000 - 0xA000;
-        mem_map[0xB] = cart_image + 0x7000 - 0xB000;
+        MEMORY_MapBank(0x8, cart_image + 0x0000 - 0x8000);
+        MEMORY_MapBank(0x9, cart_image + 0x1000 - 0x9000);
+        MEMORY_MapBank(0xA, cart_image + 0x6000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + 0x7000 - 0xB000);
         bank = 0;
         break;
         
@@ -977,8 +1178,8 @@ void CART_Start(int cart_size)
         UnscrambleAtrax(1, 64*1024); // Once unscrambled, it's just SDX_64 and SDX 128
         Cart809F_Disable();
         CartA0BF_Enable();
-        mem_map[0xA] = cart_image + 0x0000 - 0xA000;
-        mem_map[0xB] = cart_image + 0x1000 - 0xB000;
+        MEMORY_MapBank(0xA, cart_image + 0x0000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + 0x1000 - 0xB000);
         bank = 0;
         break;
     
@@ -992,68 +1193,68 @@ void CART_Start(int cart_size)
     case CART_SDX_128:
         Cart809F_Disable();
         CartA0BF_Enable();
-        mem_map[0xA] = cart_image + 0x0000 - 0xA000;
-        mem_map[0xB] = cart_image + 0x1000 - 0xB000;
+        MEMORY_MapBank(0xA, cart_image + 0x0000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + 0x1000 - 0xB000);
         bank = 0;
         break;
     case CART_XEGS_32:
     case CART_SWXEGS_32:
         Cart809F_Enable();
         CartA0BF_Enable();
-        mem_map[0x8] = cart_image + 0x0000 - 0x8000;
-        mem_map[0x9] = cart_image + 0x1000 - 0x9000;
-        mem_map[0xA] = cart_image + 0x6000 - 0xA000;
-        mem_map[0xB] = cart_image + 0x7000 - 0xB000;
+        MEMORY_MapBank(0x8, cart_image + 0x0000 - 0x8000);
+        MEMORY_MapBank(0x9, cart_image + 0x1000 - 0x9000);
+        MEMORY_MapBank(0xA, cart_image + 0x6000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + 0x7000 - 0xB000);
         bank = 0;
         break;
     case CART_XEGS_64:
     case CART_SWXEGS_64:
         Cart809F_Enable();
         CartA0BF_Enable();
-        mem_map[0x8] = cart_image + 0x0000 - 0x8000;
-        mem_map[0x9] = cart_image + 0x1000 - 0x9000;
-        mem_map[0xA] = cart_image + 0xe000 - 0xA000;
-        mem_map[0xB] = cart_image + 0xf000 - 0xB000;
+        MEMORY_MapBank(0x8, cart_image + 0x0000 - 0x8000);
+        MEMORY_MapBank(0x9, cart_image + 0x1000 - 0x9000);
+        MEMORY_MapBank(0xA, cart_image + 0xe000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + 0xf000 - 0xB000);
         bank = 0;
         break;
     case CART_XEGS_128:
     case CART_SWXEGS_128:
         Cart809F_Enable();
         CartA0BF_Enable();
-        mem_map[0x8] = cart_image + 0x0000 - 0x8000;
-        mem_map[0x9] = cart_image + 0x1000 - 0x9000;
-        mem_map[0xA] = cart_image + 0x1e000 - 0xA000;
-        mem_map[0xB] = cart_image + 0x1f000 - 0xB000;
+        MEMORY_MapBank(0x8, cart_image + 0x0000 - 0x8000);
+        MEMORY_MapBank(0x9, cart_image + 0x1000 - 0x9000);
+        MEMORY_MapBank(0xA, cart_image + 0x1e000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + 0x1f000 - 0xB000);
         bank = 0;
         break;
     case CART_XEGS_256:
     case CART_SWXEGS_256:
         Cart809F_Enable();
         CartA0BF_Enable();
-        mem_map[0x8] = cart_image + 0x0000 - 0x8000;
-        mem_map[0x9] = cart_image + 0x1000 - 0x9000;
-        mem_map[0xA] = cart_image + 0x3e000 - 0xA000;
-        mem_map[0xB] = cart_image + 0x3f000 - 0xB000;
+        MEMORY_MapBank(0x8, cart_image + 0x0000 - 0x8000);
+        MEMORY_MapBank(0x9, cart_image + 0x1000 - 0x9000);
+        MEMORY_MapBank(0xA, cart_image + 0x3e000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + 0x3f000 - 0xB000);
         bank = 0;
         break;
     case CART_XEGS_512:
     case CART_SWXEGS_512:
         Cart809F_Enable();
         CartA0BF_Enable();
-        mem_map[0x8] = cart_image + 0x0000 - 0x8000;
-        mem_map[0x9] = cart_image + 0x1000 - 0x9000;
-        mem_map[0xA] = cart_image + 0x7e000 - 0xA000;
-        mem_map[0xB] = cart_image + 0x7f000 - 0xB000;
+        MEMORY_MapBank(0x8, cart_image + 0x0000 - 0x8000);
+        MEMORY_MapBank(0x9, cart_image + 0x1000 - 0x9000);
+        MEMORY_MapBank(0xA, cart_image + 0x7e000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + 0x7f000 - 0xB000);
         bank = 0;
         break;
     case CART_XEGS_1024:
     case CART_SWXEGS_1024:
         Cart809F_Enable();
         CartA0BF_Enable();
-        mem_map[0x8] = cart_image + 0x0000 - 0x8000;
-        mem_map[0x9] = cart_image + 0x1000 - 0x9000;
-        mem_map[0xA] = cart_image + 0xfe000 - 0xA000;
-        mem_map[0xB] = cart_image + 0xff000 - 0xB000;
+        MEMORY_MapBank(0x8, cart_image + 0x0000 - 0x8000);
+        MEMORY_MapBank(0x9, cart_image + 0x1000 - 0x9000);
+        MEMORY_MapBank(0xA, cart_image + 0xfe000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + 0xff000 - 0xB000);
         bank = 0;
         break;
     case CART_BBSB_40:
@@ -1063,16 +1264,16 @@ void CART_Start(int cart_size)
         CopyROM(0x8000, 0x8fff, cart_shadow + (last_bb1_bank & 0x03) * 0x1000);
         CopyROM(0x9000, 0x9fff, cart_shadow + 0x4000 + ((last_bb2_bank & 0x0c) >> 2) * 0x1000);
         CopyROM(0xa000, 0xbfff, cart_shadow + 0x8000);
-        readmap[0x8f] = BountyBob1GetByte;
-        readmap[0x9f] = BountyBob2GetByte;
-        writemap[0x8f] = BountyBob1PutByte;
-        writemap[0x9f] = BountyBob2PutByte;
+        MEMORY_SetReadHandler(0x8f, BountyBob1GetByte);
+        MEMORY_SetReadHandler(0x9f, BountyBob2GetByte);
+        MEMORY_SetWriteHandler(0x8f, BountyBob1PutByte);
+        MEMORY_SetWriteHandler(0x9f, BountyBob2PutByte);
         break;
     case CART_ATRAX_128:
         Cart809F_Disable();
         CartA0BF_Enable();
-        mem_map[0xA] = cart_image + 0x0000 - 0xA000;
-        mem_map[0xB] = cart_image + 0x1000 - 0xB000;
+        MEMORY_MapBank(0xA, cart_image + 0x0000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + 0x1000 - 0xB000);
         bank = 0;
         break;
     case CART_MEGA_16:
@@ -1084,54 +1285,49 @@ void CART_Start(int cart_size)
     case CART_MEGA_1024:
         Cart809F_Enable();
         CartA0BF_Enable();
-        mem_map[0x8] = cart_image + 0x0000 - 0x8000;
-        mem_map[0x9] = cart_image + 0x1000 - 0x9000;
-        mem_map[0xA] = cart_image + 0x2000 - 0xA000;
-        mem_map[0xB] = cart_image + 0x3000 - 0xB000;
+        MEMORY_MapBank(0x8, cart_image + 0x0000 - 0x8000);
+        MEMORY_MapBank(0x9, cart_image + 0x1000 - 0x9000);
+        MEMORY_MapBank(0xA, cart_image + 0x2000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + 0x3000 - 0xB000);
         bank = 0;
         break;
     case CART_TURBOSOFT_64:
     case CART_TURBOSOFT_128:
-            bank = 99;
-            set_bank_A0BF_TURBOSOFT(0x00, 0x0F);
+        CART_MapSelect(0x00);
         break;
     case CART_ATMAX_128:
         Cart809F_Disable();
         CartA0BF_Enable();
-        mem_map[0xA] = cart_image + 0x0000 - 0xA000;
-        mem_map[0xB] = cart_image + 0x1000 - 0xB000;
+        MEMORY_MapBank(0xA, cart_image + 0x0000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + 0x1000 - 0xB000);
         bank = 0;
         break;
     case CART_ATMAX_1024:
         Cart809F_Disable();
         CartA0BF_Enable();
-        mem_map[0xA] = cart_image + 0xfe000 - 0xA000;
-        mem_map[0xB] = cart_image + 0xff000 - 0xB000;
+        MEMORY_MapBank(0xA, cart_image + 0xfe000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + 0xff000 - 0xB000);
         bank = 0x7f;
         break;
     case CART_ATMAX_NEW_1024:
         Cart809F_Disable();
         CartA0BF_Enable();
-        mem_map[0xA] = cart_image + 0xfe000 - 0xA000;
-        mem_map[0xB] = cart_image + 0xff000 - 0xB000;
+        MEMORY_MapBank(0xA, cart_image + 0xfe000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + 0xff000 - 0xB000);
         bank = 0x00;
         break;
     case CART_JRC_64:
         Cart809F_Disable();
-        set_bank_A0BF_JRC(0);
+        CART_MapSelect(0x00);
         break;
     case CART_JRC_64i:
         Cart809F_Disable();
         set_bank_A0BF_JRCi(0);
         break;
     case CART_SIC_128:
-        set_bank_SIC(0x00, 0x07);
-        break;
     case CART_SIC_256:
-        set_bank_SIC(0x00, 0x0f);
-        break;
     case CART_SIC_512:
-        set_bank_SIC(0x00, 0x1f);
+        CART_MapSelect(0x00);
         break;
     case CART_SIC_PLUS:
         set_bank_SICPLUS(0x00);
@@ -1157,14 +1353,14 @@ void CART_Start(int cart_size)
     case CART_LOWBANK_8:
         Cart809F_Enable();
         CartA0BF_Disable();
-        mem_map[0x8] = cart_image + 0x0000 - 0x8000;
-        mem_map[0x9] = cart_image + 0x1000 - 0x9000;
+        MEMORY_MapBank(0x8, cart_image + 0x0000 - 0x8000);
+        MEMORY_MapBank(0x9, cart_image + 0x1000 - 0x9000);
         break;
     case CART_BLIZZARD_4:
         Cart809F_Disable();
         CartA0BF_Enable();
-        mem_map[0xA] = cart_image + 0x0000 - 0xA000;
-        mem_map[0xB] = cart_image + 0x0000 - 0xB000;    // 4K Cart image is duplicated here
+        MEMORY_MapBank(0xA, cart_image + 0x0000 - 0xA000);
+        MEMORY_MapBank(0xB, cart_image + 0x0000 - 0xB000);    // 4K Cart image is duplicated here
         break;
     case CART_BLIZZARD_32:
         Cart809F_Disable();
@@ -1177,8 +1373,8 @@ void CART_Start(int cart_size)
         CartA0BF_Enable();
         bank = 0;
         for (u32 i=0; i<32; i++) memcpy(cart_image+0x10000+(256*i), cart_image, 256); // Copy initial 256 byte block into unused 8K area
-        mem_map[0xA] = cart_image + 0x10000 - 0xA000;        // First 256 bytes is repeated throughout the memory range
-        mem_map[0xB] = cart_image + 0x11000 - 0xB000;        // First 256 bytes is repeated throughout the memory range
+        MEMORY_MapBank(0xA, cart_image + 0x10000 - 0xA000);        // First 256 bytes is repeated throughout the memory range
+        MEMORY_MapBank(0xB, cart_image + 0x11000 - 0xB000);        // First 256 bytes is repeated throughout the memory range
         memcpy(memory+0xD500, cart_image + (bank*256), 256); // First 256 bytes in the visible window
         break;
     case CART_ADAWLIAH32:
@@ -1201,7 +1397,7 @@ void CART_Start(int cart_size)
     case CART_JATARI_256:
     case CART_JATARI_512:
     case CART_JATARI_1024:
-        set_bank_A0BF_JATARI(0, 0x7f);
+        CART_MapSelect(0x00);
         break;
     case CART_DCART:
         Cart809F_Disable();
@@ -1242,29 +1438,29 @@ void CART_Start(int cart_size)
         memcpy(memory+0x5000, cart_shadow + 0x4000 + ((last_bb2_bank & 0x0c) >> 2) * 0x1000, 0x1000);
         memcpy(memory+0x8000, cart_shadow+0x8000, 0x2000); // Fixed bank 8K
         memcpy(memory+0xA000, cart_shadow+0x8000, 0x2000); // Fixed bank mirror
-        readmap[0x4f] = BountyBob1GetByte;
-        readmap[0x5f] = BountyBob2GetByte;
-        writemap[0x4f] = BountyBob1PutByte;
-        writemap[0x5f] = BountyBob2PutByte;
+        MEMORY_SetReadHandler(0x4f, BountyBob1GetByte);
+        MEMORY_SetReadHandler(0x5f, BountyBob2GetByte);
+        MEMORY_SetWriteHandler(0x4f, BountyBob1PutByte);
+        MEMORY_SetWriteHandler(0x5f, BountyBob2PutByte);
         break;
     case CART_5200_32:
         memcpy(memory+0x4000, cart_image, 0x8000);
         break;
     case CART_5200_64:
         BryanBank(1);
-        readmap[0xbf] = BryanGetByte64;
+        MEMORY_SetReadHandler(0xbf, BryanGetByte64);
         break;
     case CART_5200_128:
         BryanBank(3);
-        readmap[0xbf] = BryanGetByte128;
+        MEMORY_SetReadHandler(0xbf, BryanGetByte128);
         break;
     case CART_TELELINK2:
         Cart809F_Disable();
         CartA0BF_Enable();
         memset(cart_image+0x2000, 0x00, 0x2000);        // Clear the 'NVRAM' area
-        mem_map[0xA] = cart_image + 0x0000 - 0xA000;    // Cart is mapped here
-        mem_map[0xB] = cart_image + 0x1000 - 0xB000;    // Cart is mapped here
-        mem_map[0x9] = cart_image + 0x2000 - 0x9000;    // This is 'NVRAM' and we just reuse the cart space
+        MEMORY_MapBank(0xA, cart_image + 0x0000 - 0xA000);    // Cart is mapped here
+        MEMORY_MapBank(0xB, cart_image + 0x1000 - 0xB000);    // Cart is mapped here
+        MEMORY_MapBank(0x9, cart_image + 0x2000 - 0x9000);    // This is 'NVRAM' and we just reuse the cart space
         SetRAM(0x9000, 0x9fff); // We treat the NVRAM as RAM (not backed)
         break;
     case CART_RIGHT_4:
@@ -1272,15 +1468,15 @@ void CART_Start(int cart_size)
         // No break is intentional...
     case CART_RIGHT_8:
         Cart809F_Enable();
-        mem_map[0x8] = cart_image + 0x0000 - 0x8000;
-        mem_map[0x9] = cart_image + 0x1000 - 0x9000;
+        MEMORY_MapBank(0x8, cart_image + 0x0000 - 0x8000);
+        MEMORY_MapBank(0x9, cart_image + 0x1000 - 0x9000);
 
         // With Right-side CARTs we might also be enabling BASIC
         if (myConfig.basic_enabled)
         {
             CartA0BF_Enable();
-            mem_map[0xA] = ((UBYTE*)ROM_basic) + 0x0000 - 0xA000;
-            mem_map[0xB] = ((UBYTE*)ROM_basic) + 0x1000 - 0xB000;
+            MEMORY_MapBank(0xA, ((UBYTE*)ROM_basic) + 0x0000 - 0xA000);
+            MEMORY_MapBank(0xB, ((UBYTE*)ROM_basic) + 0x1000 - 0xB000);
         }
         else
         {
@@ -1295,8 +1491,8 @@ void CART_Start(int cart_size)
         {
             Cart809F_Disable();
             CartA0BF_Enable();
-            mem_map[0xA] = ((UBYTE*)ROM_basic) + 0x0000 - 0xA000;
-            mem_map[0xB] = ((UBYTE*)ROM_basic) + 0x1000 - 0xB000;
+            MEMORY_MapBank(0xA, ((UBYTE*)ROM_basic) + 0x0000 - 0xA000);
+            MEMORY_MapBank(0xB, ((UBYTE*)ROM_basic) + 0x1000 - 0xB000);
         }
         break;
     }
@@ -1391,35 +1587,6 @@ void CART_Access(UWORD addr)
         }
         set_bank_A0AF(b, 0x0000);
         break;
-    case CART_DB_32:
-        set_bank_809F(addr & 0x03, 0x6000);
-        break;
-    case CART_WILL_64:
-        set_bank_A0BF_WILLIAMS(addr, 0x07);
-        break;
-    case CART_WILL_32:
-        set_bank_A0BF_WILLIAMS(addr, 0x03);
-        break;
-    case CART_WILL_16:
-        set_bank_A0BF_WILLIAMS(addr, 0x01);
-        break;
-    case CART_EXP_64:
-        if ((addr & 0xf0) == 0x70)
-            set_bank_A0BF(addr);
-        break;
-    case CART_DIAMOND_64:
-        if ((addr & 0xf0) == 0xd0)
-            set_bank_A0BF(addr);
-        break;
-    case CART_ATRAX_SDX_64:
-    case CART_SDX_64:
-        if ((addr & 0xf0) == 0xe0)
-            set_bank_A0BF(addr);
-        break;
-    case CART_MIO_8:
-        if ((addr & 0xf0) == 0xe0)
-            set_bank_A0BF(addr);
-        break;
     case CART_PHOENIX_8:
         CartA0BF_Disable();
         break;
@@ -1436,53 +1603,16 @@ void CART_Access(UWORD addr)
     case CART_ULTRACART:
         set_bank_ultracart(++bank);
         break;
-    case CART_ATMAX_128:
-        set_bank_A0BF_ATMAX128(addr & 0xff);
-        break;
-    case CART_ATMAX_1024:
-    case CART_ATMAX_NEW_1024:
-        set_bank_A0BF_ATMAX1024(addr & 0xff);
-        break;
     case CART_ATRAX_SDX_128:
     case CART_SDX_128:
         set_bank_SDX_128(addr);
         break;
-    case CART_TURBOSOFT_64:
-        set_bank_A0BF_TURBOSOFT(addr, 0x07);
-        break;
-    case CART_TURBOSOFT_128:
-        set_bank_A0BF_TURBOSOFT(addr, 0x0f);
-        break;
     case CART_ADAWLIAH32:
         set_bank_ADAWLIAH(++bank & 0x03);
         break;
     case CART_ADAWLIAH64:
         set_bank_ADAWLIAH(++bank & 0x07);
         break;
-    case CART_JATARI_8:
-        set_bank_A0BF_JATARI(addr, 0x00);
-        break;
-    case CART_JATARI_16:
-        set_bank_A0BF_JATARI(addr, 0x01);
-        break;
-    case CART_JATARI_32:
-        set_bank_A0BF_JATARI(addr, 0x03);
-        break;
-    case CART_JATARI_64:
-        set_bank_A0BF_JATARI(addr, 0x07);
-        break;
-    case CART_JATARI_128:
-        set_bank_A0BF_JATARI(addr, 0x0f);
-        break;
-    case CART_JATARI_256:
-        set_bank_A0BF_JATARI(addr, 0x1f);
-        break;
-    case CART_JATARI_512:
-        set_bank_A0BF_JATARI(addr, 0x3f);
-        break;
-    case CART_JATARI_1024:
-        set_bank_A0BF_JATARI(addr, 0x7f);
-        break;
     case CART_DCART:
         set_bank_A0BF_DCART(addr & 0xff);
         break;
@@ -1512,6 +1642,13 @@ UBYTE CART_GetByte(UWORD addr)
         }
     }
 
+    // Table driven carts that bank on any access - reads count too
+    if (cart_mapper && (cart_mapper->trigger & CART_MAP_ACCESS))
+    {
+        if ((addr & cart_mapper->addr_mask) == cart_mapper->addr_match) CART_MapSelect(addr & 0xff);
+        return 0;
+    }
+
     switch (myConfig.cart_type)
     {
     case CART_SIC_128:
@@ -1558,92 +1695,18 @@ void CART_PutByte(UWORD addr, UBYTE byte)
         }
     }
 
-    switch (myConfig.cart_type)
+    // Table driven carts select on either the address or the byte written
+    if (cart_mapper)
     {
-    case CART_XEGS_32:
-        set_bank_809F(byte & 0x03, 0x6000);
-        break;
-    case CART_XEGS_64:
-        set_bank_809F(byte & 0x07, 0xe000);
-        break;
-    case CART_XEGS_128:
-        set_bank_809F(byte & 0x0f, 0x1e000);
-        break;
-    case CART_XEGS_256:
-        set_bank_809F(byte & 0x1f, 0x3e000);
-        break;
-    case CART_XEGS_512:
-        set_bank_809F(byte & 0x3f, 0x7e000);
-        break;
-    case CART_XEGS_1024:
-        set_bank_809F(byte & 0x7f, 0xfe000);
-        break;
-    case CART_ATRAX_128:
-        if (byte & 0x80) {
-            if (bank >= 0) {
-                CartA0BF_Disable();
-                bank = -1;
-            }
-        }
-        else {
-            int b = byte & 0xf;
-            if (b != bank)
-            {
-                CartA0BF_Enable();
-                mem_map[0xA] = (cart_image + b*0x2000) + 0x0000 - 0xA000;
-                mem_map[0xB] = (cart_image + b*0x2000) + 0x1000 - 0xB000;
-                bank = b;
-            }
+        if ((addr & cart_mapper->addr_mask) == cart_mapper->addr_match)
+        {
+            CART_MapSelect((cart_mapper->trigger & CART_MAP_ACCESS) ? (addr & 0xff) : byte);
         }
-        break;
-    case CART_MEGA_16:
-        set_bank_80BF(byte & 0x80);
-        break;
-    case CART_MEGA_32:
-        set_bank_80BF(byte & 0x81);
-        break;
-    case CART_MEGA_64:
-        set_bank_80BF(byte & 0x83);
-        break;
-    case CART_MEGA_128:
-        set_bank_80BF(byte & 0x87);
-        break;
-    case CART_MEGA_256:
-        set_bank_80BF(byte & 0x8f);
-        break;
-    case CART_MEGA_512:
-        set_bank_80BF(byte & 0x9f);
-        break;
-    case CART_MEGA_1024:
-        set_bank_80BF(byte & 0xbf);
-        break;
-    case CART_SWXEGS_32:
-        set_bank_809F(byte & 0x83, 0x6000);
-        break;
-    case CART_SWXEGS_64:
-        set_bank_809F(byte & 0x87, 0xe000);
-        break;
-    case CART_SWXEGS_128:
-        set_bank_809F(byte & 0x8f, 0x1e000);
-        break;
-    case CART_SWXEGS_256:
-        set_bank_809F(byte & 0x9f, 0x3e000);
-        break;
-    case CART_SWXEGS_512:
-        set_bank_809F(byte & 0xbf, 0x7e000);
-        break;
-    case CART_SWXEGS_1024:
-        set_bank_809F(byte, 0xfe000);
-        break;
-    case CART_SIC_128:
-        if ((addr & 0xe0) == 0x00) set_bank_SIC(byte, 0x07);
-        break;
-    case CART_SIC_256:
-        if ((addr & 0xe0) == 0x00) set_bank_SIC(byte, 0x0f);
-        break;
-    case CART_SIC_512:
-        if ((addr & 0xe0) == 0x00) set_bank_SIC(byte, 0x1f);
-        break;
+        return;
+    }
+
+    switch (myConfig.cart_type)
+    {
     case CART_SIC_PLUS:
         if ((addr & 0xc0) == 0x00) set_bank_SICPLUS(byte);
         break;
@@ -1661,9 +1724,6 @@ void CART_PutByte(UWORD addr, UBYTE byte)
         bank = (bank+1) & 0x7F;
         memcpy(memory+0xD500, cart_image + (bank*256), 256);
         break;
-    case CART_JRC_64:
-        if ((addr & 0x80) == 0) set_bank_A0BF_JRC(byte);
-        break;
     case CART_JRC_64i:
         if ((addr & 0x80) == 0) set_bank_A0BF_JRCi(byte);
         break;
@@ -164,12 +164,15 @@ extern UWORD last_bb2_bank;
 extern int cart_size;
 
 extern UBYTE *cart_mem_ptr;
-extern UBYTE cart_image[];
+extern UBYTE *cart_image;
+extern ULONG cart_image_size;
 
 int CART_Insert(int enabled, int type, const char *filename);
 void CART_Remove(void);
 void CART_Start(int cart_size);
 UBYTE CART_GetByte(UWORD addr);
 void CART_PutByte(UWORD addr, UBYTE byte);
+void CART_Prefetch(void);
+void CART_LoadAll(void);
 
 #endif /* _CARTRIDGE_H_ */
@@ -22,12 +22,25 @@
  * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 */
 
+/*
+ * The CPU<->ANTIC cycle maps never change so we no longer build them at
+ * startup. This file is now only the generator - it is compiled for the
+ * host and its output is checked in as cycle_map_tables.c with the
+ * smallest element types that hold the values. To regenerate:
+ *
+ *   gcc -DCYCLE_MAP_GENERATOR -o cycle_map cycle_map.c
+ *   ./cycle_map > cycle_map_tables.c
+ *
+ * On the DS build this translation unit compiles to nothing.
+ */
+#ifdef CYCLE_MAP_GENERATOR
+
 #include<stdio.h>
-#include "atari.h"
 #include "cycle_map.h"
 
-int cpu2antic[CPU2ANTIC_SIZE * (17 * 7 + 1)];
-int antic2cpu[CPU2ANTIC_SIZE * (17 * 7 + 1)];
+int cpu2antic[CPU2ANTIC_SIZE * CYCLE_MAP_ROWS];
+int antic2cpu[CPU2ANTIC_SIZE * CYCLE_MAP_ROWS];
+static void create_cycle_map(void);
 static void try_all_scroll(int md, int use_char_index,
 	int use_font, int use_bitmap, int *cpu2antic, int *antic2cpu);
 static void antic_steal_map(int width, int md, int scroll_offset, int use_char_index,
@@ -35,14 +48,42 @@ static void antic_steal_map(int width, int md, int scroll_offset, int use_char_i
 	int *actualcycles);
 static void cpu_cycle_map(char *antic_cycles_orig, int *cpu_cycles, int *actual_cycles);
 
-#undef TEST_CYCLE_MAP
-#ifdef TEST_CYCLE_MAP
+static void print_row(const char *type, const char *name, const int *table, int row)
+{
+	int i;
+	printf("%s %s_blank[CPU2ANTIC_SIZE] __attribute__((section(\".dtcm\"))) =\n{", type, name);
+	for (i = 0; i < CPU2ANTIC_SIZE; i++)
+		printf("%s%4d,", (i % 16) ? "" : "\n   ", table[CPU2ANTIC_SIZE * row + i]);
+	printf("\n};\n\n");
+}
+
+static void print_table(const char *type, const char *name, const int *table)
+{
+	int row, i;
+	printf("const %s %s[CPU2ANTIC_SIZE * CYCLE_MAP_ROWS] =\n{\n", type, name);
+	for (row = 0; row < CYCLE_MAP_ROWS; row++) {
+		printf("    // Row %d", row);
+		for (i = 0; i < CPU2ANTIC_SIZE; i++)
+			printf("%s%4d,", (i % 16) ? "" : "\n   ", table[CPU2ANTIC_SIZE * row + i]);
+		printf("\n");
+	}
+	printf("};\n\n");
+}
+
 int main()
 {
 	create_cycle_map();
+	printf("// ---------------------------------------------------------------------------\n");
+	printf("// Generated by cycle_map.c (gcc -DCYCLE_MAP_GENERATOR) - do not edit by hand.\n");
+	printf("// Row 0 (blank/non-DMA lines) is by far the most used so a copy lives in DTCM.\n");
+	printf("// ---------------------------------------------------------------------------\n");
+	printf("#include \"atari.h\"\n#include \"cycle_map.h\"\n\n");
+	print_row("SBYTE", "cpu2antic", cpu2antic, 0);
+	print_row("UBYTE", "antic2cpu", antic2cpu, 0);
+	print_table("SBYTE", "cpu2antic", cpu2antic);
+	print_table("UBYTE", "antic2cpu", antic2cpu);
 	return 0;
-};
-#endif
+}
 
 static void cpu_cycle_map(char *antic_cycles_orig, int *cpu_cycles, int *actual_cycles)
 {
@@ -67,7 +108,7 @@ static void cpu_cycle_map(char *antic_cycles_orig, int *cpu_cycles, int *actual_
 	}
 }
 
-void create_cycle_map(void)
+static void create_cycle_map(void)
 {
 #ifdef TEST_CYCLE_MAP
 	int i, j;
@@ -200,3 +241,5 @@ static void antic_steal_map(int width, int md, int scroll_offset, int use_char_i
 	}
 	cpu_cycle_map(antic_cycles, cpu_cycles, actual_cycles);
 }
+
+#endif /* CYCLE_MAP_GENERATOR */
@@ -2,8 +2,18 @@
 #define _CYCLE_MAP_H_
 
 #define CPU2ANTIC_SIZE (114 + 9)
-extern int cpu2antic[CPU2ANTIC_SIZE * (17 * 7 + 1)];
-extern int antic2cpu[CPU2ANTIC_SIZE * (17 * 7 + 1)];
-void create_cycle_map(void);
+#define CYCLE_MAP_ROWS (17 * 7 + 1)
+
+#ifndef CYCLE_MAP_GENERATOR
+// These are pre-computed tables - see cycle_map.c for how cycle_map_tables.c is generated
+extern const SBYTE cpu2antic[CPU2ANTIC_SIZE * CYCLE_MAP_ROWS];
+extern const UBYTE antic2cpu[CPU2ANTIC_SIZE * CYCLE_MAP_ROWS];
+extern SBYTE cpu2antic_blank[CPU2ANTIC_SIZE];
+extern UBYTE antic2cpu_blank[CPU2ANTIC_SIZE];
+
+// Row 0 is served from the fast DTCM copy
+#define CPU2ANTIC_ROW(idx) ((idx) ? &cpu2antic[CPU2ANTIC_SIZE * (idx)] : cpu2antic_blank)
+#define ANTIC2CPU_ROW(idx) ((idx) ? &antic2cpu[CPU2ANTIC_SIZE * (idx)] : antic2cpu_blank)
+#endif
 
 #endif /* _CYCLE_MAP_H_ */
@@ -0,0 +1,2199 @@
+// ---------------------------------------------------------------------------
+// Generated by cycle_map.c (gcc -DCYCLE_MAP_GENERATOR) - do not edit by hand.
+// Row 0 (blank/non-DMA lines) is by far the most used so a copy lives in DTCM.
+// ---------------------------------------------------------------------------
+#include "atari.h"
+#include "cycle_map.h"
+
+SBYTE cpu2antic_blank[CPU2ANTIC_SIZE] __attribute__((section(".dtcm"))) =
+{
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  29,  30,  31,  33,
+     34,  35,  37,  38,  39,  41,  42,  43,  45,  46,  47,  49,  50,  51,  53,  54,
+     55,  57,  58,  59,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,  72,
+     73,  74,  75,  76,  77,  78,  79,  80,  81,  82,  83,  84,  85,  86,  87,  88,
+     89,  90,  91,  92,  93,  94,  95,  96,  97,  98,  99, 100, 101, 102, 103, 104,
+    105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+    121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+};
+
+UBYTE antic2cpu_blank[CPU2ANTIC_SIZE] __attribute__((section(".dtcm"))) =
+{
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  29,  30,
+     31,  31,  32,  33,  34,  34,  35,  36,  37,  37,  38,  39,  40,  40,  41,  42,
+     43,  43,  44,  45,  46,  46,  47,  48,  49,  49,  50,  51,  52,  52,  53,  54,
+     55,  56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,
+     71,  72,  73,  74,  75,  76,  77,  78,  79,  80,  81,  82,  83,  84,  85,  86,
+     87,  88,  89,  90,  91,  92,  93,  94,  95,  96,  97,  98,  99, 100, 101, 102,
+    103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
+};
+
+const SBYTE cpu2antic[CPU2ANTIC_SIZE * CYCLE_MAP_ROWS] =
+{
+    // Row 0
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  29,  30,  31,  33,
+     34,  35,  37,  38,  39,  41,  42,  43,  45,  46,  47,  49,  50,  51,  53,  54,
+     55,  57,  58,  59,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,  72,
+     73,  74,  75,  76,  77,  78,  79,  80,  81,  82,  83,  84,  85,  86,  87,  88,
+     89,  90,  91,  92,  93,  94,  95,  96,  97,  98,  99, 100, 101, 102, 103, 104,
+    105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+    121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 1
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  30,  95,  96,  97,
+     98,  99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
+    114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 2
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  22, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 3
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  23, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 4
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  24, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 5
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  25, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 6
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  26, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 7
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  27, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 8
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26, 109, 110, 111, 112, 113,
+    114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 9
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 10
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  14, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 11
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  15, 110,
+    111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 12
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  16,
+    110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 13
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     17, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 14
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  18, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 15
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  19, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 16
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  20, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121,
+    122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 17
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  21, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+    121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 18
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  29,  30,  31,  35,
+     39,  43,  47,  51,  55,  59,  63,  65,  67,  69,  71,  73,  75,  77,  79,  81,
+     83,  85,  87,  89,  91,  93,  95,  96,  97,  98,  99, 100, 101, 102, 103, 104,
+    105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+    121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 19
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  25,  27,  31,  35,  39,  43,  47,  51,
+     55,  59,  63,  65,  67,  69,  71,  73,  75,  77,  79,  81,  83,  85,  87,  89,
+     91,  93,  95,  97,  99, 101, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 20
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  26,  30,  34,  38,  42,  46,  50,
+     54,  58,  62,  64,  66,  68,  70,  72,  74,  76,  78,  80,  82,  84,  86,  88,
+     90,  92,  94,  96,  98, 100, 102, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 21
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  27,  31,  35,  39,  43,  47,
+     51,  55,  59,  63,  65,  67,  69,  71,  73,  75,  77,  79,  81,  83,  85,  87,
+     89,  91,  93,  95,  97,  99, 101, 103, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 22
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  30,  34,  38,  42,  46,
+     50,  54,  58,  62,  64,  66,  68,  70,  72,  74,  76,  78,  80,  82,  84,  86,
+     88,  90,  92,  94,  96,  98, 100, 102, 104, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 23
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  31,  35,  39,  43,
+     47,  51,  55,  59,  63,  65,  67,  69,  71,  73,  75,  77,  79,  81,  83,  85,
+     87,  89,  91,  93,  95,  97,  99, 101, 103, 105, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 24
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  30,  34,  38,  42,
+     46,  50,  54,  58,  62,  64,  66,  68,  70,  72,  74,  76,  78,  80,  82,  84,
+     86,  88,  90,  92,  94,  96,  98, 100, 102, 104, 106, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 25
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  29,  31,  35,  39,
+     43,  47,  51,  55,  59,  63,  65,  67,  69,  71,  73,  75,  77,  79,  81,  83,
+     85,  87,  89,  91,  93,  95,  97,  99, 101, 103, 105, 107, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 26
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  29,  30,  34,  38,
+     42,  46,  50,  54,  58,  62,  64,  66,  68,  70,  72,  74,  76,  78,  80,  82,
+     84,  86,  88,  90,  92,  94,  96,  98, 100, 102, 104, 106, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 27
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     17,  19,  21,  23,  25,  27,  31,  35,  39,  43,  47,  51,  55,  59,  63,  65,
+     67,  69,  71,  73,  75,  77,  79,  81,  83,  85,  87,  89,  91,  93,  95,  97,
+     99, 101, 103, 105, 107, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+    120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 28
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  18,  20,  22,  24,  26,  30,  34,  38,  42,  46,  50,  54,  58,  62,  64,
+     66,  68,  70,  72,  74,  76,  78,  80,  82,  84,  86,  88,  90,  92,  94,  96,
+     98, 100, 102, 104, 106, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118,
+    119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 29
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  19,  21,  23,  25,  27,  31,  35,  39,  43,  47,  51,  55,  59,  63,
+     65,  67,  69,  71,  73,  75,  77,  79,  81,  83,  85,  87,  89,  91,  93,  95,
+     97,  99, 101, 103, 105, 107, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118,
+    119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 30
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  20,  22,  24,  26,  30,  34,  38,  42,  46,  50,  54,  58,  62,
+     64,  66,  68,  70,  72,  74,  76,  78,  80,  82,  84,  86,  88,  90,  92,  94,
+     96,  98, 100, 102, 104, 106, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+    118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 31
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  21,  23,  25,  27,  31,  35,  39,  43,  47,  51,  55,  59,
+     63,  65,  67,  69,  71,  73,  75,  77,  79,  81,  83,  85,  87,  89,  91,  93,
+     95,  97,  99, 101, 103, 105, 107, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+    118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 32
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  22,  24,  26,  30,  34,  38,  42,  46,  50,  54,  58,
+     62,  64,  66,  68,  70,  72,  74,  76,  78,  80,  82,  84,  86,  88,  90,  92,
+     94,  96,  98, 100, 102, 104, 106, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 33
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  23,  25,  27,  31,  35,  39,  43,  47,  51,  55,
+     59,  63,  65,  67,  69,  71,  73,  75,  77,  79,  81,  83,  85,  87,  89,  91,
+     93,  95,  97,  99, 101, 103, 105, 107, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 34
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  24,  26,  30,  34,  38,  42,  46,  50,  54,
+     58,  62,  64,  66,  68,  70,  72,  74,  76,  78,  80,  82,  84,  86,  88,  90,
+     92,  94,  96,  98, 100, 102, 104, 106, 108, 109, 110, 111, 112, 113, 114, 115,
+    116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 35
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  30,  31,  35,  39,
+     43,  47,  51,  55,  59,  63,  66,  67,  70,  71,  74,  75,  78,  79,  82,  83,
+     86,  87,  90,  91,  93,  94,  95,  96,  97,  98,  99, 100, 101, 102, 103, 104,
+    105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+    121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 36
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  22,  23,  26,  27,  31,  35,  39,  43,  47,  51,  55,
+     59,  63,  66,  67,  70,  71,  74,  75,  78,  79,  82,  83,  86,  87,  90,  91,
+     94,  95,  98,  99, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 37
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  23,  24,  27,  31,  35,  39,  43,  47,  51,  55,
+     59,  63,  64,  67,  68,  71,  72,  75,  76,  79,  80,  83,  84,  87,  88,  91,
+     92,  95,  96,  99, 100, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 38
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  24,  25,  29,  33,  37,  41,  45,  49,  53,
+     57,  61,  64,  65,  68,  69,  72,  73,  76,  77,  80,  81,  84,  85,  88,  89,
+     92,  93,  96,  97, 100, 101, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 39
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  25,  26,  30,  34,  38,  42,  46,  50,
+     54,  58,  62,  65,  66,  69,  70,  73,  74,  77,  78,  81,  82,  85,  86,  89,
+     90,  93,  94,  97,  98, 101, 102, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 40
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  26,  27,  31,  35,  39,  43,  47,
+     51,  55,  59,  63,  66,  67,  70,  71,  74,  75,  78,  79,  82,  83,  86,  87,
+     90,  91,  94,  95,  98,  99, 102, 103, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 41
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  27,  31,  35,  39,  43,  47,
+     51,  55,  59,  63,  64,  67,  68,  71,  72,  75,  76,  79,  80,  83,  84,  87,
+     88,  91,  92,  95,  96,  99, 100, 103, 104, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 42
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  29,  33,  37,  41,  45,
+     49,  53,  57,  61,  64,  65,  68,  69,  72,  73,  76,  77,  80,  81,  84,  85,
+     88,  89,  92,  93,  96,  97, 100, 101, 104, 105, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 43
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  30,  34,  38,  42,
+     46,  50,  54,  58,  62,  65,  66,  69,  70,  73,  74,  77,  78,  81,  82,  85,
+     86,  89,  90,  93,  94,  97,  98, 101, 102, 105, 106, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 44
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  14,  15,  18,
+     19,  22,  23,  26,  27,  31,  35,  39,  43,  47,  51,  55,  59,  63,  66,  67,
+     70,  71,  74,  75,  78,  79,  82,  83,  86,  87,  90,  91,  94,  95,  98,  99,
+    102, 103, 106, 107, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+    121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 45
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  15,  16,
+     19,  20,  23,  24,  27,  31,  35,  39,  43,  47,  51,  55,  59,  63,  64,  67,
+     68,  71,  72,  75,  76,  79,  80,  83,  84,  87,  88,  91,  92,  95,  96,  99,
+    100, 103, 104, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+    120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 46
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  16,
+     17,  20,  21,  24,  25,  29,  33,  37,  41,  45,  49,  53,  57,  61,  64,  65,
+     68,  69,  72,  73,  76,  77,  80,  81,  84,  85,  88,  89,  92,  93,  96,  97,
+    100, 101, 104, 105, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+    120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 47
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     17,  18,  21,  22,  25,  26,  30,  34,  38,  42,  46,  50,  54,  58,  62,  65,
+     66,  69,  70,  73,  74,  77,  78,  81,  82,  85,  86,  89,  90,  93,  94,  97,
+     98, 101, 102, 105, 106, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+    120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 48
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  18,  19,  22,  23,  26,  27,  31,  35,  39,  43,  47,  51,  55,  59,  63,
+     66,  67,  70,  71,  74,  75,  78,  79,  82,  83,  86,  87,  90,  91,  94,  95,
+     98,  99, 102, 103, 106, 107, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118,
+    119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 49
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  19,  20,  23,  24,  27,  31,  35,  39,  43,  47,  51,  55,  59,  63,
+     64,  67,  68,  71,  72,  75,  76,  79,  80,  83,  84,  87,  88,  91,  92,  95,
+     96,  99, 100, 103, 104, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+    118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 50
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  20,  21,  24,  25,  29,  33,  37,  41,  45,  49,  53,  57,  61,
+     64,  65,  68,  69,  72,  73,  76,  77,  80,  81,  84,  85,  88,  89,  92,  93,
+     96,  97, 100, 101, 104, 105, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+    118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 51
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  21,  22,  25,  26,  30,  34,  38,  42,  46,  50,  54,  58,
+     62,  65,  66,  69,  70,  73,  74,  77,  78,  81,  82,  85,  86,  89,  90,  93,
+     94,  97,  98, 101, 102, 105, 106, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+    118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 52
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  29,  30,  31,  34,
+     35,  38,  39,  42,  43,  46,  47,  50,  51,  54,  55,  58,  59,  62,  63,  65,
+     66,  67,  69,  70,  71,  73,  74,  75,  77,  78,  79,  81,  82,  83,  85,  86,
+     87,  89,  90,  91,  93,  94,  95,  96,  97,  98,  99, 100, 101, 102, 103, 104,
+    105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+    121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 53
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  25,  26,  27,  30,  31,  34,  35,  38,
+     39,  42,  43,  46,  47,  50,  51,  54,  55,  58,  59,  62,  63,  65,  66,  67,
+     69,  70,  71,  73,  74,  75,  77,  78,  79,  81,  82,  83,  85,  86,  87,  89,
+     90,  91,  93,  94,  95,  97,  98,  99, 101, 102, 103, 104, 105, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 54
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  26,  27,  30,  31,  34,  35,  38,
+     39,  42,  43,  46,  47,  50,  51,  54,  55,  58,  59,  62,  63,  64,  66,  67,
+     68,  70,  71,  72,  74,  75,  76,  78,  79,  80,  82,  83,  84,  86,  87,  88,
+     90,  91,  92,  94,  95,  96,  98,  99, 100, 102, 103, 104, 105, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 55
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  27,  29,  31,  33,  35,  37,
+     39,  41,  43,  45,  47,  49,  51,  53,  55,  57,  59,  61,  63,  64,  65,  67,
+     68,  69,  71,  72,  73,  75,  76,  77,  79,  80,  81,  83,  84,  85,  87,  88,
+     89,  91,  92,  93,  95,  96,  97,  99, 100, 101, 103, 104, 105, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 56
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  29,  30,  33,  34,  37,
+     38,  41,  42,  45,  46,  49,  50,  53,  54,  57,  58,  61,  62,  64,  65,  66,
+     68,  69,  70,  72,  73,  74,  76,  77,  78,  80,  81,  82,  84,  85,  86,  88,
+     89,  90,  92,  93,  94,  96,  97,  98, 100, 101, 102, 104, 105, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 57
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  30,  31,  34,  35,
+     38,  39,  42,  43,  46,  47,  50,  51,  54,  55,  58,  59,  62,  63,  65,  66,
+     67,  69,  70,  71,  73,  74,  75,  77,  78,  79,  81,  82,  83,  85,  86,  87,
+     89,  90,  91,  93,  94,  95,  97,  98,  99, 101, 102, 103, 105, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 58
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  30,  31,  34,  35,
+     38,  39,  42,  43,  46,  47,  50,  51,  54,  55,  58,  59,  62,  63,  64,  66,
+     67,  68,  70,  71,  72,  74,  75,  76,  78,  79,  80,  82,  83,  84,  86,  87,
+     88,  90,  91,  92,  94,  95,  96,  98,  99, 100, 102, 103, 104, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 59
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  29,  31,  33,  35,
+     37,  39,  41,  43,  45,  47,  49,  51,  53,  55,  57,  59,  61,  63,  64,  65,
+     67,  68,  69,  71,  72,  73,  75,  76,  77,  79,  80,  81,  83,  84,  85,  87,
+     88,  89,  91,  92,  93,  95,  96,  97,  99, 100, 101, 103, 104, 105, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 60
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  29,  30,  33,  34,
+     37,  38,  41,  42,  45,  46,  49,  50,  53,  54,  57,  58,  61,  62,  64,  65,
+     66,  68,  69,  70,  72,  73,  74,  76,  77,  78,  80,  81,  82,  84,  85,  86,
+     88,  89,  90,  92,  93,  94,  96,  97,  98, 100, 101, 102, 104, 105, 106, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 61
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     17,  18,  19,  21,  22,  23,  25,  26,  27,  30,  31,  34,  35,  38,  39,  42,
+     43,  46,  47,  50,  51,  54,  55,  58,  59,  62,  63,  65,  66,  67,  69,  70,
+     71,  73,  74,  75,  77,  78,  79,  81,  82,  83,  85,  86,  87,  89,  90,  91,
+     93,  94,  95,  97,  98,  99, 101, 102, 103, 105, 106, 107, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 62
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  18,  19,  20,  22,  23,  24,  26,  27,  30,  31,  34,  35,  38,  39,  42,
+     43,  46,  47,  50,  51,  54,  55,  58,  59,  62,  63,  64,  66,  67,  68,  70,
+     71,  72,  74,  75,  76,  78,  79,  80,  82,  83,  84,  86,  87,  88,  90,  91,
+     92,  94,  95,  96,  98,  99, 100, 102, 103, 104, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 63
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  19,  20,  21,  23,  24,  25,  27,  29,  31,  33,  35,  37,  39,  41,
+     43,  45,  47,  49,  51,  53,  55,  57,  59,  61,  63,  64,  65,  67,  68,  69,
+     71,  72,  73,  75,  76,  77,  79,  80,  81,  83,  84,  85,  87,  88,  89,  91,
+     92,  93,  95,  96,  97,  99, 100, 101, 103, 104, 105, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 64
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  20,  21,  22,  24,  25,  26,  29,  30,  33,  34,  37,  38,  41,
+     42,  45,  46,  49,  50,  53,  54,  57,  58,  61,  62,  64,  65,  66,  68,  69,
+     70,  72,  73,  74,  76,  77,  78,  80,  81,  82,  84,  85,  86,  88,  89,  90,
+     92,  93,  94,  96,  97,  98, 100, 101, 102, 104, 105, 106, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 65
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  21,  22,  23,  25,  26,  27,  30,  31,  34,  35,  38,  39,
+     42,  43,  46,  47,  50,  51,  54,  55,  58,  59,  62,  63,  65,  66,  67,  69,
+     70,  71,  73,  74,  75,  77,  78,  79,  81,  82,  83,  85,  86,  87,  89,  90,
+     91,  93,  94,  95,  97,  98,  99, 101, 102, 103, 105, 106, 107, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 66
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  22,  23,  24,  26,  27,  30,  31,  34,  35,  38,  39,
+     42,  43,  46,  47,  50,  51,  54,  55,  58,  59,  62,  63,  64,  66,  67,  68,
+     70,  71,  72,  74,  75,  76,  78,  79,  80,  82,  83,  84,  86,  87,  88,  90,
+     91,  92,  94,  95,  96,  98,  99, 100, 102, 103, 104, 106, 107, 108, 109, 110,
+    111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 67
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  23,  24,  25,  27,  29,  31,  33,  35,  37,  39,
+     41,  43,  45,  47,  49,  51,  53,  55,  57,  59,  61,  63,  64,  65,  67,  68,
+     69,  71,  72,  73,  75,  76,  77,  79,  80,  81,  83,  84,  85,  87,  88,  89,
+     91,  92,  93,  95,  96,  97,  99, 100, 101, 103, 104, 105, 107, 108, 109, 110,
+    111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 68
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  24,  25,  26,  29,  30,  33,  34,  37,  38,
+     41,  42,  45,  46,  49,  50,  53,  54,  57,  58,  61,  62,  64,  65,  66,  68,
+     69,  70,  72,  73,  74,  76,  77,  78,  80,  81,  82,  84,  85,  86,  88,  89,
+     90,  92,  93,  94,  96,  97,  98, 100, 101, 102, 104, 105, 106, 108, 109, 110,
+    111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 69
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  29,  30,  34,  38,
+     42,  46,  50,  54,  58,  62,  64,  66,  68,  70,  72,  74,  76,  78,  80,  82,
+     84,  86,  88,  90,  92,  94,  95,  96,  97,  98,  99, 100, 101, 102, 103, 104,
+    105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+    121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 70
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  24,  26,  30,  34,  38,  42,  46,  50,  54,
+     58,  62,  64,  66,  68,  70,  72,  74,  76,  78,  80,  82,  84,  86,  88,  90,
+     92,  94,  96,  98, 100, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 71
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  25,  27,  31,  35,  39,  43,  47,  51,
+     55,  59,  63,  65,  67,  69,  71,  73,  75,  77,  79,  81,  83,  85,  87,  89,
+     91,  93,  95,  97,  99, 101, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 72
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  26,  30,  34,  38,  42,  46,  50,
+     54,  58,  62,  64,  66,  68,  70,  72,  74,  76,  78,  80,  82,  84,  86,  88,
+     90,  92,  94,  96,  98, 100, 102, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 73
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  27,  31,  35,  39,  43,  47,
+     51,  55,  59,  63,  65,  67,  69,  71,  73,  75,  77,  79,  81,  83,  85,  87,
+     89,  91,  93,  95,  97,  99, 101, 103, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 74
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  30,  34,  38,  42,  46,
+     50,  54,  58,  62,  64,  66,  68,  70,  72,  74,  76,  78,  80,  82,  84,  86,
+     88,  90,  92,  94,  96,  98, 100, 102, 104, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 75
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  31,  35,  39,  43,
+     47,  51,  55,  59,  63,  65,  67,  69,  71,  73,  75,  77,  79,  81,  83,  85,
+     87,  89,  91,  93,  95,  97,  99, 101, 103, 105, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 76
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  30,  34,  38,  42,
+     46,  50,  54,  58,  62,  64,  66,  68,  70,  72,  74,  76,  78,  80,  82,  84,
+     86,  88,  90,  92,  94,  96,  98, 100, 102, 104, 106, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 77
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  29,  31,  35,  39,
+     43,  47,  51,  55,  59,  63,  65,  67,  69,  71,  73,  75,  77,  79,  81,  83,
+     85,  87,  89,  91,  93,  95,  97,  99, 101, 103, 105, 107, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 78
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  16,
+     18,  20,  22,  24,  26,  30,  34,  38,  42,  46,  50,  54,  58,  62,  64,  66,
+     68,  70,  72,  74,  76,  78,  80,  82,  84,  86,  88,  90,  92,  94,  96,  98,
+    100, 102, 104, 106, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+    120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 79
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     17,  19,  21,  23,  25,  27,  31,  35,  39,  43,  47,  51,  55,  59,  63,  65,
+     67,  69,  71,  73,  75,  77,  79,  81,  83,  85,  87,  89,  91,  93,  95,  97,
+     99, 101, 103, 105, 107, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+    120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 80
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  18,  20,  22,  24,  26,  30,  34,  38,  42,  46,  50,  54,  58,  62,  64,
+     66,  68,  70,  72,  74,  76,  78,  80,  82,  84,  86,  88,  90,  92,  94,  96,
+     98, 100, 102, 104, 106, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118,
+    119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 81
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  19,  21,  23,  25,  27,  31,  35,  39,  43,  47,  51,  55,  59,  63,
+     65,  67,  69,  71,  73,  75,  77,  79,  81,  83,  85,  87,  89,  91,  93,  95,
+     97,  99, 101, 103, 105, 107, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118,
+    119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 82
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  20,  22,  24,  26,  30,  34,  38,  42,  46,  50,  54,  58,  62,
+     64,  66,  68,  70,  72,  74,  76,  78,  80,  82,  84,  86,  88,  90,  92,  94,
+     96,  98, 100, 102, 104, 106, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+    118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 83
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  21,  23,  25,  27,  31,  35,  39,  43,  47,  51,  55,  59,
+     63,  65,  67,  69,  71,  73,  75,  77,  79,  81,  83,  85,  87,  89,  91,  93,
+     95,  97,  99, 101, 103, 105, 107, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+    118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 84
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  22,  24,  26,  30,  34,  38,  42,  46,  50,  54,  58,
+     62,  64,  66,  68,  70,  72,  74,  76,  78,  80,  82,  84,  86,  88,  90,  92,
+     94,  96,  98, 100, 102, 104, 106, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 85
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  23,  25,  27,  31,  35,  39,  43,  47,  51,  55,
+     59,  63,  65,  67,  69,  71,  73,  75,  77,  79,  81,  83,  85,  87,  89,  91,
+     93,  95,  97,  99, 101, 103, 105, 107, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 86
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  29,  30,  33,  34,
+     37,  38,  41,  42,  45,  46,  49,  50,  53,  54,  57,  58,  61,  62,  64,  65,
+     66,  68,  69,  70,  72,  73,  74,  76,  77,  78,  80,  81,  82,  84,  85,  86,
+     88,  89,  90,  92,  93,  94,  95,  96,  97,  98,  99, 100, 101, 102, 103, 104,
+    105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+    121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 87
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  24,  25,  26,  29,  30,  33,  34,  37,  38,
+     41,  42,  45,  46,  49,  50,  53,  54,  57,  58,  61,  62,  64,  65,  66,  68,
+     69,  70,  72,  73,  74,  76,  77,  78,  80,  81,  82,  84,  85,  86,  88,  89,
+     90,  92,  93,  94,  96,  97,  98, 100, 101, 102, 103, 104, 105, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 88
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  25,  26,  27,  30,  31,  34,  35,  38,
+     39,  42,  43,  46,  47,  50,  51,  54,  55,  58,  59,  62,  63,  65,  66,  67,
+     69,  70,  71,  73,  74,  75,  77,  78,  79,  81,  82,  83,  85,  86,  87,  89,
+     90,  91,  93,  94,  95,  97,  98,  99, 101, 102, 103, 104, 105, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 89
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  26,  27,  30,  31,  34,  35,  38,
+     39,  42,  43,  46,  47,  50,  51,  54,  55,  58,  59,  62,  63,  64,  66,  67,
+     68,  70,  71,  72,  74,  75,  76,  78,  79,  80,  82,  83,  84,  86,  87,  88,
+     90,  91,  92,  94,  95,  96,  98,  99, 100, 102, 103, 104, 105, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 90
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  27,  29,  31,  33,  35,  37,
+     39,  41,  43,  45,  47,  49,  51,  53,  55,  57,  59,  61,  63,  64,  65,  67,
+     68,  69,  71,  72,  73,  75,  76,  77,  79,  80,  81,  83,  84,  85,  87,  88,
+     89,  91,  92,  93,  95,  96,  97,  99, 100, 101, 103, 104, 105, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 91
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  29,  30,  33,  34,  37,
+     38,  41,  42,  45,  46,  49,  50,  53,  54,  57,  58,  61,  62,  64,  65,  66,
+     68,  69,  70,  72,  73,  74,  76,  77,  78,  80,  81,  82,  84,  85,  86,  88,
+     89,  90,  92,  93,  94,  96,  97,  98, 100, 101, 102, 104, 105, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 92
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  30,  31,  34,  35,
+     38,  39,  42,  43,  46,  47,  50,  51,  54,  55,  58,  59,  62,  63,  65,  66,
+     67,  69,  70,  71,  73,  74,  75,  77,  78,  79,  81,  82,  83,  85,  86,  87,
+     89,  90,  91,  93,  94,  95,  97,  98,  99, 101, 102, 103, 105, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 93
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  30,  31,  34,  35,
+     38,  39,  42,  43,  46,  47,  50,  51,  54,  55,  58,  59,  62,  63,  64,  66,
+     67,  68,  70,  71,  72,  74,  75,  76,  78,  79,  80,  82,  83,  84,  86,  87,
+     88,  90,  91,  92,  94,  95,  96,  98,  99, 100, 102, 103, 104, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 94
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  29,  31,  33,  35,
+     37,  39,  41,  43,  45,  47,  49,  51,  53,  55,  57,  59,  61,  63,  64,  65,
+     67,  68,  69,  71,  72,  73,  75,  76,  77,  79,  80,  81,  83,  84,  85,  87,
+     88,  89,  91,  92,  93,  95,  96,  97,  99, 100, 101, 103, 104, 105, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 95
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  16,
+     17,  18,  20,  21,  22,  24,  25,  26,  29,  30,  33,  34,  37,  38,  41,  42,
+     45,  46,  49,  50,  53,  54,  57,  58,  61,  62,  64,  65,  66,  68,  69,  70,
+     72,  73,  74,  76,  77,  78,  80,  81,  82,  84,  85,  86,  88,  89,  90,  92,
+     93,  94,  96,  97,  98, 100, 101, 102, 104, 105, 106, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 96
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     17,  18,  19,  21,  22,  23,  25,  26,  27,  30,  31,  34,  35,  38,  39,  42,
+     43,  46,  47,  50,  51,  54,  55,  58,  59,  62,  63,  65,  66,  67,  69,  70,
+     71,  73,  74,  75,  77,  78,  79,  81,  82,  83,  85,  86,  87,  89,  90,  91,
+     93,  94,  95,  97,  98,  99, 101, 102, 103, 105, 106, 107, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 97
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  18,  19,  20,  22,  23,  24,  26,  27,  30,  31,  34,  35,  38,  39,  42,
+     43,  46,  47,  50,  51,  54,  55,  58,  59,  62,  63,  64,  66,  67,  68,  70,
+     71,  72,  74,  75,  76,  78,  79,  80,  82,  83,  84,  86,  87,  88,  90,  91,
+     92,  94,  95,  96,  98,  99, 100, 102, 103, 104, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 98
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  19,  20,  21,  23,  24,  25,  27,  29,  31,  33,  35,  37,  39,  41,
+     43,  45,  47,  49,  51,  53,  55,  57,  59,  61,  63,  64,  65,  67,  68,  69,
+     71,  72,  73,  75,  76,  77,  79,  80,  81,  83,  84,  85,  87,  88,  89,  91,
+     92,  93,  95,  96,  97,  99, 100, 101, 103, 104, 105, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 99
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  20,  21,  22,  24,  25,  26,  29,  30,  33,  34,  37,  38,  41,
+     42,  45,  46,  49,  50,  53,  54,  57,  58,  61,  62,  64,  65,  66,  68,  69,
+     70,  72,  73,  74,  76,  77,  78,  80,  81,  82,  84,  85,  86,  88,  89,  90,
+     92,  93,  94,  96,  97,  98, 100, 101, 102, 104, 105, 106, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 100
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  21,  22,  23,  25,  26,  27,  30,  31,  34,  35,  38,  39,
+     42,  43,  46,  47,  50,  51,  54,  55,  58,  59,  62,  63,  65,  66,  67,  69,
+     70,  71,  73,  74,  75,  77,  78,  79,  81,  82,  83,  85,  86,  87,  89,  90,
+     91,  93,  94,  95,  97,  98,  99, 101, 102, 103, 105, 106, 107, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 101
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  22,  23,  24,  26,  27,  30,  31,  34,  35,  38,  39,
+     42,  43,  46,  47,  50,  51,  54,  55,  58,  59,  62,  63,  64,  66,  67,  68,
+     70,  71,  72,  74,  75,  76,  78,  79,  80,  82,  83,  84,  86,  87,  88,  90,
+     91,  92,  94,  95,  96,  98,  99, 100, 102, 103, 104, 106, 107, 108, 109, 110,
+    111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 102
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  23,  24,  25,  27,  29,  31,  33,  35,  37,  39,
+     41,  43,  45,  47,  49,  51,  53,  55,  57,  59,  61,  63,  64,  65,  67,  68,
+     69,  71,  72,  73,  75,  76,  77,  79,  80,  81,  83,  84,  85,  87,  88,  89,
+     91,  92,  93,  95,  96,  97,  99, 100, 101, 103, 104, 105, 107, 108, 109, 110,
+    111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 103
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  29,  30,  33,  34,
+     35,  37,  38,  41,  42,  43,  45,  46,  49,  50,  51,  53,  54,  57,  58,  59,
+     61,  62,  64,  65,  66,  67,  68,  69,  70,  72,  73,  74,  75,  76,  77,  78,
+     80,  81,  82,  83,  84,  85,  86,  88,  89,  90,  91,  92,  93,  94,  95,  96,
+     97,  98,  99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 104
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  24,  25,  26,  27,  29,  30,  33,  34,  35,
+     37,  38,  41,  42,  43,  45,  46,  49,  50,  51,  53,  54,  57,  58,  59,  61,
+     62,  64,  65,  66,  67,  68,  69,  70,  72,  73,  74,  75,  76,  77,  78,  80,
+     81,  82,  83,  84,  85,  86,  88,  89,  90,  91,  92,  93,  94,  96,  97,  98,
+     99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
+    115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 105
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  25,  26,  27,  29,  30,  31,  34,  35,
+     37,  38,  39,  42,  43,  45,  46,  47,  50,  51,  53,  54,  55,  58,  59,  61,
+     62,  63,  65,  66,  67,  68,  69,  70,  71,  73,  74,  75,  76,  77,  78,  79,
+     81,  82,  83,  84,  85,  86,  87,  89,  90,  91,  92,  93,  94,  95,  97,  98,
+     99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
+    115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 106
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  26,  27,  29,  30,  31,  34,  35,
+     37,  38,  39,  42,  43,  45,  46,  47,  50,  51,  53,  54,  55,  58,  59,  61,
+     62,  63,  64,  66,  67,  68,  69,  70,  71,  72,  74,  75,  76,  77,  78,  79,
+     80,  82,  83,  84,  85,  86,  87,  88,  90,  91,  92,  93,  94,  95,  96,  98,
+     99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
+    115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 107
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  27,  29,  30,  31,  33,  35,
+     37,  38,  39,  41,  43,  45,  46,  47,  49,  51,  53,  54,  55,  57,  59,  61,
+     62,  63,  64,  65,  67,  68,  69,  70,  71,  72,  73,  75,  76,  77,  78,  79,
+     80,  81,  83,  84,  85,  86,  87,  88,  89,  91,  92,  93,  94,  95,  96,  97,
+     99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
+    115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 108
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  29,  30,  31,  33,  34,
+     37,  38,  39,  41,  42,  45,  46,  47,  49,  50,  53,  54,  55,  57,  58,  61,
+     62,  63,  64,  65,  66,  68,  69,  70,  71,  72,  73,  74,  76,  77,  78,  79,
+     80,  81,  82,  84,  85,  86,  87,  88,  89,  90,  92,  93,  94,  95,  96,  97,
+     98, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
+    115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 109
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  30,  31,  33,  34,
+     35,  38,  39,  41,  42,  43,  46,  47,  49,  50,  51,  54,  55,  57,  58,  59,
+     62,  63,  64,  65,  66,  67,  69,  70,  71,  72,  73,  74,  75,  77,  78,  79,
+     80,  81,  82,  83,  85,  86,  87,  88,  89,  90,  91,  93,  94,  95,  96,  97,
+     98,  99, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
+    115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 110
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  30,  31,  33,  34,
+     35,  38,  39,  41,  42,  43,  46,  47,  49,  50,  51,  54,  55,  57,  58,  59,
+     62,  63,  64,  65,  66,  67,  68,  70,  71,  72,  73,  74,  75,  76,  78,  79,
+     80,  81,  82,  83,  84,  86,  87,  88,  89,  90,  91,  92,  94,  95,  96,  97,
+     98,  99, 100, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
+    115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 111
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  29,  31,  33,  34,
+     35,  37,  39,  41,  42,  43,  45,  47,  49,  50,  51,  53,  55,  57,  58,  59,
+     61,  63,  64,  65,  66,  67,  68,  69,  71,  72,  73,  74,  75,  76,  77,  79,
+     80,  81,  82,  83,  84,  85,  87,  88,  89,  90,  91,  92,  93,  95,  96,  97,
+     98,  99, 100, 101, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
+    115, 116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 112
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  16,
+     17,  18,  19,  20,  21,  22,  24,  25,  26,  27,  29,  30,  33,  34,  35,  37,
+     38,  41,  42,  43,  45,  46,  49,  50,  51,  53,  54,  57,  58,  59,  61,  62,
+     64,  65,  66,  67,  68,  69,  70,  72,  73,  74,  75,  76,  77,  78,  80,  81,
+     82,  83,  84,  85,  86,  88,  89,  90,  91,  92,  93,  94,  96,  97,  98,  99,
+    100, 101, 102, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 113
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     17,  18,  19,  20,  21,  22,  23,  25,  26,  27,  29,  30,  31,  34,  35,  37,
+     38,  39,  42,  43,  45,  46,  47,  50,  51,  53,  54,  55,  58,  59,  61,  62,
+     63,  65,  66,  67,  68,  69,  70,  71,  73,  74,  75,  76,  77,  78,  79,  81,
+     82,  83,  84,  85,  86,  87,  89,  90,  91,  92,  93,  94,  95,  97,  98,  99,
+    100, 101, 102, 103, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 114
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  18,  19,  20,  21,  22,  23,  24,  26,  27,  29,  30,  31,  34,  35,  37,
+     38,  39,  42,  43,  45,  46,  47,  50,  51,  53,  54,  55,  58,  59,  61,  62,
+     63,  64,  66,  67,  68,  69,  70,  71,  72,  74,  75,  76,  77,  78,  79,  80,
+     82,  83,  84,  85,  86,  87,  88,  90,  91,  92,  93,  94,  95,  96,  98,  99,
+    100, 101, 102, 103, 104, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 115
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  19,  20,  21,  22,  23,  24,  25,  27,  29,  30,  31,  33,  35,  37,
+     38,  39,  41,  43,  45,  46,  47,  49,  51,  53,  54,  55,  57,  59,  61,  62,
+     63,  64,  65,  67,  68,  69,  70,  71,  72,  73,  75,  76,  77,  78,  79,  80,
+     81,  83,  84,  85,  86,  87,  88,  89,  91,  92,  93,  94,  95,  96,  97,  99,
+    100, 101, 102, 103, 104, 105, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 116
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  20,  21,  22,  23,  24,  25,  26,  29,  30,  31,  33,  34,  37,
+     38,  39,  41,  42,  45,  46,  47,  49,  50,  53,  54,  55,  57,  58,  61,  62,
+     63,  64,  65,  66,  68,  69,  70,  71,  72,  73,  74,  76,  77,  78,  79,  80,
+     81,  82,  84,  85,  86,  87,  88,  89,  90,  92,  93,  94,  95,  96,  97,  98,
+    100, 101, 102, 103, 104, 105, 106, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 117
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  21,  22,  23,  24,  25,  26,  27,  30,  31,  33,  34,  35,
+     38,  39,  41,  42,  43,  46,  47,  49,  50,  51,  54,  55,  57,  58,  59,  62,
+     63,  64,  65,  66,  67,  69,  70,  71,  72,  73,  74,  75,  77,  78,  79,  80,
+     81,  82,  83,  85,  86,  87,  88,  89,  90,  91,  93,  94,  95,  96,  97,  98,
+     99, 101, 102, 103, 104, 105, 106, 107, 109, 110, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 118
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  22,  23,  24,  25,  26,  27,  30,  31,  33,  34,  35,
+     38,  39,  41,  42,  43,  46,  47,  49,  50,  51,  54,  55,  57,  58,  59,  62,
+     63,  64,  65,  66,  67,  68,  70,  71,  72,  73,  74,  75,  76,  78,  79,  80,
+     81,  82,  83,  84,  86,  87,  88,  89,  90,  91,  92,  94,  95,  96,  97,  98,
+     99, 100, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+    116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // Row 119
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  23,  24,  25,  26,  27,  29,  31,  33,  34,  35,
+     37,  39,  41,  42,  43,  45,  47,  49,  50,  51,  53,  55,  57,  58,  59,  61,
+     63,  64,  65,  66,  67,  68,  69,  71,  72,  73,  74,  75,  76,  77,  79,  80,
+     81,  82,  83,  84,  85,  87,  88,  89,  90,  91,  92,  93,  95,  96,  97,  98,
+     99, 100, 101, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+    116, 117, 118, 119, 120, 121, 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+};
+
+const UBYTE antic2cpu[CPU2ANTIC_SIZE * CYCLE_MAP_ROWS] =
+{
+    // Row 0
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  29,  30,
+     31,  31,  32,  33,  34,  34,  35,  36,  37,  37,  38,  39,  40,  40,  41,  42,
+     43,  43,  44,  45,  46,  46,  47,  48,  49,  49,  50,  51,  52,  52,  53,  54,
+     55,  56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,
+     71,  72,  73,  74,  75,  76,  77,  78,  79,  80,  81,  82,  83,  84,  85,  86,
+     87,  88,  89,  90,  91,  92,  93,  94,  95,  96,  97,  98,  99, 100, 101, 102,
+    103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
+    // Row 1
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  28,  29,
+     29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,
+     29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,
+     29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,
+     29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,  29,
+     30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,
+     46,  47,  48,  49,  50,  51,  52,  53,  54,  55,  56,
+    // Row 2
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  21,  22,  22,  22,  22,  22,  22,  22,  22,  22,
+     22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,
+     22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,
+     22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,
+     22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,  22,
+     22,  22,  22,  22,  22,  22,  22,  22,  23,  24,  25,  26,  27,  28,  29,  30,
+     31,  32,  33,  34,  35,  36,  37,  38,  39,  40,  41,
+    // Row 3
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  22,  23,  23,  23,  23,  23,  23,  23,  23,
+     23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,
+     23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,
+     23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,
+     23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,  23,
+     23,  23,  23,  23,  23,  23,  23,  23,  23,  24,  25,  26,  27,  28,  29,  30,
+     31,  32,  33,  34,  35,  36,  37,  38,  39,  40,  41,
+    // Row 4
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  23,  24,  24,  24,  24,  24,  24,  24,
+     24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,
+     24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,
+     24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,
+     24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,
+     24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  25,  26,  27,  28,  29,  30,
+     31,  32,  33,  34,  35,  36,  37,  38,  39,  40,  41,
+    // Row 5
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  24,  25,  25,  25,  25,  25,  25,
+     25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,
+     25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,
+     25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,
+     25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,
+     25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  25,  26,  27,  28,  29,  30,
+     31,  32,  33,  34,  35,  36,  37,  38,  39,  40,  41,
+    // Row 6
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  25,  26,  26,  26,  26,  26,
+     26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+     26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+     26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+     26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+     26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  27,  28,  29,  30,
+     31,  32,  33,  34,  35,  36,  37,  38,  39,  40,  41,
+    // Row 7
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  26,  27,  27,  27,  27,
+     27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,
+     27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,
+     27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,
+     27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,
+     27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  28,  29,  30,
+     31,  32,  33,  34,  35,  36,  37,  38,  39,  40,  41,
+    // Row 8
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  27,  27,  27,  27,
+     27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,
+     27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,
+     27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,
+     27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,
+     27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  27,  28,  29,
+     30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,
+    // Row 9
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  28,  28,
+     28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,
+     28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,
+     28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,
+     28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,
+     28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  28,  29,  30,
+     31,  32,  33,  34,  35,  36,  37,  38,  39,  40,  41,
+    // Row 10
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  13,  14,
+     14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,
+     14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,
+     14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,
+     14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,
+     14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,
+     14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,
+    // Row 11
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  14,
+     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,
+     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,
+     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,
+     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,
+     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,
+     15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  15,  16,
+     17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,
+    // Row 12
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     15,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,
+     16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,
+     16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,
+     16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,
+     16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,
+     16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  16,  17,
+     18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,
+    // Row 13
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  16,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+     17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+     17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+     17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+     17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,
+     17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  17,  18,
+     19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,
+    // Row 14
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  17,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,
+     18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,
+     18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,
+     18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,
+     18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,
+     18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  18,  19,
+     20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,
+    // Row 15
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  18,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,
+     19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,
+     19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,
+     19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,
+     19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,
+     19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  19,  20,
+     21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,
+    // Row 16
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  19,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,
+     20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,
+     20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,
+     20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,
+     20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,
+     20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  20,  21,
+     22,  23,  24,  25,  26,  27,  28,  29,  30,  31,  32,
+    // Row 17
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  20,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,
+     21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,
+     21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,
+     21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,
+     21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,
+     21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  21,  22,
+     23,  24,  25,  26,  27,  28,  29,  30,  31,  32,  33,
+    // Row 18
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  29,  30,
+     31,  31,  31,  31,  32,  32,  32,  32,  33,  33,  33,  33,  34,  34,  34,  34,
+     35,  35,  35,  35,  36,  36,  36,  36,  37,  37,  37,  37,  38,  38,  38,  38,
+     39,  39,  40,  40,  41,  41,  42,  42,  43,  43,  44,  44,  45,  45,  46,  46,
+     47,  47,  48,  48,  49,  49,  50,  50,  51,  51,  52,  52,  53,  53,  54,  54,
+     55,  56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,
+     71,  72,  73,  74,  75,  76,  77,  78,  79,  80,  81,
+    // Row 19
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  24,  25,  25,  26,  26,  26,  26,
+     27,  27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,
+     31,  31,  31,  31,  32,  32,  32,  32,  33,  33,  33,  33,  34,  34,  34,  34,
+     35,  35,  36,  36,  37,  37,  38,  38,  39,  39,  40,  40,  41,  41,  42,  42,
+     43,  43,  44,  44,  45,  45,  46,  46,  47,  47,  48,  48,  49,  49,  50,  50,
+     51,  51,  52,  52,  53,  53,  54,  54,  55,  56,  57,  58,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 20
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  25,  26,  26,  26,  26,  27,
+     27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,  31,
+     31,  31,  31,  32,  32,  32,  32,  33,  33,  33,  33,  34,  34,  34,  34,  35,
+     35,  36,  36,  37,  37,  38,  38,  39,  39,  40,  40,  41,  41,  42,  42,  43,
+     43,  44,  44,  45,  45,  46,  46,  47,  47,  48,  48,  49,  49,  50,  50,  51,
+     51,  52,  52,  53,  53,  54,  54,  55,  55,  56,  57,  58,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 21
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  26,  27,  27,  27,  27,
+     28,  28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,
+     32,  32,  32,  32,  33,  33,  33,  33,  34,  34,  34,  34,  35,  35,  35,  35,
+     36,  36,  37,  37,  38,  38,  39,  39,  40,  40,  41,  41,  42,  42,  43,  43,
+     44,  44,  45,  45,  46,  46,  47,  47,  48,  48,  49,  49,  50,  50,  51,  51,
+     52,  52,  53,  53,  54,  54,  55,  55,  56,  56,  57,  58,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 22
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  27,  27,  27,  28,
+     28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,  32,
+     32,  32,  32,  33,  33,  33,  33,  34,  34,  34,  34,  35,  35,  35,  35,  36,
+     36,  37,  37,  38,  38,  39,  39,  40,  40,  41,  41,  42,  42,  43,  43,  44,
+     44,  45,  45,  46,  46,  47,  47,  48,  48,  49,  49,  50,  50,  51,  51,  52,
+     52,  53,  53,  54,  54,  55,  55,  56,  56,  57,  57,  58,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 23
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  28,  28,
+     29,  29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,
+     33,  33,  33,  33,  34,  34,  34,  34,  35,  35,  35,  35,  36,  36,  36,  36,
+     37,  37,  38,  38,  39,  39,  40,  40,  41,  41,  42,  42,  43,  43,  44,  44,
+     45,  45,  46,  46,  47,  47,  48,  48,  49,  49,  50,  50,  51,  51,  52,  52,
+     53,  53,  54,  54,  55,  55,  56,  56,  57,  57,  58,  58,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 24
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  28,  29,
+     29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,  33,
+     33,  33,  33,  34,  34,  34,  34,  35,  35,  35,  35,  36,  36,  36,  36,  37,
+     37,  38,  38,  39,  39,  40,  40,  41,  41,  42,  42,  43,  43,  44,  44,  45,
+     45,  46,  46,  47,  47,  48,  48,  49,  49,  50,  50,  51,  51,  52,  52,  53,
+     53,  54,  54,  55,  55,  56,  56,  57,  57,  58,  58,  59,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 25
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  29,  29,
+     30,  30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,  33,  33,  33,  33,
+     34,  34,  34,  34,  35,  35,  35,  35,  36,  36,  36,  36,  37,  37,  37,  37,
+     38,  38,  39,  39,  40,  40,  41,  41,  42,  42,  43,  43,  44,  44,  45,  45,
+     46,  46,  47,  47,  48,  48,  49,  49,  50,  50,  51,  51,  52,  52,  53,  53,
+     54,  54,  55,  55,  56,  56,  57,  57,  58,  58,  59,  59,  60,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 26
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  29,  30,
+     30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,  33,  33,  33,  33,  34,
+     34,  34,  34,  35,  35,  35,  35,  36,  36,  36,  36,  37,  37,  37,  37,  38,
+     38,  39,  39,  40,  40,  41,  41,  42,  42,  43,  43,  44,  44,  45,  45,  46,
+     46,  47,  47,  48,  48,  49,  49,  50,  50,  51,  51,  52,  52,  53,  53,  54,
+     54,  55,  55,  56,  56,  57,  57,  58,  58,  59,  59,  60,  60,  61,  62,  63,
+     64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,
+    // Row 27
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  16,  17,  17,  18,  18,  19,  19,  20,  20,  21,  21,  22,  22,  22,  22,
+     23,  23,  23,  23,  24,  24,  24,  24,  25,  25,  25,  25,  26,  26,  26,  26,
+     27,  27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,
+     31,  31,  32,  32,  33,  33,  34,  34,  35,  35,  36,  36,  37,  37,  38,  38,
+     39,  39,  40,  40,  41,  41,  42,  42,  43,  43,  44,  44,  45,  45,  46,  46,
+     47,  47,  48,  48,  49,  49,  50,  50,  51,  51,  52,  52,  53,  53,  54,  55,
+     56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,
+    // Row 28
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  17,  18,  18,  19,  19,  20,  20,  21,  21,  22,  22,  22,  22,  23,
+     23,  23,  23,  24,  24,  24,  24,  25,  25,  25,  25,  26,  26,  26,  26,  27,
+     27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,  31,
+     31,  32,  32,  33,  33,  34,  34,  35,  35,  36,  36,  37,  37,  38,  38,  39,
+     39,  40,  40,  41,  41,  42,  42,  43,  43,  44,  44,  45,  45,  46,  46,  47,
+     47,  48,  48,  49,  49,  50,  50,  51,  51,  52,  52,  53,  53,  54,  55,  56,
+     57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,
+    // Row 29
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  18,  19,  19,  20,  20,  21,  21,  22,  22,  23,  23,  23,  23,
+     24,  24,  24,  24,  25,  25,  25,  25,  26,  26,  26,  26,  27,  27,  27,  27,
+     28,  28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,
+     32,  32,  33,  33,  34,  34,  35,  35,  36,  36,  37,  37,  38,  38,  39,  39,
+     40,  40,  41,  41,  42,  42,  43,  43,  44,  44,  45,  45,  46,  46,  47,  47,
+     48,  48,  49,  49,  50,  50,  51,  51,  52,  52,  53,  53,  54,  54,  55,  56,
+     57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,
+    // Row 30
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  19,  20,  20,  21,  21,  22,  22,  23,  23,  23,  23,  24,
+     24,  24,  24,  25,  25,  25,  25,  26,  26,  26,  26,  27,  27,  27,  27,  28,
+     28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,  32,
+     32,  33,  33,  34,  34,  35,  35,  36,  36,  37,  37,  38,  38,  39,  39,  40,
+     40,  41,  41,  42,  42,  43,  43,  44,  44,  45,  45,  46,  46,  47,  47,  48,
+     48,  49,  49,  50,  50,  51,  51,  52,  52,  53,  53,  54,  54,  55,  56,  57,
+     58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,
+    // Row 31
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  20,  21,  21,  22,  22,  23,  23,  24,  24,  24,  24,
+     25,  25,  25,  25,  26,  26,  26,  26,  27,  27,  27,  27,  28,  28,  28,  28,
+     29,  29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,
+     33,  33,  34,  34,  35,  35,  36,  36,  37,  37,  38,  38,  39,  39,  40,  40,
+     41,  41,  42,  42,  43,  43,  44,  44,  45,  45,  46,  46,  47,  47,  48,  48,
+     49,  49,  50,  50,  51,  51,  52,  52,  53,  53,  54,  54,  55,  55,  56,  57,
+     58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,
+    // Row 32
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  21,  22,  22,  23,  23,  24,  24,  24,  24,  25,
+     25,  25,  25,  26,  26,  26,  26,  27,  27,  27,  27,  28,  28,  28,  28,  29,
+     29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,  33,
+     33,  34,  34,  35,  35,  36,  36,  37,  37,  38,  38,  39,  39,  40,  40,  41,
+     41,  42,  42,  43,  43,  44,  44,  45,  45,  46,  46,  47,  47,  48,  48,  49,
+     49,  50,  50,  51,  51,  52,  52,  53,  53,  54,  54,  55,  55,  56,  57,  58,
+     59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,
+    // Row 33
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  22,  23,  23,  24,  24,  25,  25,  25,  25,
+     26,  26,  26,  26,  27,  27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,
+     30,  30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,  33,  33,  33,  33,
+     34,  34,  35,  35,  36,  36,  37,  37,  38,  38,  39,  39,  40,  40,  41,  41,
+     42,  42,  43,  43,  44,  44,  45,  45,  46,  46,  47,  47,  48,  48,  49,  49,
+     50,  50,  51,  51,  52,  52,  53,  53,  54,  54,  55,  55,  56,  56,  57,  58,
+     59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,
+    // Row 34
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  23,  24,  24,  25,  25,  25,  25,  26,
+     26,  26,  26,  27,  27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,  30,
+     30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,  33,  33,  33,  33,  34,
+     34,  35,  35,  36,  36,  37,  37,  38,  38,  39,  39,  40,  40,  41,  41,  42,
+     42,  43,  43,  44,  44,  45,  45,  46,  46,  47,  47,  48,  48,  49,  49,  50,
+     50,  51,  51,  52,  52,  53,  53,  54,  54,  55,  55,  56,  56,  57,  58,  59,
+     60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,
+    // Row 35
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  28,  29,
+     30,  30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,  33,  33,  33,  33,
+     34,  34,  34,  34,  35,  35,  35,  35,  36,  36,  36,  36,  37,  37,  37,  37,
+     38,  38,  38,  39,  40,  40,  40,  41,  42,  42,  42,  43,  44,  44,  44,  45,
+     46,  46,  46,  47,  48,  48,  48,  49,  50,  50,  50,  51,  52,  52,  53,  54,
+     55,  56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,
+     71,  72,  73,  74,  75,  76,  77,  78,  79,  80,  81,
+    // Row 36
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  21,  22,  23,  23,  23,  24,  25,  25,  25,  25,
+     26,  26,  26,  26,  27,  27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,
+     30,  30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,  33,  33,  33,  33,
+     34,  34,  34,  35,  36,  36,  36,  37,  38,  38,  38,  39,  40,  40,  40,  41,
+     42,  42,  42,  43,  44,  44,  44,  45,  46,  46,  46,  47,  48,  48,  48,  49,
+     50,  50,  50,  51,  52,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 37
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  22,  23,  24,  24,  24,  25,  25,  25,  25,
+     26,  26,  26,  26,  27,  27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,
+     30,  30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,  33,  33,  33,  33,
+     34,  35,  35,  35,  36,  37,  37,  37,  38,  39,  39,  39,  40,  41,  41,  41,
+     42,  43,  43,  43,  44,  45,  45,  45,  46,  47,  47,  47,  48,  49,  49,  49,
+     50,  51,  51,  51,  52,  53,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 38
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  23,  24,  25,  25,  25,  25,  26,  26,
+     26,  26,  27,  27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,  30,  30,
+     30,  30,  31,  31,  31,  31,  32,  32,  32,  32,  33,  33,  33,  33,  34,  34,
+     34,  35,  36,  36,  36,  37,  38,  38,  38,  39,  40,  40,  40,  41,  42,  42,
+     42,  43,  44,  44,  44,  45,  46,  46,  46,  47,  48,  48,  48,  49,  50,  50,
+     50,  51,  52,  52,  52,  53,  54,  54,  55,  56,  57,  58,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 39
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  24,  25,  26,  26,  26,  26,  27,
+     27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,  31,
+     31,  31,  31,  32,  32,  32,  32,  33,  33,  33,  33,  34,  34,  34,  34,  35,
+     35,  35,  36,  37,  37,  37,  38,  39,  39,  39,  40,  41,  41,  41,  42,  43,
+     43,  43,  44,  45,  45,  45,  46,  47,  47,  47,  48,  49,  49,  49,  50,  51,
+     51,  51,  52,  53,  53,  53,  54,  55,  55,  56,  57,  58,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 40
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  25,  26,  27,  27,  27,  27,
+     28,  28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,
+     32,  32,  32,  32,  33,  33,  33,  33,  34,  34,  34,  34,  35,  35,  35,  35,
+     36,  36,  36,  37,  38,  38,  38,  39,  40,  40,  40,  41,  42,  42,  42,  43,
+     44,  44,  44,  45,  46,  46,  46,  47,  48,  48,  48,  49,  50,  50,  50,  51,
+     52,  52,  52,  53,  54,  54,  54,  55,  56,  56,  57,  58,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 41
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  26,  27,  27,  27,  27,
+     28,  28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,
+     32,  32,  32,  32,  33,  33,  33,  33,  34,  34,  34,  34,  35,  35,  35,  35,
+     36,  37,  37,  37,  38,  39,  39,  39,  40,  41,  41,  41,  42,  43,  43,  43,
+     44,  45,  45,  45,  46,  47,  47,  47,  48,  49,  49,  49,  50,  51,  51,  51,
+     52,  53,  53,  53,  54,  55,  55,  55,  56,  57,  57,  58,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 42
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  27,  27,  28,  28,
+     28,  28,  29,  29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,  32,  32,
+     32,  32,  33,  33,  33,  33,  34,  34,  34,  34,  35,  35,  35,  35,  36,  36,
+     36,  37,  38,  38,  38,  39,  40,  40,  40,  41,  42,  42,  42,  43,  44,  44,
+     44,  45,  46,  46,  46,  47,  48,  48,  48,  49,  50,  50,  50,  51,  52,  52,
+     52,  53,  54,  54,  54,  55,  56,  56,  56,  57,  58,  58,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 43
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  28,  29,
+     29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,  33,
+     33,  33,  33,  34,  34,  34,  34,  35,  35,  35,  35,  36,  36,  36,  36,  37,
+     37,  37,  38,  39,  39,  39,  40,  41,  41,  41,  42,  43,  43,  43,  44,  45,
+     45,  45,  46,  47,  47,  47,  48,  49,  49,  49,  50,  51,  51,  51,  52,  53,
+     53,  53,  54,  55,  55,  55,  56,  57,  57,  57,  58,  59,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 44
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  13,  14,
+     15,  15,  15,  16,  17,  17,  17,  18,  19,  19,  19,  20,  21,  21,  21,  21,
+     22,  22,  22,  22,  23,  23,  23,  23,  24,  24,  24,  24,  25,  25,  25,  25,
+     26,  26,  26,  26,  27,  27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,
+     30,  30,  30,  31,  32,  32,  32,  33,  34,  34,  34,  35,  36,  36,  36,  37,
+     38,  38,  38,  39,  40,  40,  40,  41,  42,  42,  42,  43,  44,  44,  44,  45,
+     46,  46,  46,  47,  48,  48,  48,  49,  50,  50,  50,  51,  52,  52,  53,  54,
+     55,  56,  57,  58,  59,  60,  61,  62,  63,  64,  65,
+    // Row 45
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  14,
+     15,  16,  16,  16,  17,  18,  18,  18,  19,  20,  20,  20,  21,  21,  21,  21,
+     22,  22,  22,  22,  23,  23,  23,  23,  24,  24,  24,  24,  25,  25,  25,  25,
+     26,  26,  26,  26,  27,  27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,
+     30,  31,  31,  31,  32,  33,  33,  33,  34,  35,  35,  35,  36,  37,  37,  37,
+     38,  39,  39,  39,  40,  41,  41,  41,  42,  43,  43,  43,  44,  45,  45,  45,
+     46,  47,  47,  47,  48,  49,  49,  49,  50,  51,  51,  51,  52,  53,  54,  55,
+     56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,
+    // Row 46
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     15,  16,  17,  17,  17,  18,  19,  19,  19,  20,  21,  21,  21,  21,  22,  22,
+     22,  22,  23,  23,  23,  23,  24,  24,  24,  24,  25,  25,  25,  25,  26,  26,
+     26,  26,  27,  27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,  30,  30,
+     30,  31,  32,  32,  32,  33,  34,  34,  34,  35,  36,  36,  36,  37,  38,  38,
+     38,  39,  40,  40,  40,  41,  42,  42,  42,  43,  44,  44,  44,  45,  46,  46,
+     46,  47,  48,  48,  48,  49,  50,  50,  50,  51,  52,  52,  52,  53,  54,  55,
+     56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,
+    // Row 47
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  16,  17,  18,  18,  18,  19,  20,  20,  20,  21,  22,  22,  22,  22,  23,
+     23,  23,  23,  24,  24,  24,  24,  25,  25,  25,  25,  26,  26,  26,  26,  27,
+     27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,  31,
+     31,  31,  32,  33,  33,  33,  34,  35,  35,  35,  36,  37,  37,  37,  38,  39,
+     39,  39,  40,  41,  41,  41,  42,  43,  43,  43,  44,  45,  45,  45,  46,  47,
+     47,  47,  48,  49,  49,  49,  50,  51,  51,  51,  52,  53,  53,  53,  54,  55,
+     56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,
+    // Row 48
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  17,  18,  19,  19,  19,  20,  21,  21,  21,  22,  23,  23,  23,  23,
+     24,  24,  24,  24,  25,  25,  25,  25,  26,  26,  26,  26,  27,  27,  27,  27,
+     28,  28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,
+     32,  32,  32,  33,  34,  34,  34,  35,  36,  36,  36,  37,  38,  38,  38,  39,
+     40,  40,  40,  41,  42,  42,  42,  43,  44,  44,  44,  45,  46,  46,  46,  47,
+     48,  48,  48,  49,  50,  50,  50,  51,  52,  52,  52,  53,  54,  54,  55,  56,
+     57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,
+    // Row 49
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  18,  19,  20,  20,  20,  21,  22,  22,  22,  23,  23,  23,  23,
+     24,  24,  24,  24,  25,  25,  25,  25,  26,  26,  26,  26,  27,  27,  27,  27,
+     28,  28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,
+     32,  33,  33,  33,  34,  35,  35,  35,  36,  37,  37,  37,  38,  39,  39,  39,
+     40,  41,  41,  41,  42,  43,  43,  43,  44,  45,  45,  45,  46,  47,  47,  47,
+     48,  49,  49,  49,  50,  51,  51,  51,  52,  53,  53,  53,  54,  55,  56,  57,
+     58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,
+    // Row 50
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  19,  20,  21,  21,  21,  22,  23,  23,  23,  23,  24,  24,
+     24,  24,  25,  25,  25,  25,  26,  26,  26,  26,  27,  27,  27,  27,  28,  28,
+     28,  28,  29,  29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,  32,  32,
+     32,  33,  34,  34,  34,  35,  36,  36,  36,  37,  38,  38,  38,  39,  40,  40,
+     40,  41,  42,  42,  42,  43,  44,  44,  44,  45,  46,  46,  46,  47,  48,  48,
+     48,  49,  50,  50,  50,  51,  52,  52,  52,  53,  54,  54,  54,  55,  56,  57,
+     58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,
+    // Row 51
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  20,  21,  22,  22,  22,  23,  24,  24,  24,  24,  25,
+     25,  25,  25,  26,  26,  26,  26,  27,  27,  27,  27,  28,  28,  28,  28,  29,
+     29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,  33,
+     33,  33,  34,  35,  35,  35,  36,  37,  37,  37,  38,  39,  39,  39,  40,  41,
+     41,  41,  42,  43,  43,  43,  44,  45,  45,  45,  46,  47,  47,  47,  48,  49,
+     49,  49,  50,  51,  51,  51,  52,  53,  53,  53,  54,  55,  55,  55,  56,  57,
+     58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,
+    // Row 52
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  29,  30,
+     31,  31,  31,  32,  33,  33,  33,  34,  35,  35,  35,  36,  37,  37,  37,  38,
+     39,  39,  39,  40,  41,  41,  41,  42,  43,  43,  43,  44,  45,  45,  45,  46,
+     47,  47,  48,  49,  50,  50,  51,  52,  53,  53,  54,  55,  56,  56,  57,  58,
+     59,  59,  60,  61,  62,  62,  63,  64,  65,  65,  66,  67,  68,  68,  69,  70,
+     71,  72,  73,  74,  75,  76,  77,  78,  79,  80,  81,  82,  83,  84,  85,  86,
+     87,  88,  89,  90,  91,  92,  93,  94,  95,  96,  97,
+    // Row 53
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  24,  25,  26,  27,  27,  27,  28,
+     29,  29,  29,  30,  31,  31,  31,  32,  33,  33,  33,  34,  35,  35,  35,  36,
+     37,  37,  37,  38,  39,  39,  39,  40,  41,  41,  41,  42,  43,  43,  43,  44,
+     45,  45,  46,  47,  48,  48,  49,  50,  51,  51,  52,  53,  54,  54,  55,  56,
+     57,  57,  58,  59,  60,  60,  61,  62,  63,  63,  64,  65,  66,  66,  67,  68,
+     69,  69,  70,  71,  72,  72,  73,  74,  75,  76,  77,  78,  79,  80,  81,  82,
+     83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,
+    // Row 54
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  25,  26,  27,  27,  27,  28,
+     29,  29,  29,  30,  31,  31,  31,  32,  33,  33,  33,  34,  35,  35,  35,  36,
+     37,  37,  37,  38,  39,  39,  39,  40,  41,  41,  41,  42,  43,  43,  43,  44,
+     45,  46,  46,  47,  48,  49,  49,  50,  51,  52,  52,  53,  54,  55,  55,  56,
+     57,  58,  58,  59,  60,  61,  61,  62,  63,  64,  64,  65,  66,  67,  67,  68,
+     69,  70,  70,  71,  72,  73,  73,  74,  75,  76,  77,  78,  79,  80,  81,  82,
+     83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,
+    // Row 55
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  26,  27,  27,  28,  28,
+     29,  29,  30,  30,  31,  31,  32,  32,  33,  33,  34,  34,  35,  35,  36,  36,
+     37,  37,  38,  38,  39,  39,  40,  40,  41,  41,  42,  42,  43,  43,  44,  44,
+     45,  46,  47,  47,  48,  49,  50,  50,  51,  52,  53,  53,  54,  55,  56,  56,
+     57,  58,  59,  59,  60,  61,  62,  62,  63,  64,  65,  65,  66,  67,  68,  68,
+     69,  70,  71,  71,  72,  73,  74,  74,  75,  76,  77,  78,  79,  80,  81,  82,
+     83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,
+    // Row 56
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  27,  27,  28,  29,
+     29,  29,  30,  31,  31,  31,  32,  33,  33,  33,  34,  35,  35,  35,  36,  37,
+     37,  37,  38,  39,  39,  39,  40,  41,  41,  41,  42,  43,  43,  43,  44,  45,
+     45,  46,  47,  48,  48,  49,  50,  51,  51,  52,  53,  54,  54,  55,  56,  57,
+     57,  58,  59,  60,  60,  61,  62,  63,  63,  64,  65,  66,  66,  67,  68,  69,
+     69,  70,  71,  72,  72,  73,  74,  75,  75,  76,  77,  78,  79,  80,  81,  82,
+     83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,
+    // Row 57
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  28,  29,
+     30,  30,  30,  31,  32,  32,  32,  33,  34,  34,  34,  35,  36,  36,  36,  37,
+     38,  38,  38,  39,  40,  40,  40,  41,  42,  42,  42,  43,  44,  44,  44,  45,
+     46,  46,  47,  48,  49,  49,  50,  51,  52,  52,  53,  54,  55,  55,  56,  57,
+     58,  58,  59,  60,  61,  61,  62,  63,  64,  64,  65,  66,  67,  67,  68,  69,
+     70,  70,  71,  72,  73,  73,  74,  75,  76,  76,  77,  78,  79,  80,  81,  82,
+     83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,
+    // Row 58
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  28,  29,
+     30,  30,  30,  31,  32,  32,  32,  33,  34,  34,  34,  35,  36,  36,  36,  37,
+     38,  38,  38,  39,  40,  40,  40,  41,  42,  42,  42,  43,  44,  44,  44,  45,
+     46,  47,  47,  48,  49,  50,  50,  51,  52,  53,  53,  54,  55,  56,  56,  57,
+     58,  59,  59,  60,  61,  62,  62,  63,  64,  65,  65,  66,  67,  68,  68,  69,
+     70,  71,  71,  72,  73,  74,  74,  75,  76,  77,  77,  78,  79,  80,  81,  82,
+     83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,
+    // Row 59
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  29,  29,
+     30,  30,  31,  31,  32,  32,  33,  33,  34,  34,  35,  35,  36,  36,  37,  37,
+     38,  38,  39,  39,  40,  40,  41,  41,  42,  42,  43,  43,  44,  44,  45,  45,
+     46,  47,  48,  48,  49,  50,  51,  51,  52,  53,  54,  54,  55,  56,  57,  57,
+     58,  59,  60,  60,  61,  62,  63,  63,  64,  65,  66,  66,  67,  68,  69,  69,
+     70,  71,  72,  72,  73,  74,  75,  75,  76,  77,  78,  78,  79,  80,  81,  82,
+     83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,
+    // Row 60
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  29,  30,
+     30,  30,  31,  32,  32,  32,  33,  34,  34,  34,  35,  36,  36,  36,  37,  38,
+     38,  38,  39,  40,  40,  40,  41,  42,  42,  42,  43,  44,  44,  44,  45,  46,
+     46,  47,  48,  49,  49,  50,  51,  52,  52,  53,  54,  55,  55,  56,  57,  58,
+     58,  59,  60,  61,  61,  62,  63,  64,  64,  65,  66,  67,  67,  68,  69,  70,
+     70,  71,  72,  73,  73,  74,  75,  76,  76,  77,  78,  79,  79,  80,  81,  82,
+     83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,
+    // Row 61
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  16,  17,  18,  19,  19,  20,  21,  22,  22,  23,  24,  25,  25,  25,  26,
+     27,  27,  27,  28,  29,  29,  29,  30,  31,  31,  31,  32,  33,  33,  33,  34,
+     35,  35,  35,  36,  37,  37,  37,  38,  39,  39,  39,  40,  41,  41,  41,  42,
+     43,  43,  44,  45,  46,  46,  47,  48,  49,  49,  50,  51,  52,  52,  53,  54,
+     55,  55,  56,  57,  58,  58,  59,  60,  61,  61,  62,  63,  64,  64,  65,  66,
+     67,  67,  68,  69,  70,  70,  71,  72,  73,  73,  74,  75,  76,  76,  77,  78,
+     79,  80,  81,  82,  83,  84,  85,  86,  87,  88,  89,
+    // Row 62
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  17,  18,  19,  20,  20,  21,  22,  23,  23,  24,  25,  25,  25,  26,
+     27,  27,  27,  28,  29,  29,  29,  30,  31,  31,  31,  32,  33,  33,  33,  34,
+     35,  35,  35,  36,  37,  37,  37,  38,  39,  39,  39,  40,  41,  41,  41,  42,
+     43,  44,  44,  45,  46,  47,  47,  48,  49,  50,  50,  51,  52,  53,  53,  54,
+     55,  56,  56,  57,  58,  59,  59,  60,  61,  62,  62,  63,  64,  65,  65,  66,
+     67,  68,  68,  69,  70,  71,  71,  72,  73,  74,  74,  75,  76,  77,  78,  79,
+     80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,
+    // Row 63
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  18,  19,  20,  21,  21,  22,  23,  24,  24,  25,  25,  26,  26,
+     27,  27,  28,  28,  29,  29,  30,  30,  31,  31,  32,  32,  33,  33,  34,  34,
+     35,  35,  36,  36,  37,  37,  38,  38,  39,  39,  40,  40,  41,  41,  42,  42,
+     43,  44,  45,  45,  46,  47,  48,  48,  49,  50,  51,  51,  52,  53,  54,  54,
+     55,  56,  57,  57,  58,  59,  60,  60,  61,  62,  63,  63,  64,  65,  66,  66,
+     67,  68,  69,  69,  70,  71,  72,  72,  73,  74,  75,  75,  76,  77,  78,  79,
+     80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,
+    // Row 64
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  19,  20,  21,  22,  22,  23,  24,  25,  25,  25,  26,  27,
+     27,  27,  28,  29,  29,  29,  30,  31,  31,  31,  32,  33,  33,  33,  34,  35,
+     35,  35,  36,  37,  37,  37,  38,  39,  39,  39,  40,  41,  41,  41,  42,  43,
+     43,  44,  45,  46,  46,  47,  48,  49,  49,  50,  51,  52,  52,  53,  54,  55,
+     55,  56,  57,  58,  58,  59,  60,  61,  61,  62,  63,  64,  64,  65,  66,  67,
+     67,  68,  69,  70,  70,  71,  72,  73,  73,  74,  75,  76,  76,  77,  78,  79,
+     80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,
+    // Row 65
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  20,  21,  22,  23,  23,  24,  25,  26,  26,  26,  27,
+     28,  28,  28,  29,  30,  30,  30,  31,  32,  32,  32,  33,  34,  34,  34,  35,
+     36,  36,  36,  37,  38,  38,  38,  39,  40,  40,  40,  41,  42,  42,  42,  43,
+     44,  44,  45,  46,  47,  47,  48,  49,  50,  50,  51,  52,  53,  53,  54,  55,
+     56,  56,  57,  58,  59,  59,  60,  61,  62,  62,  63,  64,  65,  65,  66,  67,
+     68,  68,  69,  70,  71,  71,  72,  73,  74,  74,  75,  76,  77,  77,  78,  79,
+     80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,
+    // Row 66
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  21,  22,  23,  24,  24,  25,  26,  26,  26,  27,
+     28,  28,  28,  29,  30,  30,  30,  31,  32,  32,  32,  33,  34,  34,  34,  35,
+     36,  36,  36,  37,  38,  38,  38,  39,  40,  40,  40,  41,  42,  42,  42,  43,
+     44,  45,  45,  46,  47,  48,  48,  49,  50,  51,  51,  52,  53,  54,  54,  55,
+     56,  57,  57,  58,  59,  60,  60,  61,  62,  63,  63,  64,  65,  66,  66,  67,
+     68,  69,  69,  70,  71,  72,  72,  73,  74,  75,  75,  76,  77,  78,  79,  80,
+     81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,
+    // Row 67
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  22,  23,  24,  25,  25,  26,  26,  27,  27,
+     28,  28,  29,  29,  30,  30,  31,  31,  32,  32,  33,  33,  34,  34,  35,  35,
+     36,  36,  37,  37,  38,  38,  39,  39,  40,  40,  41,  41,  42,  42,  43,  43,
+     44,  45,  46,  46,  47,  48,  49,  49,  50,  51,  52,  52,  53,  54,  55,  55,
+     56,  57,  58,  58,  59,  60,  61,  61,  62,  63,  64,  64,  65,  66,  67,  67,
+     68,  69,  70,  70,  71,  72,  73,  73,  74,  75,  76,  76,  77,  78,  79,  80,
+     81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,
+    // Row 68
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  23,  24,  25,  26,  26,  26,  27,  28,
+     28,  28,  29,  30,  30,  30,  31,  32,  32,  32,  33,  34,  34,  34,  35,  36,
+     36,  36,  37,  38,  38,  38,  39,  40,  40,  40,  41,  42,  42,  42,  43,  44,
+     44,  45,  46,  47,  47,  48,  49,  50,  50,  51,  52,  53,  53,  54,  55,  56,
+     56,  57,  58,  59,  59,  60,  61,  62,  62,  63,  64,  65,  65,  66,  67,  68,
+     68,  69,  70,  71,  71,  72,  73,  74,  74,  75,  76,  77,  77,  78,  79,  80,
+     81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,
+    // Row 69
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  29,  30,
+     30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,  33,  33,  33,  33,  34,
+     34,  34,  34,  35,  35,  35,  35,  36,  36,  36,  36,  37,  37,  37,  37,  38,
+     38,  39,  39,  40,  40,  41,  41,  42,  42,  43,  43,  44,  44,  45,  45,  46,
+     46,  47,  47,  48,  48,  49,  49,  50,  50,  51,  51,  52,  52,  53,  53,  54,
+     55,  56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,
+     71,  72,  73,  74,  75,  76,  77,  78,  79,  80,  81,
+    // Row 70
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  23,  24,  24,  25,  25,  25,  25,  26,
+     26,  26,  26,  27,  27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,  30,
+     30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,  33,  33,  33,  33,  34,
+     34,  35,  35,  36,  36,  37,  37,  38,  38,  39,  39,  40,  40,  41,  41,  42,
+     42,  43,  43,  44,  44,  45,  45,  46,  46,  47,  47,  48,  48,  49,  49,  50,
+     50,  51,  51,  52,  52,  53,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 71
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  24,  25,  25,  26,  26,  26,  26,
+     27,  27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,
+     31,  31,  31,  31,  32,  32,  32,  32,  33,  33,  33,  33,  34,  34,  34,  34,
+     35,  35,  36,  36,  37,  37,  38,  38,  39,  39,  40,  40,  41,  41,  42,  42,
+     43,  43,  44,  44,  45,  45,  46,  46,  47,  47,  48,  48,  49,  49,  50,  50,
+     51,  51,  52,  52,  53,  53,  54,  54,  55,  56,  57,  58,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 72
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  25,  26,  26,  26,  26,  27,
+     27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,  31,
+     31,  31,  31,  32,  32,  32,  32,  33,  33,  33,  33,  34,  34,  34,  34,  35,
+     35,  36,  36,  37,  37,  38,  38,  39,  39,  40,  40,  41,  41,  42,  42,  43,
+     43,  44,  44,  45,  45,  46,  46,  47,  47,  48,  48,  49,  49,  50,  50,  51,
+     51,  52,  52,  53,  53,  54,  54,  55,  55,  56,  57,  58,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 73
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  26,  27,  27,  27,  27,
+     28,  28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,
+     32,  32,  32,  32,  33,  33,  33,  33,  34,  34,  34,  34,  35,  35,  35,  35,
+     36,  36,  37,  37,  38,  38,  39,  39,  40,  40,  41,  41,  42,  42,  43,  43,
+     44,  44,  45,  45,  46,  46,  47,  47,  48,  48,  49,  49,  50,  50,  51,  51,
+     52,  52,  53,  53,  54,  54,  55,  55,  56,  56,  57,  58,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 74
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  27,  27,  27,  28,
+     28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,  32,
+     32,  32,  32,  33,  33,  33,  33,  34,  34,  34,  34,  35,  35,  35,  35,  36,
+     36,  37,  37,  38,  38,  39,  39,  40,  40,  41,  41,  42,  42,  43,  43,  44,
+     44,  45,  45,  46,  46,  47,  47,  48,  48,  49,  49,  50,  50,  51,  51,  52,
+     52,  53,  53,  54,  54,  55,  55,  56,  56,  57,  57,  58,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 75
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  28,  28,
+     29,  29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,
+     33,  33,  33,  33,  34,  34,  34,  34,  35,  35,  35,  35,  36,  36,  36,  36,
+     37,  37,  38,  38,  39,  39,  40,  40,  41,  41,  42,  42,  43,  43,  44,  44,
+     45,  45,  46,  46,  47,  47,  48,  48,  49,  49,  50,  50,  51,  51,  52,  52,
+     53,  53,  54,  54,  55,  55,  56,  56,  57,  57,  58,  58,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 76
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  28,  29,
+     29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,  33,
+     33,  33,  33,  34,  34,  34,  34,  35,  35,  35,  35,  36,  36,  36,  36,  37,
+     37,  38,  38,  39,  39,  40,  40,  41,  41,  42,  42,  43,  43,  44,  44,  45,
+     45,  46,  46,  47,  47,  48,  48,  49,  49,  50,  50,  51,  51,  52,  52,  53,
+     53,  54,  54,  55,  55,  56,  56,  57,  57,  58,  58,  59,  59,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 77
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  29,  29,
+     30,  30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,  33,  33,  33,  33,
+     34,  34,  34,  34,  35,  35,  35,  35,  36,  36,  36,  36,  37,  37,  37,  37,
+     38,  38,  39,  39,  40,  40,  41,  41,  42,  42,  43,  43,  44,  44,  45,  45,
+     46,  46,  47,  47,  48,  48,  49,  49,  50,  50,  51,  51,  52,  52,  53,  53,
+     54,  54,  55,  55,  56,  56,  57,  57,  58,  58,  59,  59,  60,  60,  61,  62,
+     63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,
+    // Row 78
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     15,  16,  16,  17,  17,  18,  18,  19,  19,  20,  20,  21,  21,  21,  21,  22,
+     22,  22,  22,  23,  23,  23,  23,  24,  24,  24,  24,  25,  25,  25,  25,  26,
+     26,  26,  26,  27,  27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,  30,
+     30,  31,  31,  32,  32,  33,  33,  34,  34,  35,  35,  36,  36,  37,  37,  38,
+     38,  39,  39,  40,  40,  41,  41,  42,  42,  43,  43,  44,  44,  45,  45,  46,
+     46,  47,  47,  48,  48,  49,  49,  50,  50,  51,  51,  52,  52,  53,  54,  55,
+     56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,
+    // Row 79
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  16,  17,  17,  18,  18,  19,  19,  20,  20,  21,  21,  22,  22,  22,  22,
+     23,  23,  23,  23,  24,  24,  24,  24,  25,  25,  25,  25,  26,  26,  26,  26,
+     27,  27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,
+     31,  31,  32,  32,  33,  33,  34,  34,  35,  35,  36,  36,  37,  37,  38,  38,
+     39,  39,  40,  40,  41,  41,  42,  42,  43,  43,  44,  44,  45,  45,  46,  46,
+     47,  47,  48,  48,  49,  49,  50,  50,  51,  51,  52,  52,  53,  53,  54,  55,
+     56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,
+    // Row 80
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  17,  18,  18,  19,  19,  20,  20,  21,  21,  22,  22,  22,  22,  23,
+     23,  23,  23,  24,  24,  24,  24,  25,  25,  25,  25,  26,  26,  26,  26,  27,
+     27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,  31,
+     31,  32,  32,  33,  33,  34,  34,  35,  35,  36,  36,  37,  37,  38,  38,  39,
+     39,  40,  40,  41,  41,  42,  42,  43,  43,  44,  44,  45,  45,  46,  46,  47,
+     47,  48,  48,  49,  49,  50,  50,  51,  51,  52,  52,  53,  53,  54,  55,  56,
+     57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,
+    // Row 81
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  18,  19,  19,  20,  20,  21,  21,  22,  22,  23,  23,  23,  23,
+     24,  24,  24,  24,  25,  25,  25,  25,  26,  26,  26,  26,  27,  27,  27,  27,
+     28,  28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,
+     32,  32,  33,  33,  34,  34,  35,  35,  36,  36,  37,  37,  38,  38,  39,  39,
+     40,  40,  41,  41,  42,  42,  43,  43,  44,  44,  45,  45,  46,  46,  47,  47,
+     48,  48,  49,  49,  50,  50,  51,  51,  52,  52,  53,  53,  54,  54,  55,  56,
+     57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,
+    // Row 82
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  19,  20,  20,  21,  21,  22,  22,  23,  23,  23,  23,  24,
+     24,  24,  24,  25,  25,  25,  25,  26,  26,  26,  26,  27,  27,  27,  27,  28,
+     28,  28,  28,  29,  29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,  32,
+     32,  33,  33,  34,  34,  35,  35,  36,  36,  37,  37,  38,  38,  39,  39,  40,
+     40,  41,  41,  42,  42,  43,  43,  44,  44,  45,  45,  46,  46,  47,  47,  48,
+     48,  49,  49,  50,  50,  51,  51,  52,  52,  53,  53,  54,  54,  55,  56,  57,
+     58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,
+    // Row 83
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  20,  21,  21,  22,  22,  23,  23,  24,  24,  24,  24,
+     25,  25,  25,  25,  26,  26,  26,  26,  27,  27,  27,  27,  28,  28,  28,  28,
+     29,  29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,
+     33,  33,  34,  34,  35,  35,  36,  36,  37,  37,  38,  38,  39,  39,  40,  40,
+     41,  41,  42,  42,  43,  43,  44,  44,  45,  45,  46,  46,  47,  47,  48,  48,
+     49,  49,  50,  50,  51,  51,  52,  52,  53,  53,  54,  54,  55,  55,  56,  57,
+     58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,
+    // Row 84
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  21,  22,  22,  23,  23,  24,  24,  24,  24,  25,
+     25,  25,  25,  26,  26,  26,  26,  27,  27,  27,  27,  28,  28,  28,  28,  29,
+     29,  29,  29,  30,  30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,  33,
+     33,  34,  34,  35,  35,  36,  36,  37,  37,  38,  38,  39,  39,  40,  40,  41,
+     41,  42,  42,  43,  43,  44,  44,  45,  45,  46,  46,  47,  47,  48,  48,  49,
+     49,  50,  50,  51,  51,  52,  52,  53,  53,  54,  54,  55,  55,  56,  57,  58,
+     59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,
+    // Row 85
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  22,  23,  23,  24,  24,  25,  25,  25,  25,
+     26,  26,  26,  26,  27,  27,  27,  27,  28,  28,  28,  28,  29,  29,  29,  29,
+     30,  30,  30,  30,  31,  31,  31,  31,  32,  32,  32,  32,  33,  33,  33,  33,
+     34,  34,  35,  35,  36,  36,  37,  37,  38,  38,  39,  39,  40,  40,  41,  41,
+     42,  42,  43,  43,  44,  44,  45,  45,  46,  46,  47,  47,  48,  48,  49,  49,
+     50,  50,  51,  51,  52,  52,  53,  53,  54,  54,  55,  55,  56,  56,  57,  58,
+     59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,
+    // Row 86
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  29,  30,
+     30,  30,  31,  32,  32,  32,  33,  34,  34,  34,  35,  36,  36,  36,  37,  38,
+     38,  38,  39,  40,  40,  40,  41,  42,  42,  42,  43,  44,  44,  44,  45,  46,
+     46,  47,  48,  49,  49,  50,  51,  52,  52,  53,  54,  55,  55,  56,  57,  58,
+     58,  59,  60,  61,  61,  62,  63,  64,  64,  65,  66,  67,  67,  68,  69,  70,
+     71,  72,  73,  74,  75,  76,  77,  78,  79,  80,  81,  82,  83,  84,  85,  86,
+     87,  88,  89,  90,  91,  92,  93,  94,  95,  96,  97,
+    // Row 87
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  23,  24,  25,  26,  26,  26,  27,  28,
+     28,  28,  29,  30,  30,  30,  31,  32,  32,  32,  33,  34,  34,  34,  35,  36,
+     36,  36,  37,  38,  38,  38,  39,  40,  40,  40,  41,  42,  42,  42,  43,  44,
+     44,  45,  46,  47,  47,  48,  49,  50,  50,  51,  52,  53,  53,  54,  55,  56,
+     56,  57,  58,  59,  59,  60,  61,  62,  62,  63,  64,  65,  65,  66,  67,  68,
+     68,  69,  70,  71,  71,  72,  73,  74,  75,  76,  77,  78,  79,  80,  81,  82,
+     83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,
+    // Row 88
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  24,  25,  26,  27,  27,  27,  28,
+     29,  29,  29,  30,  31,  31,  31,  32,  33,  33,  33,  34,  35,  35,  35,  36,
+     37,  37,  37,  38,  39,  39,  39,  40,  41,  41,  41,  42,  43,  43,  43,  44,
+     45,  45,  46,  47,  48,  48,  49,  50,  51,  51,  52,  53,  54,  54,  55,  56,
+     57,  57,  58,  59,  60,  60,  61,  62,  63,  63,  64,  65,  66,  66,  67,  68,
+     69,  69,  70,  71,  72,  72,  73,  74,  75,  76,  77,  78,  79,  80,  81,  82,
+     83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,
+    // Row 89
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  25,  26,  27,  27,  27,  28,
+     29,  29,  29,  30,  31,  31,  31,  32,  33,  33,  33,  34,  35,  35,  35,  36,
+     37,  37,  37,  38,  39,  39,  39,  40,  41,  41,  41,  42,  43,  43,  43,  44,
+     45,  46,  46,  47,  48,  49,  49,  50,  51,  52,  52,  53,  54,  55,  55,  56,
+     57,  58,  58,  59,  60,  61,  61,  62,  63,  64,  64,  65,  66,  67,  67,  68,
+     69,  70,  70,  71,  72,  73,  73,  74,  75,  76,  77,  78,  79,  80,  81,  82,
+     83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,
+    // Row 90
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  26,  27,  27,  28,  28,
+     29,  29,  30,  30,  31,  31,  32,  32,  33,  33,  34,  34,  35,  35,  36,  36,
+     37,  37,  38,  38,  39,  39,  40,  40,  41,  41,  42,  42,  43,  43,  44,  44,
+     45,  46,  47,  47,  48,  49,  50,  50,  51,  52,  53,  53,  54,  55,  56,  56,
+     57,  58,  59,  59,  60,  61,  62,  62,  63,  64,  65,  65,  66,  67,  68,  68,
+     69,  70,  71,  71,  72,  73,  74,  74,  75,  76,  77,  78,  79,  80,  81,  82,
+     83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,
+    // Row 91
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  27,  27,  28,  29,
+     29,  29,  30,  31,  31,  31,  32,  33,  33,  33,  34,  35,  35,  35,  36,  37,
+     37,  37,  38,  39,  39,  39,  40,  41,  41,  41,  42,  43,  43,  43,  44,  45,
+     45,  46,  47,  48,  48,  49,  50,  51,  51,  52,  53,  54,  54,  55,  56,  57,
+     57,  58,  59,  60,  60,  61,  62,  63,  63,  64,  65,  66,  66,  67,  68,  69,
+     69,  70,  71,  72,  72,  73,  74,  75,  75,  76,  77,  78,  79,  80,  81,  82,
+     83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,
+    // Row 92
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  28,  29,
+     30,  30,  30,  31,  32,  32,  32,  33,  34,  34,  34,  35,  36,  36,  36,  37,
+     38,  38,  38,  39,  40,  40,  40,  41,  42,  42,  42,  43,  44,  44,  44,  45,
+     46,  46,  47,  48,  49,  49,  50,  51,  52,  52,  53,  54,  55,  55,  56,  57,
+     58,  58,  59,  60,  61,  61,  62,  63,  64,  64,  65,  66,  67,  67,  68,  69,
+     70,  70,  71,  72,  73,  73,  74,  75,  76,  76,  77,  78,  79,  80,  81,  82,
+     83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,
+    // Row 93
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  28,  29,
+     30,  30,  30,  31,  32,  32,  32,  33,  34,  34,  34,  35,  36,  36,  36,  37,
+     38,  38,  38,  39,  40,  40,  40,  41,  42,  42,  42,  43,  44,  44,  44,  45,
+     46,  47,  47,  48,  49,  50,  50,  51,  52,  53,  53,  54,  55,  56,  56,  57,
+     58,  59,  59,  60,  61,  62,  62,  63,  64,  65,  65,  66,  67,  68,  68,  69,
+     70,  71,  71,  72,  73,  74,  74,  75,  76,  77,  77,  78,  79,  80,  81,  82,
+     83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,
+    // Row 94
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  29,  29,
+     30,  30,  31,  31,  32,  32,  33,  33,  34,  34,  35,  35,  36,  36,  37,  37,
+     38,  38,  39,  39,  40,  40,  41,  41,  42,  42,  43,  43,  44,  44,  45,  45,
+     46,  47,  48,  48,  49,  50,  51,  51,  52,  53,  54,  54,  55,  56,  57,  57,
+     58,  59,  60,  60,  61,  62,  63,  63,  64,  65,  66,  66,  67,  68,  69,  69,
+     70,  71,  72,  72,  73,  74,  75,  75,  76,  77,  78,  78,  79,  80,  81,  82,
+     83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,
+    // Row 95
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     15,  16,  17,  18,  18,  19,  20,  21,  21,  22,  23,  24,  24,  24,  25,  26,
+     26,  26,  27,  28,  28,  28,  29,  30,  30,  30,  31,  32,  32,  32,  33,  34,
+     34,  34,  35,  36,  36,  36,  37,  38,  38,  38,  39,  40,  40,  40,  41,  42,
+     42,  43,  44,  45,  45,  46,  47,  48,  48,  49,  50,  51,  51,  52,  53,  54,
+     54,  55,  56,  57,  57,  58,  59,  60,  60,  61,  62,  63,  63,  64,  65,  66,
+     66,  67,  68,  69,  69,  70,  71,  72,  72,  73,  74,  75,  75,  76,  77,  78,
+     79,  80,  81,  82,  83,  84,  85,  86,  87,  88,  89,
+    // Row 96
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  16,  17,  18,  19,  19,  20,  21,  22,  22,  23,  24,  25,  25,  25,  26,
+     27,  27,  27,  28,  29,  29,  29,  30,  31,  31,  31,  32,  33,  33,  33,  34,
+     35,  35,  35,  36,  37,  37,  37,  38,  39,  39,  39,  40,  41,  41,  41,  42,
+     43,  43,  44,  45,  46,  46,  47,  48,  49,  49,  50,  51,  52,  52,  53,  54,
+     55,  55,  56,  57,  58,  58,  59,  60,  61,  61,  62,  63,  64,  64,  65,  66,
+     67,  67,  68,  69,  70,  70,  71,  72,  73,  73,  74,  75,  76,  76,  77,  78,
+     79,  80,  81,  82,  83,  84,  85,  86,  87,  88,  89,
+    // Row 97
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  17,  18,  19,  20,  20,  21,  22,  23,  23,  24,  25,  25,  25,  26,
+     27,  27,  27,  28,  29,  29,  29,  30,  31,  31,  31,  32,  33,  33,  33,  34,
+     35,  35,  35,  36,  37,  37,  37,  38,  39,  39,  39,  40,  41,  41,  41,  42,
+     43,  44,  44,  45,  46,  47,  47,  48,  49,  50,  50,  51,  52,  53,  53,  54,
+     55,  56,  56,  57,  58,  59,  59,  60,  61,  62,  62,  63,  64,  65,  65,  66,
+     67,  68,  68,  69,  70,  71,  71,  72,  73,  74,  74,  75,  76,  77,  78,  79,
+     80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,
+    // Row 98
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  18,  19,  20,  21,  21,  22,  23,  24,  24,  25,  25,  26,  26,
+     27,  27,  28,  28,  29,  29,  30,  30,  31,  31,  32,  32,  33,  33,  34,  34,
+     35,  35,  36,  36,  37,  37,  38,  38,  39,  39,  40,  40,  41,  41,  42,  42,
+     43,  44,  45,  45,  46,  47,  48,  48,  49,  50,  51,  51,  52,  53,  54,  54,
+     55,  56,  57,  57,  58,  59,  60,  60,  61,  62,  63,  63,  64,  65,  66,  66,
+     67,  68,  69,  69,  70,  71,  72,  72,  73,  74,  75,  75,  76,  77,  78,  79,
+     80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,
+    // Row 99
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  19,  20,  21,  22,  22,  23,  24,  25,  25,  25,  26,  27,
+     27,  27,  28,  29,  29,  29,  30,  31,  31,  31,  32,  33,  33,  33,  34,  35,
+     35,  35,  36,  37,  37,  37,  38,  39,  39,  39,  40,  41,  41,  41,  42,  43,
+     43,  44,  45,  46,  46,  47,  48,  49,  49,  50,  51,  52,  52,  53,  54,  55,
+     55,  56,  57,  58,  58,  59,  60,  61,  61,  62,  63,  64,  64,  65,  66,  67,
+     67,  68,  69,  70,  70,  71,  72,  73,  73,  74,  75,  76,  76,  77,  78,  79,
+     80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,
+    // Row 100
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  20,  21,  22,  23,  23,  24,  25,  26,  26,  26,  27,
+     28,  28,  28,  29,  30,  30,  30,  31,  32,  32,  32,  33,  34,  34,  34,  35,
+     36,  36,  36,  37,  38,  38,  38,  39,  40,  40,  40,  41,  42,  42,  42,  43,
+     44,  44,  45,  46,  47,  47,  48,  49,  50,  50,  51,  52,  53,  53,  54,  55,
+     56,  56,  57,  58,  59,  59,  60,  61,  62,  62,  63,  64,  65,  65,  66,  67,
+     68,  68,  69,  70,  71,  71,  72,  73,  74,  74,  75,  76,  77,  77,  78,  79,
+     80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,
+    // Row 101
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  21,  22,  23,  24,  24,  25,  26,  26,  26,  27,
+     28,  28,  28,  29,  30,  30,  30,  31,  32,  32,  32,  33,  34,  34,  34,  35,
+     36,  36,  36,  37,  38,  38,  38,  39,  40,  40,  40,  41,  42,  42,  42,  43,
+     44,  45,  45,  46,  47,  48,  48,  49,  50,  51,  51,  52,  53,  54,  54,  55,
+     56,  57,  57,  58,  59,  60,  60,  61,  62,  63,  63,  64,  65,  66,  66,  67,
+     68,  69,  69,  70,  71,  72,  72,  73,  74,  75,  75,  76,  77,  78,  79,  80,
+     81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,
+    // Row 102
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  22,  23,  24,  25,  25,  26,  26,  27,  27,
+     28,  28,  29,  29,  30,  30,  31,  31,  32,  32,  33,  33,  34,  34,  35,  35,
+     36,  36,  37,  37,  38,  38,  39,  39,  40,  40,  41,  41,  42,  42,  43,  43,
+     44,  45,  46,  46,  47,  48,  49,  49,  50,  51,  52,  52,  53,  54,  55,  55,
+     56,  57,  58,  58,  59,  60,  61,  61,  62,  63,  64,  64,  65,  66,  67,  67,
+     68,  69,  70,  70,  71,  72,  73,  73,  74,  75,  76,  76,  77,  78,  79,  80,
+     81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,
+    // Row 103
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  29,  30,
+     30,  30,  31,  32,  33,  33,  34,  35,  35,  35,  36,  37,  38,  38,  39,  40,
+     40,  40,  41,  42,  43,  43,  44,  45,  45,  45,  46,  47,  48,  48,  49,  50,
+     50,  51,  52,  53,  54,  55,  56,  57,  57,  58,  59,  60,  61,  62,  63,  64,
+     64,  65,  66,  67,  68,  69,  70,  71,  71,  72,  73,  74,  75,  76,  77,  78,
+     79,  80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94,
+     95,  96,  97,  98,  99, 100, 101, 102, 103, 104, 105,
+    // Row 104
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  23,  24,  25,  26,  27,  27,  28,  29,
+     29,  29,  30,  31,  32,  32,  33,  34,  34,  34,  35,  36,  37,  37,  38,  39,
+     39,  39,  40,  41,  42,  42,  43,  44,  44,  44,  45,  46,  47,  47,  48,  49,
+     49,  50,  51,  52,  53,  54,  55,  56,  56,  57,  58,  59,  60,  61,  62,  63,
+     63,  64,  65,  66,  67,  68,  69,  70,  70,  71,  72,  73,  74,  75,  76,  77,
+     77,  78,  79,  80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,
+     93,  94,  95,  96,  97,  98,  99, 100, 101, 102, 103,
+    // Row 105
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  24,  25,  26,  27,  27,  28,  29,
+     30,  30,  30,  31,  32,  32,  33,  34,  35,  35,  35,  36,  37,  37,  38,  39,
+     40,  40,  40,  41,  42,  42,  43,  44,  45,  45,  45,  46,  47,  47,  48,  49,
+     50,  50,  51,  52,  53,  54,  55,  56,  57,  57,  58,  59,  60,  61,  62,  63,
+     64,  64,  65,  66,  67,  68,  69,  70,  71,  71,  72,  73,  74,  75,  76,  77,
+     78,  78,  79,  80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,
+     93,  94,  95,  96,  97,  98,  99, 100, 101, 102, 103,
+    // Row 106
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  25,  26,  27,  27,  28,  29,
+     30,  30,  30,  31,  32,  32,  33,  34,  35,  35,  35,  36,  37,  37,  38,  39,
+     40,  40,  40,  41,  42,  42,  43,  44,  45,  45,  45,  46,  47,  47,  48,  49,
+     50,  51,  51,  52,  53,  54,  55,  56,  57,  58,  58,  59,  60,  61,  62,  63,
+     64,  65,  65,  66,  67,  68,  69,  70,  71,  72,  72,  73,  74,  75,  76,  77,
+     78,  79,  79,  80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,
+     93,  94,  95,  96,  97,  98,  99, 100, 101, 102, 103,
+    // Row 107
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  26,  27,  27,  28,  29,
+     30,  30,  31,  31,  32,  32,  33,  34,  35,  35,  36,  36,  37,  37,  38,  39,
+     40,  40,  41,  41,  42,  42,  43,  44,  45,  45,  46,  46,  47,  47,  48,  49,
+     50,  51,  52,  52,  53,  54,  55,  56,  57,  58,  59,  59,  60,  61,  62,  63,
+     64,  65,  66,  66,  67,  68,  69,  70,  71,  72,  73,  73,  74,  75,  76,  77,
+     78,  79,  80,  80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,
+     93,  94,  95,  96,  97,  98,  99, 100, 101, 102, 103,
+    // Row 108
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  27,  27,  28,  29,
+     30,  30,  31,  32,  32,  32,  33,  34,  35,  35,  36,  37,  37,  37,  38,  39,
+     40,  40,  41,  42,  42,  42,  43,  44,  45,  45,  46,  47,  47,  47,  48,  49,
+     50,  51,  52,  53,  53,  54,  55,  56,  57,  58,  59,  60,  60,  61,  62,  63,
+     64,  65,  66,  67,  67,  68,  69,  70,  71,  72,  73,  74,  74,  75,  76,  77,
+     78,  79,  80,  81,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,
+     93,  94,  95,  96,  97,  98,  99, 100, 101, 102, 103,
+    // Row 109
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  28,  29,
+     30,  30,  31,  32,  33,  33,  33,  34,  35,  35,  36,  37,  38,  38,  38,  39,
+     40,  40,  41,  42,  43,  43,  43,  44,  45,  45,  46,  47,  48,  48,  48,  49,
+     50,  51,  52,  53,  54,  54,  55,  56,  57,  58,  59,  60,  61,  61,  62,  63,
+     64,  65,  66,  67,  68,  68,  69,  70,  71,  72,  73,  74,  75,  75,  76,  77,
+     78,  79,  80,  81,  82,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,
+     93,  94,  95,  96,  97,  98,  99, 100, 101, 102, 103,
+    // Row 110
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  28,  29,
+     30,  30,  31,  32,  33,  33,  33,  34,  35,  35,  36,  37,  38,  38,  38,  39,
+     40,  40,  41,  42,  43,  43,  43,  44,  45,  45,  46,  47,  48,  48,  48,  49,
+     50,  51,  52,  53,  54,  55,  55,  56,  57,  58,  59,  60,  61,  62,  62,  63,
+     64,  65,  66,  67,  68,  69,  69,  70,  71,  72,  73,  74,  75,  76,  76,  77,
+     78,  79,  80,  81,  82,  83,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,
+     93,  94,  95,  96,  97,  98,  99, 100, 101, 102, 103,
+    // Row 111
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  28,  29,  29,
+     30,  30,  31,  32,  33,  33,  34,  34,  35,  35,  36,  37,  38,  38,  39,  39,
+     40,  40,  41,  42,  43,  43,  44,  44,  45,  45,  46,  47,  48,  48,  49,  49,
+     50,  51,  52,  53,  54,  55,  56,  56,  57,  58,  59,  60,  61,  62,  63,  63,
+     64,  65,  66,  67,  68,  69,  70,  70,  71,  72,  73,  74,  75,  76,  77,  77,
+     78,  79,  80,  81,  82,  83,  84,  84,  85,  86,  87,  88,  89,  90,  91,  92,
+     93,  94,  95,  96,  97,  98,  99, 100, 101, 102, 103,
+    // Row 112
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     15,  16,  17,  18,  19,  20,  21,  22,  22,  23,  24,  25,  26,  26,  27,  28,
+     28,  28,  29,  30,  31,  31,  32,  33,  33,  33,  34,  35,  36,  36,  37,  38,
+     38,  38,  39,  40,  41,  41,  42,  43,  43,  43,  44,  45,  46,  46,  47,  48,
+     48,  49,  50,  51,  52,  53,  54,  55,  55,  56,  57,  58,  59,  60,  61,  62,
+     62,  63,  64,  65,  66,  67,  68,  69,  69,  70,  71,  72,  73,  74,  75,  76,
+     76,  77,  78,  79,  80,  81,  82,  83,  83,  84,  85,  86,  87,  88,  89,  90,
+     91,  92,  93,  94,  95,  96,  97,  98,  99, 100, 101,
+    // Row 113
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  16,  17,  18,  19,  20,  21,  22,  23,  23,  24,  25,  26,  26,  27,  28,
+     29,  29,  29,  30,  31,  31,  32,  33,  34,  34,  34,  35,  36,  36,  37,  38,
+     39,  39,  39,  40,  41,  41,  42,  43,  44,  44,  44,  45,  46,  46,  47,  48,
+     49,  49,  50,  51,  52,  53,  54,  55,  56,  56,  57,  58,  59,  60,  61,  62,
+     63,  63,  64,  65,  66,  67,  68,  69,  70,  70,  71,  72,  73,  74,  75,  76,
+     77,  77,  78,  79,  80,  81,  82,  83,  84,  84,  85,  86,  87,  88,  89,  90,
+     91,  92,  93,  94,  95,  96,  97,  98,  99, 100, 101,
+    // Row 114
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  17,  18,  19,  20,  21,  22,  23,  24,  24,  25,  26,  26,  27,  28,
+     29,  29,  29,  30,  31,  31,  32,  33,  34,  34,  34,  35,  36,  36,  37,  38,
+     39,  39,  39,  40,  41,  41,  42,  43,  44,  44,  44,  45,  46,  46,  47,  48,
+     49,  50,  50,  51,  52,  53,  54,  55,  56,  57,  57,  58,  59,  60,  61,  62,
+     63,  64,  64,  65,  66,  67,  68,  69,  70,  71,  71,  72,  73,  74,  75,  76,
+     77,  78,  78,  79,  80,  81,  82,  83,  84,  85,  85,  86,  87,  88,  89,  90,
+     91,  92,  93,  94,  95,  96,  97,  98,  99, 100, 101,
+    // Row 115
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  18,  19,  20,  21,  22,  23,  24,  25,  25,  26,  26,  27,  28,
+     29,  29,  30,  30,  31,  31,  32,  33,  34,  34,  35,  35,  36,  36,  37,  38,
+     39,  39,  40,  40,  41,  41,  42,  43,  44,  44,  45,  45,  46,  46,  47,  48,
+     49,  50,  51,  51,  52,  53,  54,  55,  56,  57,  58,  58,  59,  60,  61,  62,
+     63,  64,  65,  65,  66,  67,  68,  69,  70,  71,  72,  72,  73,  74,  75,  76,
+     77,  78,  79,  79,  80,  81,  82,  83,  84,  85,  86,  86,  87,  88,  89,  90,
+     91,  92,  93,  94,  95,  96,  97,  98,  99, 100, 101,
+    // Row 116
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  19,  20,  21,  22,  23,  24,  25,  26,  26,  26,  27,  28,
+     29,  29,  30,  31,  31,  31,  32,  33,  34,  34,  35,  36,  36,  36,  37,  38,
+     39,  39,  40,  41,  41,  41,  42,  43,  44,  44,  45,  46,  46,  46,  47,  48,
+     49,  50,  51,  52,  52,  53,  54,  55,  56,  57,  58,  59,  59,  60,  61,  62,
+     63,  64,  65,  66,  66,  67,  68,  69,  70,  71,  72,  73,  73,  74,  75,  76,
+     77,  78,  79,  80,  80,  81,  82,  83,  84,  85,  86,  87,  87,  88,  89,  90,
+     91,  92,  93,  94,  95,  96,  97,  98,  99, 100, 101,
+    // Row 117
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  20,  21,  22,  23,  24,  25,  26,  27,  27,  27,  28,
+     29,  29,  30,  31,  32,  32,  32,  33,  34,  34,  35,  36,  37,  37,  37,  38,
+     39,  39,  40,  41,  42,  42,  42,  43,  44,  44,  45,  46,  47,  47,  47,  48,
+     49,  50,  51,  52,  53,  53,  54,  55,  56,  57,  58,  59,  60,  60,  61,  62,
+     63,  64,  65,  66,  67,  67,  68,  69,  70,  71,  72,  73,  74,  74,  75,  76,
+     77,  78,  79,  80,  81,  81,  82,  83,  84,  85,  86,  87,  88,  88,  89,  90,
+     91,  92,  93,  94,  95,  96,  97,  98,  99, 100, 101,
+    // Row 118
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  21,  22,  23,  24,  25,  26,  27,  27,  27,  28,
+     29,  29,  30,  31,  32,  32,  32,  33,  34,  34,  35,  36,  37,  37,  37,  38,
+     39,  39,  40,  41,  42,  42,  42,  43,  44,  44,  45,  46,  47,  47,  47,  48,
+     49,  50,  51,  52,  53,  54,  54,  55,  56,  57,  58,  59,  60,  61,  61,  62,
+     63,  64,  65,  66,  67,  68,  68,  69,  70,  71,  72,  73,  74,  75,  75,  76,
+     77,  78,  79,  80,  81,  82,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,
+     92,  93,  94,  95,  96,  97,  98,  99, 100, 101, 102,
+    // Row 119
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  22,  23,  24,  25,  26,  27,  27,  28,  28,
+     29,  29,  30,  31,  32,  32,  33,  33,  34,  34,  35,  36,  37,  37,  38,  38,
+     39,  39,  40,  41,  42,  42,  43,  43,  44,  44,  45,  46,  47,  47,  48,  48,
+     49,  50,  51,  52,  53,  54,  55,  55,  56,  57,  58,  59,  60,  61,  62,  62,
+     63,  64,  65,  66,  67,  68,  69,  69,  70,  71,  72,  73,  74,  75,  76,  76,
+     77,  78,  79,  80,  81,  82,  83,  83,  84,  85,  86,  87,  88,  89,  90,  91,
+     92,  93,  94,  95,  96,  97,  98,  99, 100, 101, 102,
+};
+
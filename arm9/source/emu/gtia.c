@@ -55,6 +55,7 @@
 #include "gtia.h"
 #include "input.h"
 #include "pokeysnd.h"
+#include "membudget.h"
 
 /* GTIA Registers ---------------------------------------------------------- */
 
@@ -111,6 +112,10 @@ void set_prior(UBYTE byte);         /* in antic.c */
 
 /* Player/Missile stuff ---------------------------------------------------- */
 
+// Collisions are always accumulated. A read of $D000-$D00F returns every hit since
+// the last HITCLR, which can be any number of frames back, so there is no bounded
+// replay that would let us skip them while a game isn't looking and stay exact.
+
 /* change to 0x00 to disable collisions */
 #define collisions_mask_missile_playfield  0x0f
 #define collisions_mask_player_playfield   0x0f
@@ -157,7 +162,7 @@ UBYTE *hposp_ptr[4] __attribute__((section(".dtcm")));
 UBYTE *hposm_ptr[4] __attribute__((section(".dtcm")));
 ULONG hposp_mask[4] __attribute__((section(".dtcm")));
 
-ULONG *grafp_lookup = (ULONG*)0x068A0000;   // Using 4K here for lookup table... ULONG[4][256]
+ULONG *grafp_lookup = (ULONG*)VRAM_GRAFP_LOOKUP;   // Using 4K here for lookup table... ULONG[4][256]
 
 ULONG *grafp_ptr[4] __attribute__((section(".dtcm")));
 int global_sizem[4] __attribute__((section(".dtcm")));
@@ -63,28 +63,38 @@
 #include "pia.h"
 #include "pokeysnd.h"
 #include "util.h"
+#include "membudget.h"
+#include "benchdev.h"
+#include "a8ds.h"
 
 UBYTE memory[0x10000]    __attribute__ ((aligned (0x1000)));            // This is the main Atari 8-bit memory which is 64K in length and we align to a 4K boundary
 UBYTE fast_page[0x1000]  __attribute__((section(".dtcm")));             // Fast memory which we will map to a common 4K of main memory (zero page)
-rdfunc readmap[256]      __attribute__((section(".dtcm")));             // The readmap tells the memory fetcher if we should do direct memory read or call a device function instead
-wrfunc writemap[256]     __attribute__((section(".dtcm")));             // The writemap tells the memory fetcher if we should do direct memory read or call a device function instead
+UBYTE *page_rd[256]      __attribute__((section(".dtcm")));             // Page descriptor for reads - direct (pre-offset) memory pointer or NULL if we must call the readmap[] device handler
+UBYTE *page_wr[256]      __attribute__((section(".dtcm")));             // Page descriptor for writes - direct (pre-offset) memory pointer or NULL if we must call the writemap[] device handler
+rdfunc readmap[256];                                                    // The readmap holds the device read handler for any page whose page_rd[] descriptor is NULL
+wrfunc writemap[256];                                                   // The writemap holds the device write handler for any page whose page_wr[] descriptor is NULL
 UBYTE *atarixe_memory    __attribute__((section(".dtcm"))) = NULL;      // Pointer to XE memory (expanded RAM)
 UBYTE cart809F_enabled   __attribute__((section(".dtcm"))) = FALSE;     // By default, no CART memory mapped to 0x8000 - 0x9FFF
 UBYTE cartA0BF_enabled   __attribute__((section(".dtcm"))) = FALSE;     // By default, no CART memory mapped to 0xA000 - 0xBFFF
 UBYTE *mem_map[20]       __attribute__((section(".dtcm")));             // This is the magic that allows us to index into banks of memory quickly. 16 banks of 4K plus an additional 4 banks to handle the "under 0x8, 0x9, 0xA and 0xB" areas
 
-UBYTE *under_atarixl_os = (UBYTE *)(0x06898000+0x0000);                 // We use 16K of VRAM here as it's a little faster but also to free up normal RAM resources
+UBYTE *under_atarixl_os = (UBYTE *)VRAM_UNDER_OS;                       // We use 16K of VRAM here as it's a little faster but also to free up normal RAM resources
 
 // ------------------------------------------------------------------
-// This is the huge 1MB+ buffer to support the maximum expanded RAM 
-// for the emulator. We support the 1088K version of the Atari XL/XE
-// which only a few games can even access...  The DS has 4MB of 
-// general RAM available and that must hold all our data plus the 
-// A8DS.NDS executable itself. So this takes up a full 25% of our
-// available RAM. Still... there isn't much else to do with the NDS
-// RAM so we may as well get the most out of it!  
+// The expanded RAM buffer is sized to the machine - 64K for the 130XE
+// and up to a full 1MB for the 1088K machine which only a few games
+// can even access... The DS has 4MB of general RAM available and that
+// must hold all our data plus the A8DS.NDS executable itself so we
+// don't hold on to any of this for the 48K/64K machines - whatever
+// isn't used here is left on the heap for the cart image, disk info
+// and the Run-Ahead snapshot. Banks are only cleared the first time
+// they are mapped in rather than clearing the whole thing every boot.
 // ------------------------------------------------------------------
-UBYTE xe_mem_buffer[1024 * 1024]; // Expanded banks are 1..64 but we subtract one when indexing to give us 0..63 and 1024K of expanded memory (+64K base = 1088K)
+UBYTE *xe_mem_buffer = NULL;    // Expanded banks are 1..64 but we subtract one when indexing to give us 0..63 and up to 1024K of expanded memory (+64K base = 1088K)
+ULONG xe_mem_size = 0;           // Size of the above buffer in bytes (0 if not an expanded machine)
+ULONG xe_banks_zeroed[2] __attribute__((section(".dtcm"))) = {0, 0};    // One bit per 16K bank that has been cleared since the last cold start
+UBYTE xe_mem_reduced = FALSE;    // Set if the last machine set up couldn't get its expanded RAM and was cut down to fit
+UBYTE mem_machine_type = MACHINE_XLXE_128K;  // The machine we are really running - myConfig.machine_type unless the RAM above didn't fit
 
 void ROM_PutByte(UWORD addr, UBYTE value) {}
 
@@ -92,21 +102,62 @@ void ROM_PutByte(UWORD addr, UBYTE value) {}
 // Note: We support several memory configurations for XE... Standard 130XE compatible 128K and
 // the RAMBO 320K, COMPY 576K or RAMBO 1088K.  There is also a backwards compatible 48K option.
 // ----------------------------------------------------------------------------------------------
+static ULONG XEMemorySize(void)
+{
+    /* don't count 64 KB of base memory - the base memory is never copied out so we only need the 16 KB banks */
+    if (RAM_SIZES[mem_machine_type] > 64) return ((RAM_SIZES[mem_machine_type] - 64) / 16) * 16384;
+    return 0;
+}
+
 static void AllocXEMemory(void)
 {
-    if (RAM_SIZES[myConfig.machine_type] > 64) 
+    mem_machine_type = myConfig.machine_type;  // Try for the full size every time - the config is never changed
+    ULONG size = XEMemorySize();
+
+    xe_mem_reduced = FALSE;
+    if (size != xe_mem_size)
     {
-        /* don't count 64 KB of base memory */
-        /* count number of 16 KB banks, add 1 for saving base memory 0x4000-0x7fff */
-        ULONG size = (1 + (RAM_SIZES[myConfig.machine_type] - 64) / 16) * 16384;
-        atarixe_memory = (UBYTE *) xe_mem_buffer; // Use the large 1088K buffer even if we don't use it all
-        memset(atarixe_memory, 0x00, size);
+        // Give back the old buffer first so the heap can hand us (or the cart) the same space
+        free(xe_mem_buffer);
+        xe_mem_buffer = NULL;
+        xe_mem_size = 0;
+        while (size)
+        {
+            xe_mem_buffer = (UBYTE *) malloc(size);
+            if ((xe_mem_buffer == NULL) && a8FreeDirCache()) xe_mem_buffer = (UBYTE *) malloc(size);  // The ROM browser listings can go
+            if (xe_mem_buffer != NULL) {xe_mem_size = size; break;}
+
+            // Still no room - step down to the next smaller machine (ending at the plain 64K XL/XE) so the
+            // RAM size shown and any bank switching the game tries both match what we are really running.
+            // Only for this boot - the game's saved setting stays as it is so it asks for the full size again.
+            mem_machine_type--;
+            xe_mem_reduced = TRUE;
+            size = XEMemorySize();
+        }
     }
-    /* atarixe_memory not needed, free it */
-    else if (atarixe_memory != NULL) 
+
+    // Nothing is cleared here - MEMORY_XEBank() clears each bank the first time it is mapped
+    xe_banks_zeroed[0] = xe_banks_zeroed[1] = 0;
+
+    atarixe_memory = size ? xe_mem_buffer : NULL;
+}
+
+// Return the given 16K expanded RAM bank (0..63), clearing it if this is the first time it's been used
+UBYTE *MEMORY_XEBank(int idx)
+{
+    UBYTE *ptr = atarixe_memory + (idx << 14);
+    if (!(xe_banks_zeroed[idx >> 5] & (1 << (idx & 31))))
     {
-        atarixe_memory = NULL;
+        memset(ptr, 0x00, 0x4000);
+        xe_banks_zeroed[idx >> 5] |= (1 << (idx & 31));
     }
+    return ptr;
+}
+
+// Clear any expanded RAM banks not yet touched - needed before the buffer is saved or loaded as a whole
+void MEMORY_XEZeroAll(void)
+{
+    for (int idx = 0; idx < (int)(xe_mem_size >> 14); idx++) MEMORY_XEBank(idx);
 }
 
 // ---------------------------------------------------------------------------------------
@@ -120,6 +171,32 @@ void PBIM1_PutByte(UWORD addr, UBYTE byte) {}
 UBYTE PBIM2_GetByte(UWORD addr) {return 0;}
 void PBIM2_PutByte(UWORD addr, UBYTE byte) {}
 
+// Emit the one out-of-line copy of MEMORY_MapBank() and the handler setters for any call site the compiler chooses not to inline
+extern inline void MEMORY_MapBank(unsigned int bank, UBYTE *ptr);
+extern inline void MEMORY_SetReadHandler(unsigned int page, rdfunc handler);
+extern inline void MEMORY_SetWriteHandler(unsigned int page, wrfunc handler);
+
+#ifdef DEBUG_PAGES
+// ---------------------------------------------------------------------------------
+// The page descriptor invariant - each of the 256 pages must hold its mem_map[] bank
+// pointer unless it has a device handler, in which case it must be NULL. Anything
+// that writes the maps without going through the setters in memory.h shows up here.
+// ---------------------------------------------------------------------------------
+void MEMORY_CheckPages(void)
+{
+    char tmp[32];
+    for (int i=0; i<256; i++)
+    {
+        if ((page_rd[i] != (readmap[i] ? NULL : mem_map[i >> 4])) || (page_wr[i] != (writemap[i] ? NULL : mem_map[i >> 4])))
+        {
+            sprintf(tmp, "PAGE MAP WRONG AT $%02X00       ", i);
+            dsPrintValue(1,23,0, tmp);
+            return;
+        }
+    }
+}
+#endif
+
 // ---------------------------------------------------------------------------------
 // We call this on every cold start - it sets up the OS and the memory map for 
 // the given machine type. It also removes any "carts" that might be mapped into
@@ -129,16 +206,15 @@ void MEMORY_InitialiseMachine(void)
 {
     // Start with all memory clear...
     memset(memory, 0x00, sizeof(memory));
-    memset(xe_mem_buffer, 0x00, sizeof(xe_mem_buffer));
     
     // Set the memory map back to pointing to main memory
     for (int i=0; i<16; i++)
     {
-        mem_map[i] = memory + (0x1000 * i) - (0x1000 * i);  // Yes, pointless except to get across the point that we are offsetting the memory map to avoid having to mask the addr in memory.h
+        MEMORY_MapBank(i, memory + (0x1000 * i) - (0x1000 * i));  // Yes, pointless except to get across the point that we are offsetting the memory map to avoid having to mask the addr in memory.h
     }
     
     // We have 4K of fast DTCM memory that we will map to a common 4K RAM space on the Atari
-    mem_map[0x00]=fast_page-0x0000;
+    MEMORY_MapBank(0x00, fast_page-0x0000);
     
     mem_map[UNDER_0x8] = mem_map[0x8];
     mem_map[UNDER_0x9] = mem_map[0x9];
@@ -167,10 +243,10 @@ void MEMORY_InitialiseMachine(void)
     default: // All of the XL/XE machine types
         SetRAM(0x0000, 0xbfff);
         SetROM(0xc000, 0xffff);
-        mem_map[0xC] = atari_os - 0xc000;
+        MEMORY_MapBank(0xC, atari_os - 0xc000);
         memcpy(memory + 0xd800, atari_os + 0x1800, 0x800);
-        mem_map[0xE] = atari_os - 0xc000;
-        mem_map[0xF] = atari_os - 0xc000;
+        MEMORY_MapBank(0xE, atari_os - 0xc000);
+        MEMORY_MapBank(0xF, atari_os - 0xc000);
         ESC_PatchOS();
         break;       
     }
@@ -181,61 +257,61 @@ void MEMORY_InitialiseMachine(void)
         // Setup the D000-D800 area to point to all the various hardware 
         // chips that trigger on reads and/or writes to that memory area.
         // ----------------------------------------------------------------
-        readmap[0xc0] = GTIA_GetByte;
-        readmap[0xc1] = GTIA_GetByte;
-        readmap[0xc2] = GTIA_GetByte;
-        readmap[0xc3] = GTIA_GetByte;
-        readmap[0xc4] = GTIA_GetByte;
-        readmap[0xc5] = GTIA_GetByte;
-        readmap[0xc6] = GTIA_GetByte;
-        readmap[0xc7] = GTIA_GetByte;
-        readmap[0xc8] = GTIA_GetByte;
-        readmap[0xc9] = GTIA_GetByte;
-        readmap[0xca] = GTIA_GetByte;
-        readmap[0xcb] = GTIA_GetByte;
-        readmap[0xcc] = GTIA_GetByte;
-        readmap[0xcd] = GTIA_GetByte;
-        readmap[0xce] = GTIA_GetByte;
-        readmap[0xcf] = GTIA_GetByte;
+        MEMORY_SetReadHandler(0xc0, GTIA_GetByte);
+        MEMORY_SetReadHandler(0xc1, GTIA_GetByte);
+        MEMORY_SetReadHandler(0xc2, GTIA_GetByte);
+        MEMORY_SetReadHandler(0xc3, GTIA_GetByte);
+        MEMORY_SetReadHandler(0xc4, GTIA_GetByte);
+        MEMORY_SetReadHandler(0xc5, GTIA_GetByte);
+        MEMORY_SetReadHandler(0xc6, GTIA_GetByte);
+        MEMORY_SetReadHandler(0xc7, GTIA_GetByte);
+        MEMORY_SetReadHandler(0xc8, GTIA_GetByte);
+        MEMORY_SetReadHandler(0xc9, GTIA_GetByte);
+        MEMORY_SetReadHandler(0xca, GTIA_GetByte);
+        MEMORY_SetReadHandler(0xcb, GTIA_GetByte);
+        MEMORY_SetReadHandler(0xcc, GTIA_GetByte);
+        MEMORY_SetReadHandler(0xcd, GTIA_GetByte);
+        MEMORY_SetReadHandler(0xce, GTIA_GetByte);
+        MEMORY_SetReadHandler(0xcf, GTIA_GetByte);
         
-        readmap[0xd4] = ANTIC_GetByte;
+        MEMORY_SetReadHandler(0xd4, ANTIC_GetByte);
         
-        readmap[0xe8] = POKEY_GetByte;
-        readmap[0xe9] = POKEY_GetByte;
-        readmap[0xea] = POKEY_GetByte;
-        readmap[0xeb] = POKEY_GetByte;
-        readmap[0xec] = POKEY_GetByte;
-        readmap[0xed] = POKEY_GetByte;
-        readmap[0xee] = POKEY_GetByte;
-        readmap[0xef] = POKEY_GetByte;
+        MEMORY_SetReadHandler(0xe8, POKEY_GetByte);
+        MEMORY_SetReadHandler(0xe9, POKEY_GetByte);
+        MEMORY_SetReadHandler(0xea, POKEY_GetByte);
+        MEMORY_SetReadHandler(0xeb, POKEY_GetByte);
+        MEMORY_SetReadHandler(0xec, POKEY_GetByte);
+        MEMORY_SetReadHandler(0xed, POKEY_GetByte);
+        MEMORY_SetReadHandler(0xee, POKEY_GetByte);
+        MEMORY_SetReadHandler(0xef, POKEY_GetByte);
         
-        writemap[0xc0] = GTIA_PutByte;
-        writemap[0xc1] = GTIA_PutByte;
-        writemap[0xc2] = GTIA_PutByte;
-        writemap[0xc3] = GTIA_PutByte;
-        writemap[0xc4] = GTIA_PutByte;
-        writemap[0xc5] = GTIA_PutByte;
-        writemap[0xc6] = GTIA_PutByte;
-        writemap[0xc7] = GTIA_PutByte;
-        writemap[0xc8] = GTIA_PutByte;
-        writemap[0xc9] = GTIA_PutByte;
-        writemap[0xca] = GTIA_PutByte;
-        writemap[0xcb] = GTIA_PutByte;
-        writemap[0xcc] = GTIA_PutByte;
-        writemap[0xcd] = GTIA_PutByte;
-        writemap[0xce] = GTIA_PutByte;
-        writemap[0xcf] = GTIA_PutByte;
+        MEMORY_SetWriteHandler(0xc0, GTIA_PutByte);
+        MEMORY_SetWriteHandler(0xc1, GTIA_PutByte);
+        MEMORY_SetWriteHandler(0xc2, GTIA_PutByte);
+        MEMORY_SetWriteHandler(0xc3, GTIA_PutByte);
+        MEMORY_SetWriteHandler(0xc4, GTIA_PutByte);
+        MEMORY_SetWriteHandler(0xc5, GTIA_PutByte);
+        MEMORY_SetWriteHandler(0xc6, GTIA_PutByte);
+        MEMORY_SetWriteHandler(0xc7, GTIA_PutByte);
+        MEMORY_SetWriteHandler(0xc8, GTIA_PutByte);
+        MEMORY_SetWriteHandler(0xc9, GTIA_PutByte);
+        MEMORY_SetWriteHandler(0xca, GTIA_PutByte);
+        MEMORY_SetWriteHandler(0xcb, GTIA_PutByte);
+        MEMORY_SetWriteHandler(0xcc, GTIA_PutByte);
+        MEMORY_SetWriteHandler(0xcd, GTIA_PutByte);
+        MEMORY_SetWriteHandler(0xce, GTIA_PutByte);
+        MEMORY_SetWriteHandler(0xcf, GTIA_PutByte);
         
-        writemap[0xd4] = ANTIC_PutByte;
+        MEMORY_SetWriteHandler(0xd4, ANTIC_PutByte);
         
-        writemap[0xe8] = POKEY_PutByte;
-        writemap[0xe9] = POKEY_PutByte;
-        writemap[0xea] = POKEY_PutByte;
-        writemap[0xeb] = POKEY_PutByte;
-        writemap[0xec] = POKEY_PutByte;
-        writemap[0xed] = POKEY_PutByte;
-        writemap[0xee] = POKEY_PutByte;
-        writemap[0xef] = POKEY_PutByte;
+        MEMORY_SetWriteHandler(0xe8, POKEY_PutByte);
+        MEMORY_SetWriteHandler(0xe9, POKEY_PutByte);
+        MEMORY_SetWriteHandler(0xea, POKEY_PutByte);
+        MEMORY_SetWriteHandler(0xeb, POKEY_PutByte);
+        MEMORY_SetWriteHandler(0xec, POKEY_PutByte);
+        MEMORY_SetWriteHandler(0xed, POKEY_PutByte);
+        MEMORY_SetWriteHandler(0xee, POKEY_PutByte);
+        MEMORY_SetWriteHandler(0xef, POKEY_PutByte);
         
     }
     else
@@ -244,31 +320,34 @@ void MEMORY_InitialiseMachine(void)
         // Setup the D000-D800 area to point to all the various hardware 
         // chips that trigger on reads and/or writes to that memory area.
         // ----------------------------------------------------------------
-        readmap[0xd0] = GTIA_GetByte;
-        readmap[0xd1] = PBI_GetByte;
-        readmap[0xd2] = POKEY_GetByte;
-        readmap[0xd3] = PIA_GetByte;
-        readmap[0xd4] = ANTIC_GetByte;
-        readmap[0xd5] = CART_GetByte;
-        readmap[0xd6] = PBIM1_GetByte;
-        readmap[0xd7] = PBIM2_GetByte;
+        MEMORY_SetReadHandler(0xd0, GTIA_GetByte);
+        MEMORY_SetReadHandler(0xd1, PBI_GetByte);
+        MEMORY_SetReadHandler(0xd2, POKEY_GetByte);
+        MEMORY_SetReadHandler(0xd3, PIA_GetByte);
+        MEMORY_SetReadHandler(0xd4, ANTIC_GetByte);
+        MEMORY_SetReadHandler(0xd5, CART_GetByte);
+        MEMORY_SetReadHandler(0xd6, PBIM1_GetByte);
+        MEMORY_SetReadHandler(0xd7, PBIM2_GetByte);
         
-        writemap[0xd0] = GTIA_PutByte;
-        writemap[0xd1] = PBI_PutByte;
-        writemap[0xd2] = POKEY_PutByte;
-        writemap[0xd3] = PIA_PutByte;
-        writemap[0xd4] = ANTIC_PutByte;
-        writemap[0xd5] = CART_PutByte;
-        writemap[0xd6] = PBIM1_PutByte;
-        writemap[0xd7] = PBIM2_PutByte;
+        MEMORY_SetWriteHandler(0xd0, GTIA_PutByte);
+        MEMORY_SetWriteHandler(0xd1, PBI_PutByte);
+        MEMORY_SetWriteHandler(0xd2, POKEY_PutByte);
+        MEMORY_SetWriteHandler(0xd3, PIA_PutByte);
+        MEMORY_SetWriteHandler(0xd4, ANTIC_PutByte);
+        MEMORY_SetWriteHandler(0xd5, CART_PutByte);
+        MEMORY_SetWriteHandler(0xd6, PBIM1_PutByte);
+        MEMORY_SetWriteHandler(0xd7, PBIM2_PutByte);
     }
     
+    BENCH_InstallDevice();  // Optional debug counters in $D1xx or $D6xx - replaces one of the PBI stubs above
+    
     AllocXEMemory();
     
     Cart809F_Disable();    
     CartA0BF_Disable();    
     
     Coldstart();
+    MEMORY_CHECK_PAGES();
 }
 
 // -----------------------------------------------------------------------
@@ -279,7 +358,7 @@ void MEMORY_InitialiseMachine(void)
 static int basic_disabled(UBYTE portb)
 {
     return (portb & 0x02) != 0
-     || ((portb & 0x10) == 0 && (RAM_SIZES[myConfig.machine_type] >= 576));
+     || ((portb & 0x10) == 0 && (RAM_SIZES[mem_machine_type] >= 576));
 }
 
 
@@ -302,25 +381,25 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
     if (myConfig.machine_type <= MACHINE_800_48K) return; // No PORTB handling here...
     
     /* Switch XE memory bank in 0x4000-0x7fff */
-    if (RAM_SIZES[myConfig.machine_type] > 64) 
+    if ((RAM_SIZES[mem_machine_type] > 64) && (atarixe_memory != NULL))
     {
         int bank = 0;
         /* bank = 0 : base RAM */
         /* bank = 1..64 : extended RAM */
         if ((byte & 0x10) == 0)
         {
-            if (RAM_SIZES[myConfig.machine_type] == 128)
+            if (RAM_SIZES[mem_machine_type] == 128)
                 bank = ((byte & 0x0c) >> 2) + 1;
-            else if (RAM_SIZES[myConfig.machine_type] == 320)
+            else if (RAM_SIZES[mem_machine_type] == 320)
                 bank = (((byte & 0x0c) + ((byte & 0x60) >> 1)) >> 2) + 1;
-            else if (RAM_SIZES[myConfig.machine_type] == 576)
+            else if (RAM_SIZES[mem_machine_type] == 576)
                 bank = (((byte & 0x0e) + ((byte & 0xc0) >> 2)) >> 1) + 1;
             else // Assume RAM_1088K
                 bank = (((byte & 0x0e) + ((byte & 0xe0) >> 1)) >> 1) + 1;
         }
         
         /* Note: in Compy Shop bit 5 (ANTIC access) disables Self Test */
-        if (selftest_enabled && ((bank != xe_bank) || (RAM_SIZES[myConfig.machine_type] == 576 && (byte & 0x20) == 0)))
+        if (selftest_enabled && ((bank != xe_bank) || (RAM_SIZES[mem_machine_type] == 576 && (byte & 0x20) == 0)))
         {
             /* Disable Self Test ROM */
             memcpy(memory + 0x5000, under_atarixl_os + 0x1000, 0x800);
@@ -342,14 +421,14 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
             }
             else
             {
-                memory_bank = (atarixe_memory + ((bank-1) << 14));
+                memory_bank = MEMORY_XEBank(bank-1);
                 memory_bank -= 0x4000;
             }
             // Apply no offsets here so we can avoid having to mask addr in memory.h
-            mem_map[0x4] = memory_bank;
-            mem_map[0x5] = memory_bank;
-            mem_map[0x6] = memory_bank;
-            mem_map[0x7] = memory_bank;
+            MEMORY_MapBank(0x4, memory_bank);
+            MEMORY_MapBank(0x5, memory_bank);
+            MEMORY_MapBank(0x6, memory_bank);
+            MEMORY_MapBank(0x7, memory_bank);
             
             xe_bank = bank;
         }
@@ -358,7 +437,7 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
         // The 128k XE RAM and the COMPY 576K RAM allow the Antic 
         // to index into the RAM independently ... tricky stuff!
         // -------------------------------------------------------
-        if ((RAM_SIZES[myConfig.machine_type] == 128) || (RAM_SIZES[myConfig.machine_type] == 576))
+        if ((RAM_SIZES[mem_machine_type] == 128) || (RAM_SIZES[mem_machine_type] == 576))
         {
             switch (byte & 0x30)
             {
@@ -366,10 +445,10 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
                 antic_xe_ptr = memory + 0x4000;
                 break;
             case 0x10:  /* ANTIC: extended, CPU: base */
-                if (RAM_SIZES[myConfig.machine_type] == 128)
-                    antic_xe_ptr = atarixe_memory + ((((byte & 0x0c) >> 2)) << 14);
+                if (RAM_SIZES[mem_machine_type] == 128)
+                    antic_xe_ptr = MEMORY_XEBank(((byte & 0x0c) >> 2));
                 else // Assume RAM_576_COMPY
-                    antic_xe_ptr = atarixe_memory + ((((byte & 0x0e) + ((byte & 0xc0) >> 2)) >> 1) << 14);
+                    antic_xe_ptr = MEMORY_XEBank((((byte & 0x0e) + ((byte & 0xc0) >> 2)) >> 1));
                 break;
             default:    /* ANTIC same as CPU */
                 antic_xe_ptr = NULL;
@@ -384,7 +463,7 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
         if (byte & 0x01) 
         {
             /* Enable OS ROM */
-            if (RAM_SIZES[myConfig.machine_type] > 48) 
+            if (RAM_SIZES[mem_machine_type] > 48) 
             {
                 memcpy(under_atarixl_os + 0x1800, memory + 0xd800, 0x800);
                 SetROM_Fast(0xc000, 0xcfff);
@@ -396,23 +475,23 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
                 memcpy(memory+0xf800, atari_os + 0x3800, 0x800);
             }
             
-            mem_map[0xC] = atari_os - 0xc000;
+            MEMORY_MapBank(0xC, atari_os - 0xc000);
             memcpy(memory + 0xd800, atari_os + 0x1800, 0x800);
-            mem_map[0xE] = atari_os - 0xc000;
-            mem_map[0xF] = atari_os - 0xc000;
+            MEMORY_MapBank(0xE, atari_os - 0xc000);
+            MEMORY_MapBank(0xF, atari_os - 0xc000);
             ESC_PatchOS();
         }
         else 
         {
             /* Disable OS ROM */
-            if (RAM_SIZES[myConfig.machine_type] > 48) 
+            if (RAM_SIZES[mem_machine_type] > 48) 
             {
-                mem_map[0xC] = memory;
+                MEMORY_MapBank(0xC, memory);
                 memcpy(memory + 0xd800, under_atarixl_os + 0x1800, 0x800);
                 SetRAM_Fast(0xc000, 0xcfff);
                 SetRAM_Fast(0xd800, 0xffff);
-                mem_map[0xE] = memory;
-                mem_map[0xF] = memory;
+                MEMORY_MapBank(0xE, memory);
+                MEMORY_MapBank(0xF, memory);
             } 
             else 
             {
@@ -452,8 +531,8 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
                 if (now_disabled) 
                 {
                     /* Disable BASIC ROM */
-                    mem_map[0xA] = mem_map[UNDER_0xA];
-                    mem_map[0xB] = mem_map[UNDER_0xB];
+                    MEMORY_MapBank(0xA, mem_map[UNDER_0xA]);
+                    MEMORY_MapBank(0xB, mem_map[UNDER_0xB]);
                     SetRAM(0xa000, 0xbfff);
                 }
                 else 
@@ -461,8 +540,8 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
                     /* Enable BASIC ROM */
                     mem_map[UNDER_0xA] = mem_map[0xA];
                     mem_map[UNDER_0xB] = mem_map[0xB];
-                    mem_map[0xA] = ROM_basic + 0x0000 - 0xA000;
-                    mem_map[0xB] = ROM_basic + 0x1000 - 0xB000;
+                    MEMORY_MapBank(0xA, ROM_basic + 0x0000 - 0xA000);
+                    MEMORY_MapBank(0xB, ROM_basic + 0x1000 - 0xB000);
                     SetROM(0xa000, 0xbfff);
                 }
             }
@@ -470,7 +549,7 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
 
         /* Enable/disable Self Test ROM in 0x5000-0x57ff */
         /* Note: in Compy Shop bit 5 (ANTIC access) disables Self Test */
-        if ((byte & 0x80) || ((RAM_SIZES[myConfig.machine_type] == 576) && (byte & 0x20) == 0))
+        if ((byte & 0x80) || ((RAM_SIZES[mem_machine_type] == 576) && (byte & 0x20) == 0))
         {
             if (selftest_enabled)
             {
@@ -484,8 +563,8 @@ void MEMORY_HandlePORTB(UBYTE byte, UBYTE oldval)
         {
             /* We can enable Self Test only if the OS ROM is enabled and we are not 576K or 1088K */
             if (!selftest_enabled && (byte & 0x01) && 
-                   !((byte & 0x30) != 0x30 && RAM_SIZES[myConfig.machine_type] == 576) &&
-                   !((byte & 0x10) == 0 && RAM_SIZES[myConfig.machine_type] == 1088)) 
+                   !((byte & 0x30) != 0x30 && RAM_SIZES[mem_machine_type] == 576) &&
+                   !((byte & 0x10) == 0 && RAM_SIZES[mem_machine_type] == 1088)) 
             {
                 /* Enable Self Test ROM */
                 memcpy(under_atarixl_os + 0x1000, memory + 0x5000, 0x800);
@@ -505,8 +584,8 @@ void Cart809F_Disable(void)
     if (cart809F_enabled) 
     {
         /* Restore 0x8000-0x9fff RAM */
-        mem_map[0x8] = mem_map[UNDER_0x8];
-        mem_map[0x9] = mem_map[UNDER_0x9];
+        MEMORY_MapBank(0x8, mem_map[UNDER_0x8]);
+        MEMORY_MapBank(0x9, mem_map[UNDER_0x9]);
         SetRAM(0x8000, 0x9fff);
         cart809F_enabled = FALSE;
     }
@@ -537,14 +616,14 @@ void CartA0BF_Disable(void)
         /* No BASIC if not XL/XE or bit 1 of PORTB set */
         if ((myConfig.machine_type < MACHINE_XLXE_64K) || basic_disabled((UBYTE) (PORTB | PORTB_mask))) 
         {
-            mem_map[0xA] = mem_map[UNDER_0xA];
-            mem_map[0xB] = mem_map[UNDER_0xB];
+            MEMORY_MapBank(0xA, mem_map[UNDER_0xA]);
+            MEMORY_MapBank(0xB, mem_map[UNDER_0xB]);
             SetRAM(0xa000, 0xbfff);
         }
         else
         {
-            mem_map[0xA] = ROM_basic + 0x0000 - 0xA000;
-            mem_map[0xB] = ROM_basic + 0x1000 - 0xB000;
+            MEMORY_MapBank(0xA, ROM_basic + 0x0000 - 0xA000);
+            MEMORY_MapBank(0xB, ROM_basic + 0x1000 - 0xB000);
             SetROM(0xa000, 0xbfff);
         }
         cartA0BF_enabled = FALSE;
@@ -566,7 +645,7 @@ void CartA0BF_Enable(void)
     {
         /* No BASIC if not XL/XE or bit 1 of PORTB set */
         /* or accessing extended 576K or 1088K memory */
-        if (RAM_SIZES[myConfig.machine_type] > 40 && ((myConfig.machine_type < MACHINE_XLXE_64K) || (PORTB & 0x02) || ((PORTB & 0x10) == 0 && (RAM_SIZES[myConfig.machine_type] == 576 || RAM_SIZES[myConfig.machine_type] == 1088)))) 
+        if (RAM_SIZES[mem_machine_type] > 40 && ((myConfig.machine_type < MACHINE_XLXE_64K) || (PORTB & 0x02) || ((PORTB & 0x10) == 0 && (RAM_SIZES[mem_machine_type] == 576 || RAM_SIZES[mem_machine_type] == 1088)))) 
         {
             /* Back-up 0xa000-0xbfff RAM */
             mem_map[UNDER_0xA] = mem_map[0xA];
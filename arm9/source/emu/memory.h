@@ -59,14 +59,32 @@ extern UBYTE *atarixe_memory;
 extern UBYTE cart809F_enabled;
 extern UBYTE cartA0BF_enabled;
 extern UBYTE *mem_map[20];
-extern UBYTE xe_mem_buffer[1024 * 1024];
+extern UBYTE *xe_mem_buffer;
+extern ULONG xe_mem_size;
+extern ULONG xe_banks_zeroed[2];
+extern UBYTE xe_mem_reduced;
+extern UBYTE mem_machine_type;
+UBYTE *MEMORY_XEBank(int idx);
+void MEMORY_XEZeroAll(void);
 
 typedef UBYTE (*rdfunc)(UWORD addr);
 typedef void (*wrfunc)(UWORD addr, UBYTE value);
 extern rdfunc readmap[256];
 extern wrfunc writemap[256];
+extern UBYTE *page_rd[256];
+extern UBYTE *page_wr[256];
 void ROM_PutByte(UWORD addr, UBYTE byte); 
 
+#ifdef DEBUG_PAGES
+void MEMORY_CheckPages(void);
+#define MEMORY_CHECK_PAGES()    MEMORY_CheckPages()
+#else
+#define MEMORY_CHECK_PAGES()
+#endif
+
+extern UBYTE cart_paging;                   // See cartridge.c - set while a large cart is still being demand paged in
+void CART_PageIn(const UBYTE *ptr);
+
 // We extend the mem_map[] by 4 entries to support some 'under' saving of memory blocks where the CART stuff goes...
 #define UNDER_0x8   16
 #define UNDER_0x9   17
@@ -99,9 +117,48 @@ inline void dPutByte(UWORD addr, UBYTE data)
     mem_map[addr >> 12][addr] = data;
 }
 
+// ---------------------------------------------------------------------------------------
+// The page descriptors are the fast path for GetByte()/PutByte(). Each of the 256 pages
+// holds the same pre-offset pointer as its mem_map[] bank when the page is plain memory
+// or NULL when the access has to go through the readmap[]/writemap[] device handler
+// (hardware registers, ROM writes, cart bank-switch hotspots). That turns the common
+// access into a single table load instead of a handler check plus a mem_map[] lookup.
+// Anything that changes mem_map[0..15] must go through MEMORY_MapBank() and anything that
+// installs or removes a device handler through MEMORY_SetReadHandler()/SetWriteHandler()
+// so the two stay in step - nothing else writes page_rd[]/page_wr[] or the handler maps
+// (the UNDER_0x8..B entries are just bookkeeping and can be assigned directly). Build with
+// DEBUG_PAGES to have MEMORY_CHECK_PAGES() verify all 256 pages after the big remaps.
+// ---------------------------------------------------------------------------------------
+inline void MEMORY_MapBank(unsigned int bank, UBYTE *ptr)
+{
+    mem_map[bank] = ptr;
+    if (bank < 16)
+    {
+        if (cart_paging) CART_PageIn(ptr + (bank << 12));
+        for (unsigned int i = (bank << 4); i < ((bank+1) << 4); i++)
+        {
+            page_rd[i] = (readmap[i]  ? NULL : ptr);
+            page_wr[i] = (writemap[i] ? NULL : ptr);
+        }
+    }
+}
+
+// A NULL handler makes the page plain memory again
+inline void MEMORY_SetReadHandler(unsigned int page, rdfunc handler)
+{
+    readmap[page] = handler;
+    page_rd[page] = (handler ? NULL : mem_map[page >> 4]);
+}
+
+inline void MEMORY_SetWriteHandler(unsigned int page, wrfunc handler)
+{
+    writemap[page] = handler;
+    page_wr[page] = (handler ? NULL : mem_map[page >> 4]);
+}
+
 inline UBYTE dGetByteFull(UWORD addr)
 {
-    return (readmap[addr >> 8] ? (*readmap[addr >> 8])(addr) : dGetByte(addr));
+    return (page_rd[addr >> 8] ? page_rd[addr >> 8][addr] : (*readmap[addr >> 8])(addr));
 }
 
 inline UWORD zGetByte(UWORD addr)
@@ -134,34 +191,34 @@ inline void dCopyToMem(void*from, unsigned int to, unsigned int size)
     memcpy(AnticMainMemLookup((unsigned int)to), (UBYTE*)from, size);
 }
 
-#define GetByte(addr)       (readmap[(addr) >> 8] ? (*readmap[(addr) >> 8])(addr)         : dGetByte(addr))
-#define PutByte(addr,byte)  (writemap[(addr) >> 8] ? (*writemap[(addr) >> 8])(addr, byte) : dPutByte(addr, byte))
+#define GetByte(addr)       (page_rd[(addr) >> 8] ? page_rd[(addr) >> 8][addr]         : (*readmap[(addr) >> 8])(addr))
+#define PutByte(addr,byte)  (page_wr[(addr) >> 8] ? (void)(page_wr[(addr) >> 8][addr] = (byte)) : (*writemap[(addr) >> 8])(addr, byte))
 
 #define SetRAM(addr1, addr2) do { \
         int i; \
         for (i = (addr1) >> 8; i <= (addr2) >> 8; i++) { \
-            readmap[i] = NULL; \
-            writemap[i] = NULL; \
+            MEMORY_SetReadHandler(i, NULL); \
+            MEMORY_SetWriteHandler(i, NULL); \
         } \
     } while (0)
 #define SetROM(addr1, addr2) do { \
         int i; \
         for (i = (addr1) >> 8; i <= (addr2) >> 8; i++) { \
-            readmap[i] = NULL; \
-            writemap[i] = ROM_PutByte; \
+            MEMORY_SetReadHandler(i, NULL); \
+            MEMORY_SetWriteHandler(i, ROM_PutByte); \
         } \
     } while (0)
 
 #define SetRAM_Fast(addr1, addr2) do { \
         int i; \
         for (i = (addr1) >> 8; i <= (addr2) >> 8; i++) { \
-            writemap[i] = NULL; \
+            MEMORY_SetWriteHandler(i, NULL); \
         } \
     } while (0)
 #define SetROM_Fast(addr1, addr2) do { \
         int i; \
         for (i = (addr1) >> 8; i <= (addr2) >> 8; i++) { \
-            writemap[i] = ROM_PutByte; \
+            MEMORY_SetWriteHandler(i, ROM_PutByte); \
         } \
     } while (0)
 
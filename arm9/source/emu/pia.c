@@ -55,6 +55,7 @@
 #include "pokey.h"
 #include "sio.h"
 #include "input.h"
+#include "membudget.h"
 
 UBYTE PACTL         __attribute__((section(".dtcm")));
 UBYTE PBCTL         __attribute__((section(".dtcm")));
@@ -77,7 +78,7 @@ int xe_bank __attribute__((section(".dtcm")))= 0;
 int selftest_enabled = 0;
 
 UBYTE atari_os[0x4000];
-UBYTE *atari_os_pristine = (UBYTE *)(0x06898000+0x4000);    // Steal 16K here of VRAM for pristine (unpatched) OS copy which we can memcpy() back to atari_os[] if needed
+UBYTE *atari_os_pristine = (UBYTE *)VRAM_OS_PRISTINE;        // Steal 16K here of VRAM for pristine (unpatched) OS copy which we can memcpy() back to atari_os[] if needed
 
 void PIA_Initialise(void) 
 {
@@ -59,9 +59,112 @@
 #include "pokeysnd.h"
 #include "antic.h"
 #include "esc.h"
+#include "pokey_stream.h"
 
 unsigned short pokeyBufIdx   __attribute__((section(".dtcm"))) = 0;
 char pokey_buffer[SNDLENGTH] __attribute__((section(".dtcm"))) = {0};
+UBYTE pokey_decimate          __attribute__((section(".dtcm"))) = 1;   // Keep 1 of every N samples (N>1 for Fast Forward, 0 for silent Run-Ahead frames)
+UBYTE pokey_decimate_ctr      __attribute__((section(".dtcm"))) = 0;
+
+// ---------------------------------------------------------------------------------
+// Sound on the ARM7 - see pokey_stream.h. While pokey_stream_on is set we only log
+// the sound register writes and scanline ticks here and the ARM7 does the rest.
+// We keep our own copy of head and a count of known free entries so that the push
+// is normally just one store into the ring and one store of head (both uncached).
+// ---------------------------------------------------------------------------------
+UBYTE pokey_stream_on               __attribute__((section(".dtcm"))) = 0;
+static UBYTE pokey_stream_resync    __attribute__((section(".dtcm"))) = 0;
+static UBYTE pokey_stream_stimer    __attribute__((section(".dtcm"))) = 0;     // An STIMER was dropped - the resync has to repeat it
+static u32 pokey_stream_head        __attribute__((section(".dtcm"))) = 0;
+static u32 pokey_stream_room        __attribute__((section(".dtcm"))) = 0;
+static PokeyStream_t *pokey_stream  __attribute__((section(".dtcm"))) = NULL;     // Uncached view of the ring
+static PokeyStream_t pokey_stream_buf __attribute__((aligned(32)));
+
+ITCM_CODE static void POKEY_StreamPush(u32 entry)
+{
+    if (pokey_stream_room == 0)
+    {
+        pokey_stream_room = (pokey_stream->tail - pokey_stream_head - 1) & POKEY_STREAM_MASK;
+        if (pokey_stream_room == 0)
+        {
+            // The ARM7 is behind - drop the entry rather than stall the emulation and put the registers back once there is room
+            pokey_stream_resync = 1;
+            if (POKEY_STREAM_REG(entry) == _STIMER) pokey_stream_stimer = 1;     // TICKs have register 0
+            return;
+        }
+    }
+    pokey_stream_room--;
+    pokey_stream->ring[pokey_stream_head] = entry;
+    pokey_stream_head = (pokey_stream_head + 1) & POKEY_STREAM_MASK;
+    pokey_stream->head = pokey_stream_head;
+}
+
+// ---------------------------------------------------------------------------------
+// Re-send all of the sound registers so the ARM7 synthesizer matches the machine
+// again. STIMER has no register to re-send - it is a strobe that restarts the
+// channel counters - so it is only repeated (after the AUDFs, as a game would do
+// it) when the one that was written got dropped. If any of this is dropped in turn
+// the flags are set again and we have another go on the next scanline.
+// ---------------------------------------------------------------------------------
+static void POKEY_StreamPushRegisters(void)
+{
+    pokey_stream_resync = 0;
+    POKEY_StreamPush(POKEY_STREAM_WRITE(_SKCTLS, SKCTLS));
+    POKEY_StreamPush(POKEY_STREAM_WRITE(_AUDCTL, AUDCTL[0]));
+    for (int chan = CHAN1; chan <= CHAN4; chan++)
+    {
+        POKEY_StreamPush(POKEY_STREAM_WRITE(_AUDF1 + (chan << 1), AUDF[chan]));
+        POKEY_StreamPush(POKEY_STREAM_WRITE(_AUDC1 + (chan << 1), AUDC[chan]));
+    }
+    if (pokey_stream_stimer)
+    {
+        pokey_stream_stimer = 0;
+        POKEY_StreamPush(POKEY_STREAM_WRITE(_STIMER, 0));
+    }
+}
+
+// Called after anything that changes the POKEY registers behind our back (loading a save state)
+void POKEY_StreamResync(void)
+{
+    pokey_stream_resync = 1;
+}
+
+u32 POKEY_StreamUnderruns(void)
+{
+    return pokey_stream ? pokey_stream->underruns : 0;
+}
+
+// ---------------------------------------------------------------------------------
+// Turn the stream on or off. Returns the ring (cached address - the ARM7 doesn't see
+// the ARM9 uncached mirror on the DSi) to hand to the ARM7 or NULL when turned off.
+// ---------------------------------------------------------------------------------
+void *POKEY_StreamEnable(UBYTE enable)
+{
+    pokey_stream_on = 0;
+    if (!enable) return NULL;
+
+    // Make sure no dirty cache lines for the ring are sitting around to be written back over the ARM7's tail
+    DC_FlushRange(&pokey_stream_buf, sizeof(pokey_stream_buf));
+    DC_FlushRange(poly9_lookup, sizeof(poly9_lookup));
+    DC_FlushRange(poly17_lookup, sizeof(poly17_lookup));
+
+    pokey_stream = (PokeyStream_t *) memUncached(&pokey_stream_buf);
+    pokey_stream->poly9 = poly9_lookup;
+    pokey_stream->poly17 = poly17_lookup;
+    pokey_stream_head = pokey_stream->head;
+    pokey_stream_room = 0;
+    pokey_stream_resync = 1;    // The ARM7 starts from a freshly initialized synthesizer - give it the registers
+    pokey_stream_on = 1;
+
+    return &pokey_stream_buf;
+}
+
+// Run-Ahead frames (pokey_decimate == 0) are never heard so their writes are not sent to the ARM7 either
+#define POKEY_SOUND_UPDATE(reg, byte)                                                                   \
+    do {                                                                                                \
+        if (pokey_stream_on) { if (pokey_decimate) POKEY_StreamPush(POKEY_STREAM_WRITE(reg, byte)); }   \
+        else Update_pokey_sound(reg, byte, 0, SOUND_GAIN);                                              \
+    } while (0)
 
 UBYTE KBCODE    __attribute__((section(".dtcm")));
 UBYTE SERIN     __attribute__((section(".dtcm")));
@@ -77,8 +180,27 @@ int DELAYED_XMTDONE_IRQ;
 UBYTE AUDF[4 * MAXPOKEYS]   __attribute__((section(".dtcm")));  /* AUDFx (D200, D202, D204, D206) */
 UBYTE AUDC[4 * MAXPOKEYS]   __attribute__((section(".dtcm")));  /* AUDCx (D201, D203, D205, D207) */
 UBYTE AUDCTL[MAXPOKEYS]     __attribute__((section(".dtcm")));  /* AUDCTL (D208) */
-int DivNIRQ[4]              __attribute__((section(".dtcm")));
+int DivNIRQ[4];             /* Only used to hold cycles-to-underflow for save states - see POKEY_SaveTimers() */
 int DivNMax[4]              __attribute__((section(".dtcm")));
+
+/* ---------------------------------------------------------------------------------------
+   POKEY timer events. Rather than counting every timer down on every scanline, each timer
+   holds the absolute CPU cycle of its next underflow and we keep the earliest of those in
+   pokey_next_event. Only timers with their IRQ enabled are scheduled - the others can't be
+   seen by the program so they are just brought up to date (in the same phase as if they had
+   been counting) once a frame in POKEY_Frame() - the wrap-safe compare only works within 2^31
+   cycles of the due time, about 20 minutes - and again when their IRQ is turned on or a save
+   state needs them. With no timer IRQs
+   enabled POKEY_TimerEvents() never runs and the timers cost a single compare per scanline.
+   STIMER sets the phase from the exact cycle of the write rather than the start of the scanline.
+   --------------------------------------------------------------------------------------- */
+unsigned int DivNDue[4]     __attribute__((section(".dtcm")));
+unsigned int pokey_next_event __attribute__((section(".dtcm")));
+
+#define CYCLE_REACHED(due)  ((int)(screenline_cpu_clock - (due)) >= 0)   /* wrap-safe */
+#define TIMER_IDLE_HORIZON  0x10000000  /* Nothing scheduled - look again in a couple of minutes */
+
+static const UBYTE timer_irq_bit[4] = {0x01, 0x02, 0x00, 0x04};  /* IRQEN bit for each timer (CHAN3 has none) */
 int Base_mult[MAXPOKEYS]    __attribute__((section(".dtcm")));  /* selects either 64Khz or 15Khz clock mult */
 
 UBYTE POT_input[8] = {228, 228, 228, 228, 228, 228, 228, 228};
@@ -157,29 +279,25 @@ static int POKEY_siocheck(void)
         && (AUDCTL[0] & 0x28) == 0x28;
 }
 
-#ifndef SOUND_GAIN /* sound gain can be pre-defined in the configure/Makefile */
-#define SOUND_GAIN 4
-#endif
-
 ITCM_CODE void POKEY_PutByte(UWORD addr, UBYTE byte)
 {
     addr &= 0x0f;
     switch (addr) {
     case _AUDC1:
         AUDC[CHAN1] = byte;
-        Update_pokey_sound(_AUDC1, byte, 0, SOUND_GAIN);
+        POKEY_SOUND_UPDATE(_AUDC1, byte);
         break;
     case _AUDC2:
         AUDC[CHAN2] = byte;
-        Update_pokey_sound(_AUDC2, byte, 0, SOUND_GAIN);
+        POKEY_SOUND_UPDATE(_AUDC2, byte);
         break;
     case _AUDC3:
         AUDC[CHAN3] = byte;
-        Update_pokey_sound(_AUDC3, byte, 0, SOUND_GAIN);
+        POKEY_SOUND_UPDATE(_AUDC3, byte);
         break;
     case _AUDC4:
         AUDC[CHAN4] = byte;
-        Update_pokey_sound(_AUDC4, byte, 0, SOUND_GAIN);
+        POKEY_SOUND_UPDATE(_AUDC4, byte);
         break;
     case _AUDCTL:
         AUDCTL[0] = byte;
@@ -191,30 +309,34 @@ ITCM_CODE void POKEY_PutByte(UWORD addr, UBYTE byte)
             Base_mult[0] = DIV_64;
 
         Update_Counter((1 << CHAN1) | (1 << CHAN2) | (1 << CHAN3) | (1 << CHAN4));
-        Update_pokey_sound(_AUDCTL, byte, 0, SOUND_GAIN);
+        POKEY_SOUND_UPDATE(_AUDCTL, byte);
         break;
     case _AUDF1:
         AUDF[CHAN1] = byte;
         Update_Counter((AUDCTL[0] & CH1_CH2) ? ((1 << CHAN2) | (1 << CHAN1)) : (1 << CHAN1));
-        Update_pokey_sound(_AUDF1, byte, 0, SOUND_GAIN);
+        POKEY_SOUND_UPDATE(_AUDF1, byte);
         break;
     case _AUDF2:
         AUDF[CHAN2] = byte;
         Update_Counter(1 << CHAN2);
-        Update_pokey_sound(_AUDF2, byte, 0, SOUND_GAIN);
+        POKEY_SOUND_UPDATE(_AUDF2, byte);
         break;
     case _AUDF3:
         AUDF[CHAN3] = byte;
         Update_Counter((AUDCTL[0] & CH3_CH4) ? ((1 << CHAN4) | (1 << CHAN3)) : (1 << CHAN3));
-        Update_pokey_sound(_AUDF3, byte, 0, SOUND_GAIN);
+        POKEY_SOUND_UPDATE(_AUDF3, byte);
         break;
     case _AUDF4:
         AUDF[CHAN4] = byte;
         Update_Counter(1 << CHAN4);
-        Update_pokey_sound(_AUDF4, byte, 0, SOUND_GAIN);
+        POKEY_SOUND_UPDATE(_AUDF4, byte);
         break;
     case _IRQEN:
+        for (int chan = 0; chan < 4; chan++)
+            if (byte & ~IRQEN & timer_irq_bit[chan])
+                POKEY_CatchUpTimer(chan);
         IRQEN = byte;
+        POKEY_ScheduleTimers();
         IRQST |= ~byte & 0xf7;  /* Reset disabled IRQs except XMTDONE */
         if (IRQEN & 0x20) {
             SLONG delay;
@@ -266,14 +388,15 @@ ITCM_CODE void POKEY_PutByte(UWORD addr, UBYTE byte)
         };
         break;
     case _STIMER:
-        DivNIRQ[CHAN1] = DivNMax[CHAN1];
-        DivNIRQ[CHAN2] = DivNMax[CHAN2];
-        DivNIRQ[CHAN4] = DivNMax[CHAN4];
-        Update_pokey_sound(_STIMER, byte, 0, SOUND_GAIN);
+        DivNDue[CHAN1] = cpu_clock + DivNMax[CHAN1];
+        DivNDue[CHAN2] = cpu_clock + DivNMax[CHAN2];
+        DivNDue[CHAN4] = cpu_clock + DivNMax[CHAN4];
+        POKEY_ScheduleTimers();
+        POKEY_SOUND_UPDATE(_STIMER, byte);
         break;
     case _SKCTLS:
         SKCTLS = byte;
-        Update_pokey_sound(_SKCTLS, byte, 0, SOUND_GAIN);
+        POKEY_SOUND_UPDATE(_SKCTLS, byte);
         if (byte & 4)
             pot_scanline = 228; /* fast pot mode - return results immediately */
         if ((byte & 0x03) == 0)
@@ -319,7 +442,11 @@ void POKEY_Initialise(void)
     }
 
     for (i = 0; i < 4; i++)
+    {
         DivNIRQ[i] = DivNMax[i] = 0;
+        DivNDue[i] = screenline_cpu_clock;
+    }
+    POKEY_ScheduleTimers();
 
     pot_scanline = 0;
 
@@ -342,6 +469,11 @@ void POKEY_Initialise(void)
 void POKEY_Frame(void)
 {
     random_scanline_counter %= (AUDCTL[0] & POLY9) ? POLY9_SIZE : POLY17_SIZE;
+
+    // Keep the unscheduled timers (and CHAN3, which has no IRQ) within a frame of the present
+    for (int chan = 0; chan < 4; chan++)
+        if (!(IRQEN & timer_irq_bit[chan]))
+            POKEY_CatchUpTimer(chan);
 }
 
 /***************************************************************************
@@ -351,8 +483,24 @@ void POKEY_Frame(void)
  ***************************************************************************/
 ITCM_CODE void POKEY_Scanline(void)
 {
-    Pokey_process(&pokey_buffer[pokeyBufIdx], 1);   // Each scanline, compute 1 output samples. This corresponds to a 15720Khz output sample rate if running at 60FPS (good enough)
-    pokeyBufIdx = (pokeyBufIdx+1) & (SNDLENGTH-1);
+    if (pokey_decimate) // Run-Ahead frames are never heard so we don't bother producing sound for them
+    {
+        // When running in Fast Forward, we only keep every Nth sample so the ARM7 consumer isn't lapped... the sound just plays back 'faster'
+        UBYTE keep = (++pokey_decimate_ctr >= pokey_decimate);
+        if (keep) pokey_decimate_ctr = 0;
+
+        if (pokey_stream_on)
+        {
+            // The ARM7 synthesizes this scanline's sample - we just mark the spot in the stream
+            if (pokey_stream_resync) POKEY_StreamPushRegisters();
+            POKEY_StreamPush(keep ? (POKEY_STREAM_TICK | POKEY_STREAM_KEEP) : POKEY_STREAM_TICK);
+        }
+        else
+        {
+            Pokey_process(&pokey_buffer[pokeyBufIdx], 1);   // Each scanline, compute 1 output samples. This corresponds to a 15720Khz output sample rate if running at 60FPS (good enough)
+            if (keep) pokeyBufIdx = (pokeyBufIdx+1) & (SNDLENGTH-1);
+        }
+    }
 
     if (pot_scanline < 228)
         pot_scanline++;
@@ -361,6 +509,14 @@ ITCM_CODE void POKEY_Scanline(void)
 
     random_scanline_counter += LINE_C;
 
+    if (CYCLE_REACHED(pokey_next_event))
+    {
+        POKEY_TimerEvents();
+    }
+
+    // Serial I/O is idle nearly all of the time... one test gets us past all three
+    if ((DELAYED_SERIN_IRQ | DELAYED_SEROUT_IRQ | DELAYED_XMTDONE_IRQ) == 0) return;
+
     if (DELAYED_SERIN_IRQ > 0)
     {
         if (--DELAYED_SERIN_IRQ == 0)
@@ -406,30 +562,77 @@ ITCM_CODE void POKEY_Scanline(void)
 
         }
     }
+}
 
-    if ((DivNIRQ[CHAN1] -= LINE_C) < 0 ) {
-        DivNIRQ[CHAN1] += DivNMax[CHAN1];
-        if (IRQEN & 0x01) {
-            IRQST &= 0xfe;
-            GenerateIRQ();
-        }
+/***************************************************************************
+ ** Bring an unscheduled timer up to its first underflow after this line  **
+ ***************************************************************************/
+void POKEY_CatchUpTimer(int chan)
+{
+    if (!CYCLE_REACHED(DivNDue[chan])) return;
+    if (DivNMax[chan])
+        DivNDue[chan] += ((screenline_cpu_clock - DivNDue[chan]) / DivNMax[chan] + 1) * DivNMax[chan];
+    else
+        DivNDue[chan] = screenline_cpu_clock;   /* AUDF never written since the reset - just keep it current */
+}
+
+/***************************************************************************
+ ** Find the earliest of the timers with their IRQ enabled (CHAN3 has no  **
+ ** IRQ at all)                                                           **
+ ***************************************************************************/
+void POKEY_ScheduleTimers(void)
+{
+    pokey_next_event = screenline_cpu_clock + TIMER_IDLE_HORIZON;
+    if ((IRQEN & 0x01) && ((int)(DivNDue[CHAN1] - pokey_next_event) < 0)) pokey_next_event = DivNDue[CHAN1];
+    if ((IRQEN & 0x02) && ((int)(DivNDue[CHAN2] - pokey_next_event) < 0)) pokey_next_event = DivNDue[CHAN2];
+    if ((IRQEN & 0x04) && ((int)(DivNDue[CHAN4] - pokey_next_event) < 0)) pokey_next_event = DivNDue[CHAN4];
+}
+
+/***************************************************************************
+ ** One or more timers have underflowed - fire their IRQs and reschedule  **
+ ***************************************************************************/
+ITCM_CODE void POKEY_TimerEvents(void)
+{
+    if ((IRQEN & 0x01) && CYCLE_REACHED(DivNDue[CHAN1])) {
+        DivNDue[CHAN1] += DivNMax[CHAN1];
+        IRQST &= 0xfe;
+        GenerateIRQ();
     }
 
-    if ((DivNIRQ[CHAN2] -= LINE_C) < 0 ) {
-        DivNIRQ[CHAN2] += DivNMax[CHAN2];
-        if (IRQEN & 0x02) {
-            IRQST &= 0xfd;
-            GenerateIRQ();
-        }
+    if ((IRQEN & 0x02) && CYCLE_REACHED(DivNDue[CHAN2])) {
+        DivNDue[CHAN2] += DivNMax[CHAN2];
+        IRQST &= 0xfd;
+        GenerateIRQ();
     }
 
-    if ((DivNIRQ[CHAN4] -= LINE_C) < 0 ) {
-        DivNIRQ[CHAN4] += DivNMax[CHAN4];
-        if (IRQEN & 0x04) {
-            IRQST &= 0xfb;
-            GenerateIRQ();
-        }
+    if ((IRQEN & 0x04) && CYCLE_REACHED(DivNDue[CHAN4])) {
+        DivNDue[CHAN4] += DivNMax[CHAN4];
+        IRQST &= 0xfb;
+        GenerateIRQ();
     }
+
+    POKEY_ScheduleTimers();
+}
+
+/***************************************************************************
+ ** Save states hold the timers as cycles-to-underflow (DivNIRQ[]) so the **
+ ** file format is unchanged. Only valid between frames.                  **
+ ***************************************************************************/
+void POKEY_SaveTimers(void)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        if (timer_irq_bit[i] && !(IRQEN & timer_irq_bit[i]))
+            POKEY_CatchUpTimer(i);
+        DivNIRQ[i] = (int)(DivNDue[i] - screenline_cpu_clock);
+    }
+}
+
+void POKEY_RestoreTimers(void)
+{
+    for (int i = 0; i < 4; i++)
+        DivNDue[i] = screenline_cpu_clock + DivNIRQ[i];
+    POKEY_ScheduleTimers();
 }
 
 /*****************************************************************************/
@@ -97,6 +97,11 @@ void POKEY_PutByte(UWORD addr, UBYTE byte);
 void POKEY_Initialise(void);
 void POKEY_Frame(void);
 void POKEY_Scanline(void);
+void POKEY_ScheduleTimers(void);
+void POKEY_TimerEvents(void);
+void POKEY_CatchUpTimer(int chan);
+void POKEY_SaveTimers(void);
+void POKEY_RestoreTimers(void);
 
 /* CONSTANT DEFINITIONS */
 
@@ -143,6 +148,8 @@ void POKEY_Scanline(void);
 
 extern unsigned short pokeyBufIdx;
 extern char pokey_buffer[SNDLENGTH];
+extern UBYTE pokey_decimate;
+extern UBYTE pokey_decimate_ctr;
 extern UBYTE KBCODE;
 extern UBYTE SERIN;
 extern UBYTE IRQST;
@@ -157,6 +164,8 @@ extern UBYTE AUDC[4 * MAXPOKEYS];
 extern UBYTE AUDCTL[MAXPOKEYS];
 extern int DivNIRQ[4];
 extern int DivNMax[4];
+extern unsigned int DivNDue[4];
+extern unsigned int pokey_next_event;
 extern int Base_mult[MAXPOKEYS];
 extern UBYTE POT_input[8];
 extern UBYTE PCPOT_input[8];
@@ -165,6 +174,11 @@ extern UBYTE pot_scanline;
 extern ULONG random_scanline_counter;
 extern UBYTE poly9_lookup[511];
 extern UBYTE poly17_lookup[16385];
+extern UBYTE pokey_stream_on;
+
+void *POKEY_StreamEnable(UBYTE enable);
+void POKEY_StreamResync(void);
+u32  POKEY_StreamUnderruns(void);
 
 
 #endif
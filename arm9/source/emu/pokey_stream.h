@@ -0,0 +1,58 @@
+/*
+ * POKEY_STREAM.H contains the register-write stream shared between the ARM9 and ARM7.
+ *
+ * A8DS - Atari 8-bit Emulator designed to run on the Nintendo DS/DSi is
+ * Copyright (c) 2021-2025 Dave Bernazzani (wavemotion-dave)
+
+ * Copying and distribution of this emulator, its source code and associated
+ * readme files, with or without modification, are permitted in any medium without
+ * royalty provided this full copyright notice (including the Atari800 one below)
+ * is used and wavemotion-dave, alekmaul (original port), Atari800 team (for the
+ * original source) and Avery Lee (Altirra OS) are credited and thanked profusely.
+ *
+ * The A8DS emulator is offered as-is, without any warranty.
+ *
+ * Since much of the original codebase came from the Atari800 project, and since
+ * that project is released under the GPL V2, this program and source must also
+ * be distributed using that same licensing model. See COPYING for the full license.
+ */
+#ifndef _POKEY_STREAM_H_
+#define _POKEY_STREAM_H_
+
+#include <nds.h>
+
+// ---------------------------------------------------------------------------------
+// When the ARM7 does the POKEY synthesis, the ARM9 no longer calls Pokey_process()
+// every scanline. Instead it drops a small entry into this ring for every sound
+// register write and one TICK entry per emulated scanline. The ARM7 replays them in
+// order on its own sample timer - apply the writes, run Pokey_process() for one
+// sample on each TICK and play the sample if the TICK is marked KEEP (Fast Forward
+// only keeps every Nth one, same as pokey_decimate does for the ARM9 path). The
+// scanline is the timestamp - writes are placed between the TICKs they fell between.
+//
+// The ring lives in main RAM. The ARM9 only ever writes head and the ARM7 only ever
+// writes tail (and underruns) so no locking is needed. The ARM9 goes through the
+// uncached mirror. The ring is volatile too so the compiler can't move an entry's
+// store after the head store that hands it over (or the ARM7's read before it).
+// ---------------------------------------------------------------------------------
+#define POKEY_STREAM_SIZE   4096                // Entries - must be power of 2. About 2 frames of scanlines plus the writes.
+#define POKEY_STREAM_MASK   (POKEY_STREAM_SIZE-1)
+
+#define POKEY_STREAM_TICK   0x80000000          // One scanline worth of synthesis (one output sample)
+#define POKEY_STREAM_KEEP   0x40000000          // ...and this sample is the one to be heard
+
+#define POKEY_STREAM_WRITE(reg, val)    ((((reg) & 0x0f) << 8) | ((val) & 0xff))
+#define POKEY_STREAM_REG(entry)         (((entry) >> 8) & 0x0f)
+#define POKEY_STREAM_VAL(entry)         ((entry) & 0xff)
+
+typedef struct
+{
+    volatile u32    head;                       // Next entry the ARM9 will write
+    volatile u32    tail;                       // Next entry the ARM7 will read
+    volatile u32    underruns;                  // Sample ticks where the ARM7 ran dry before a KEEP - for the bench device
+    const u8       *poly9;                      // The ARM9 poly9_lookup[] and poly17_lookup[] so the ARM7 doesn't need its own copies
+    const u8       *poly17;
+    volatile u32    ring[POKEY_STREAM_SIZE];
+} PokeyStream_t;
+
+#endif // _POKEY_STREAM_H_
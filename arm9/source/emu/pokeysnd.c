@@ -52,24 +52,44 @@
 #include "atari.h"
 #include "pokeysnd.h"
 
-#define READ_U32(x) \
-  ((*(unsigned char *) (x)) | ((*((unsigned char *) (x) + 1)) << 8) | \
-  ((*((unsigned char *) (x) + 2)) << 16) | ((*((unsigned char *) (x) + 3)) << 24))
-#define WRITE_U32(x, d) \
-  { \
-  uint32 i = d; \
-  (*(unsigned char *)(x)) = ((i) & 255); \
-  (*((unsigned char *)(x) + 1)) = (((i) >> 8) & 255); \
-  (*((unsigned char *)(x) + 2)) = (((i) >> 16) & 255); \
-  (*((unsigned char *)(x) + 3)) = (((i) >> 24) & 255); \
-  }
-
+// ---------------------------------------------------------------------------------
+// This same file is built into the ARM7 binary (see arm7/source/pokeystream7.c) so
+// the ARM7 can do the synthesis from the register-write stream. The ARM7 has no
+// TCMs (it all runs from IWRAM anyway) and it reads the poly9/poly17 tables that
+// the ARM9 built rather than keeping 16K of its own.
+// ---------------------------------------------------------------------------------
+#ifdef ARM7
+#define POKEYSND_DTCM
+#define POKEYSND_ITCM
+extern const UBYTE *pokey_poly9;
+extern const UBYTE *pokey_poly17;
+#define POKEY_POLY9     pokey_poly9
+#define POKEY_POLY17    pokey_poly17
+#else
+#define POKEYSND_DTCM   __attribute__((section(".dtcm")))
+#define POKEYSND_ITCM   ITCM_CODE
+#define POKEY_POLY9     poly9_lookup
+#define POKEY_POLY17    poly17_lookup
+#endif
+
+// ---------------------------------------------------------------------------------
+// Neither the ARM946E-S nor the ARM7TDMI has a divide instruction so the '%' on the
+// poly positions is a multiply-by-reciprocal sequence on every channel event. Most
+// events are short (high notes, or several channels running) so for anything under
+// POKEY_MAX_EVENT the short polys wrap via a small table and the long ones with a
+// conditional subtract. Events are NOT bounded by the sample period though - a
+// SAMPLE doesn't move time on, so a low note or a channel starting up after a quiet
+// stretch can be millions of clocks - and those still take the '%'.
+// ---------------------------------------------------------------------------------
+#define POKEY_MAX_EVENT 256
+static uint8 poly4_wrap[POLY4_SIZE + POKEY_MAX_EVENT];
+static uint8 poly5_wrap[POLY5_SIZE + POKEY_MAX_EVENT];
 
 /* number of pokey chips currently emulated */
-uint8 Num_pokeys __attribute__((section(".dtcm")));
-uint8 AUDV[4 * MAXPOKEYS] __attribute__((section(".dtcm"))); /* Channel volume - derived */
-uint8 Outbit[4 * MAXPOKEYS] __attribute__((section(".dtcm")));       /* current state of the output (high or low) */
-uint8 Outvol[4 * MAXPOKEYS] __attribute__((section(".dtcm")));       /* last output volume for each channel */
+uint8 Num_pokeys POKEYSND_DTCM;
+uint8 AUDV[4 * MAXPOKEYS] POKEYSND_DTCM; /* Channel volume - derived */
+uint8 Outbit[4 * MAXPOKEYS] POKEYSND_DTCM;       /* current state of the output (high or low) */
+uint8 Outvol[4 * MAXPOKEYS] POKEYSND_DTCM;       /* last output volume for each channel */
 
 /* Initialze the bit patterns for the polynomials. */
 
@@ -78,19 +98,19 @@ uint8 Outvol[4 * MAXPOKEYS] __attribute__((section(".dtcm")));       /* last out
 /* single bit per byte keeps the math simple, which is important for */
 /* efficient processing. */
 
-static uint8 bit4[POLY4_SIZE] __attribute__((section(".dtcm"))) =
+static uint8 bit4[POLY4_SIZE] POKEYSND_DTCM =
 {1, 1, 1, 1, 0, 0, 0, 1, 0, 0, 1, 1, 0, 1, 0};  /* new table invented by Perry */
 
-static uint8 bit5[POLY5_SIZE] __attribute__((section(".dtcm"))) =
+static uint8 bit5[POLY5_SIZE] POKEYSND_DTCM =
 {1, 1, 1, 1, 0, 1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0};
 
-uint32 P4 __attribute__((section(".dtcm"))) = 0;     /* Global position pointer for the 4-bit  POLY array */
-uint32 P5 __attribute__((section(".dtcm"))) = 0;     /* Global position pointer for the 5-bit  POLY array */
-uint32 P9 __attribute__((section(".dtcm"))) = 0;     /* Global position pointer for the 9-bit  POLY array */
-uint32 P17 __attribute__((section(".dtcm"))) = 0;    /* Global position pointer for the 17-bit POLY array */
+uint32 P4 POKEYSND_DTCM = 0;     /* Global position pointer for the 4-bit  POLY array */
+uint32 P5 POKEYSND_DTCM = 0;     /* Global position pointer for the 5-bit  POLY array */
+uint32 P9 POKEYSND_DTCM = 0;     /* Global position pointer for the 9-bit  POLY array */
+uint32 P17 POKEYSND_DTCM = 0;    /* Global position pointer for the 17-bit POLY array */
 
-uint32 Div_n_cnt[4 * MAXPOKEYS] __attribute__((section(".dtcm")));       /* Divide by n counter. one for each channel */
-uint32 Div_n_max[4 * MAXPOKEYS] __attribute__((section(".dtcm")));       /* Divide by n maximum, one for each channel */
+uint32 Div_n_cnt[4 * MAXPOKEYS] POKEYSND_DTCM;       /* Divide by n counter. one for each channel */
+uint32 Div_n_max[4 * MAXPOKEYS] POKEYSND_DTCM;       /* Divide by n maximum, one for each channel */
 
 uint32 Samp_n_max       __attribute__ ((aligned (4)));     /* Sample max.  For accuracy, it is *256 */
 uint32 Samp_n_cnt[2]    __attribute__ ((aligned (4)));     /* Sample cnt. */
@@ -135,6 +155,12 @@ void (*Update_pokey_sound) (uint16 addr, uint8 val, uint8 chip, uint8 gain) = nu
 /* while (uint32 *)((uint8 *)(&Samp_n_cnt[0])+3) gives me the 32-bit whole   */
 /* number only.                                                              */
 /*****************************************************************************/
+// A8DS: the whole part is only ever reduced by event_min, which is never more
+// than the whole part itself, so nothing ever borrows into byte 4 and it stays
+// zero. The '+= Samp_n_max' was always a plain 32-bit add on Samp_n_cnt[0] so
+// we simply work in 24.8 there (wrapping exactly as before) - no unaligned
+// byte-by-byte pointer tricks. The second word is kept only so the save state
+// layout doesn't change.
 
 
 /*****************************************************************************/
@@ -168,6 +194,9 @@ static int Pokey_sound_init_rf(uint32 freq17, uint16 playback_freq, uint8 num_po
     /* calculate the sample 'divide by N' value based on the playback freq. */
     Samp_n_max = ((uint32) freq17 << 8) / playback_freq;
 
+    for (int i = 0; i < (POLY4_SIZE + POKEY_MAX_EVENT); i++) poly4_wrap[i] = i % POLY4_SIZE;
+    for (int i = 0; i < (POLY5_SIZE + POKEY_MAX_EVENT); i++) poly5_wrap[i] = i % POLY5_SIZE;
+
     Samp_n_cnt[0] = 0;          /* initialize all bits of the sample */
     Samp_n_cnt[1] = 0;          /* 'divide by N' counter */
 
@@ -390,13 +419,12 @@ static void Update_pokey_sound_rf(uint16 addr, uint8 val, uint8 chip, uint8 gain
 /* Outputs: the buffer will be filled with n bytes of audio - no return val  */
 /*                                                                           */
 /*****************************************************************************/
-ITCM_CODE void Pokey_process(void *sndbuffer, unsigned sndn)
+POKEYSND_ITCM void Pokey_process(void *sndbuffer, unsigned sndn)
 {
     register char *buffer = (char  *) sndbuffer;
     register uint16 n = sndn;
 
     register uint32 *div_n_ptr;
-    register uint8 *samp_cnt_w_ptr;
     register uint32 event_min;
     register uint8 next_event;
     register unsigned char cur_val;     /* otherwise we'll simplify as 8-bit unsigned */
@@ -405,9 +433,6 @@ ITCM_CODE void Pokey_process(void *sndbuffer, unsigned sndn)
     register uint8 toggle;
     register uint8 *vol_ptr;
   
-    /* set a pointer to the whole portion of the samp_n_cnt */
-    samp_cnt_w_ptr = ((uint8 *) (&Samp_n_cnt[0]) + 1);
-
     /* set a pointer for optimization */
     out_ptr = Outvol;
     vol_ptr = AUDV;
@@ -439,7 +464,7 @@ ITCM_CODE void Pokey_process(void *sndbuffer, unsigned sndn)
 
         /* find next smallest event (either sample or chan 1-4) */
         next_event = SAMPLE;
-        event_min = READ_U32(samp_cnt_w_ptr);
+        event_min = Samp_n_cnt[0] >> 8;
 
         div_n_ptr = Div_n_cnt;
 
@@ -480,17 +505,26 @@ ITCM_CODE void Pokey_process(void *sndbuffer, unsigned sndn)
       div_n_ptr--;
       *div_n_ptr -= event_min;
 
-            WRITE_U32(samp_cnt_w_ptr, READ_U32(samp_cnt_w_ptr) - event_min);
+            Samp_n_cnt[0] -= (event_min << 8);  /* whole part only - the fraction carries over */
 
-            /* since the polynomials require a mod (%) function which is
-               division, I don't adjust the polynomials on the SAMPLE events,
-               only the CHAN events.  I have to keep track of the change,
-               though. */
+            /* I don't adjust the polynomials on the SAMPLE events, only the
+               CHAN events.  I have to keep track of the change, though.
+               Short events skip the division - see POKEY_MAX_EVENT above. */
 
-            P4 = (P4 + event_min) % POLY4_SIZE;
-            P5 = (P5 + event_min) % POLY5_SIZE;
-            P9 = (P9 + event_min) % POLY9_SIZE;
-            P17 = (P17 + event_min) % POLY17_SIZE;
+            if (event_min < POKEY_MAX_EVENT) {
+                P4 = poly4_wrap[P4 + event_min];
+                P5 = poly5_wrap[P5 + event_min];
+                P9 += event_min;
+                if (P9 >= POLY9_SIZE) P9 -= POLY9_SIZE;
+                P17 += event_min;
+                if (P17 >= POLY17_SIZE) P17 -= POLY17_SIZE;
+            }
+            else {
+                P4 = (P4 + event_min) % POLY4_SIZE;
+                P5 = (P5 + event_min) % POLY5_SIZE;
+                P9 = (P9 + event_min) % POLY9_SIZE;
+                P17 = (P17 + event_min) % POLY17_SIZE;
+            }
 
             /* adjust channel counter */
             Div_n_cnt[next_event] += Div_n_max[next_event];
@@ -527,11 +561,11 @@ ITCM_CODE void Pokey_process(void *sndbuffer, unsigned sndn)
                         /* if 9-bit poly is selected on this chip */
                         if (AUDCTL[next_event >> 2] & POLY9) {
                             /* compare to the poly9 bit */
-                            toggle = ((poly9_lookup[P9] & 1) == !(*out_ptr));
+                            toggle = ((POKEY_POLY9[P9] & 1) == !(*out_ptr));
                         }
                         else {
                             /* otherwise compare to the poly17 bit */
-                            toggle = (((poly17_lookup[P17 >> 3] >> (P17 & 7)) & 1) == !(*out_ptr));
+                            toggle = (((POKEY_POLY17[P17 >> 3] >> (P17 & 7)) & 1) == !(*out_ptr));
                         }
                     }
                 }
@@ -587,7 +621,7 @@ ITCM_CODE void Pokey_process(void *sndbuffer, unsigned sndn)
       int iout;
       iout = cur_val;
       *buffer++ = (char) ((iout))+128;
-      *Samp_n_cnt += Samp_n_max;
+      Samp_n_cnt[0] += Samp_n_max;
       /* and indicate one less byte in the buffer */
       n--;
         }    
@@ -98,6 +98,10 @@ extern "C" {
 #define SAMP_MID 128
 #endif
 
+#ifndef SOUND_GAIN /* sound gain can be pre-defined in the configure/Makefile */
+#define SOUND_GAIN 4
+#endif
+
 /* init flags */
 #define SND_BIT16   1
 #define SND_STEREO  2
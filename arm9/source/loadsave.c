@@ -18,6 +18,7 @@
  */
 #include <nds.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <fat.h>
 #include <dirent.h>
 #include <unistd.h>
@@ -42,13 +43,17 @@
 #include "config.h"
 #include "loadsave.h"
 
-#define SAVE_FILE_REV   0x0007
+#define SAVE_FILE_REV   0x0008
+#define SAVE_FILE_REV_7 0x0007      // Same layout but the cycle map positions were byte offsets into the old int tables
 
 char save_filename[300+4];
 
 u32 XE_MemUsed(void)
 {
-    u32 idx=(1024*1024)-1;
+    if (xe_mem_size == 0) return 0;
+    
+    MEMORY_XEZeroAll(); // Banks never mapped in are not cleared yet - make them so before we look at them
+    u32 idx=xe_mem_size-1;
     
     while (idx > 0)
     {
@@ -92,12 +97,12 @@ void SaveMemMap()
             ls_mem_map[i].where = MEM_MAP_MAINMEM;
             ls_mem_map[i].offset = ptr - memory;
         }
-        else if ((ptr >= xe_mem_buffer) && (ptr <= (xe_mem_buffer+(1024*1024))))
+        else if (xe_mem_buffer && (ptr >= xe_mem_buffer) && (ptr <= (xe_mem_buffer+xe_mem_size)))
         {
             ls_mem_map[i].where = MEM_MAP_XEMEM;
             ls_mem_map[i].offset = ptr - xe_mem_buffer;
         }
-        else if ((ptr >= cart_image) && (ptr <= (cart_image+(1024*1024))))
+        else if (cart_image && (ptr >= cart_image) && (ptr <= (cart_image+cart_image_size)))
         {
             ls_mem_map[i].where = MEM_MAP_CART;
             ls_mem_map[i].offset = ptr - cart_image;
@@ -123,19 +128,19 @@ u8 RestoreMemMap()
         switch (ls_mem_map[i].where)
         {
             case MEM_MAP_MAINMEM:
-                mem_map[i] = memory + ls_mem_map[i].offset - (i * 0x1000);
+                MEMORY_MapBank(i, memory + ls_mem_map[i].offset - (i * 0x1000));
                 break;
             case MEM_MAP_XEMEM:
-                mem_map[i] = xe_mem_buffer + ls_mem_map[i].offset - (i * 0x1000);
+                MEMORY_MapBank(i, xe_mem_buffer + ls_mem_map[i].offset - (i * 0x1000));
                 break;
             case MEM_MAP_CART:
-                mem_map[i] = cart_image + ls_mem_map[i].offset - (i * 0x1000);
+                MEMORY_MapBank(i, cart_image + ls_mem_map[i].offset - (i * 0x1000));
                 break;
             case MEM_MAP_FAST:
-                mem_map[i] = fast_page + ls_mem_map[i].offset - (i * 0x1000);
+                MEMORY_MapBank(i, fast_page + ls_mem_map[i].offset - (i * 0x1000));
                 break;
             case MEM_MAP_BASIC:
-                mem_map[i] = ROM_basic + ls_mem_map[i].offset - (i * 0x1000);
+                MEMORY_MapBank(i, ROM_basic + ls_mem_map[i].offset - (i * 0x1000));
                 break;
             default:
                 err = 1;
@@ -161,8 +166,8 @@ void RestoreWriteMap(void)
 {
     for (int i=0; i<256; i++)
     {
-        if (saved_writemap[i] == 0) writemap[i] = NULL;
-        else if (saved_writemap[i] == 1) writemap[i] = ROM_PutByte;
+        if (saved_writemap[i] == 0) MEMORY_SetWriteHandler(i, NULL);
+        else if (saved_writemap[i] == 1) MEMORY_SetWriteHandler(i, ROM_PutByte);
         // else do nothing... no change
     }
 }
@@ -188,22 +193,11 @@ void LoadAnticXE(u8 xeType, u32 offset)
 
 u8 spare_bytes[256];
 
-void SaveGame(void)
+// Write the full machine state to the given file. Returns 0 on error.
+static u8 SaveGameFile(const char *filename)
 {
     UWORD t0 = TIMER0_DATA;
-    DIR* dir = opendir("sav");
-    if (dir)
-    {
-        /* Directory exists. */
-        closedir(dir);
-    }
-    else
-    {
-        mkdir("sav", 0777);
-    }
-    
-    siprintf(save_filename, "sav/%s.sav", last_boot_file);
-    FILE *fp = fopen(save_filename, "wb+");
+    FILE *fp = fopen(filename, "wb+");
     if (fp != NULL)
     {
         dsPrintValue(0,0,0, "SAVE");
@@ -284,9 +278,10 @@ void SaveGame(void)
         fwrite(extra_cycles,                    sizeof(extra_cycles),                   1, fp);
 
 #ifdef NEW_CYCLE_EXACT
-        offset = (u32)cpu2antic_ptr - (u32)(&cpu2antic[0]);
+        // Row 0 lives in DTCM so we save the table offset (in entries) with row 0 as offset 0
+        offset = (cpu2antic_ptr == cpu2antic_blank) ? 0 : (u32)(cpu2antic_ptr - cpu2antic);
         fwrite(&offset,                         sizeof(offset),                         1, fp);
-        offset = (u32)antic2cpu_ptr - (u32)(&antic2cpu[0]);
+        offset = (antic2cpu_ptr == antic2cpu_blank) ? 0 : (u32)(antic2cpu_ptr - antic2cpu);
         fwrite(&offset,                         sizeof(offset),                         1, fp);
         
         fwrite(&delayed_wsync,                  sizeof(delayed_wsync),                  1, fp);
@@ -458,6 +453,7 @@ void SaveGame(void)
         fwrite(AUDF,                            sizeof(AUDF),                           1, fp);
         fwrite(AUDC,                            sizeof(AUDC),                           1, fp);
         fwrite(AUDCTL,                          sizeof(AUDCTL),                         1, fp);
+        POKEY_SaveTimers();
         fwrite(DivNIRQ,                         sizeof(DivNIRQ),                        1, fp);
         fwrite(DivNMax,                         sizeof(DivNMax),                        1, fp);
         fwrite(Base_mult,                       sizeof(Base_mult),                      1, fp);
@@ -509,29 +505,49 @@ void SaveGame(void)
 
         fclose(fp);
         dsPrintValue(0,0,0, "SAVE OK");
+        return 1;
     }
-    else dsPrintValue(0,0,0, "ERR ");
+    dsPrintValue(0,0,0, "ERR ");
+    return 0;
+}
+
+void SaveGame(void)
+{
+    DIR* dir = opendir("sav");
+    if (dir)
+    {
+        /* Directory exists. */
+        closedir(dir);
+    }
+    else
+    {
+        mkdir("sav", 0777);
+    }
+    
+    siprintf(save_filename, "sav/%s.sav", last_boot_file);
+    SaveGameFile(save_filename);
     
     WAITVBL;WAITVBL;WAITVBL;WAITVBL;
     dsPrintValue(0,0,0, "       ");
 }
 
-void LoadGame(void)
+// Restore the full machine state from the given file. The game must already be loaded. Returns 0 on error.
+static u8 LoadGameFile(const char *filename, UWORD *timer0)
 {
     u8 err = false;
     UWORD t0 = 0;
     
-    siprintf(save_filename, "sav/%s.sav", last_boot_file);
-    FILE *fp = fopen(save_filename, "rb");
+    FILE *fp = fopen(filename, "rb");
     if (fp != NULL)
     {
         u16 rev=0;
         // Revision
         fread(&rev,                                sizeof(rev),                            1, fp);
         
-        if (rev == SAVE_FILE_REV)
+        if ((rev == SAVE_FILE_REV) || (rev == SAVE_FILE_REV_7))
         {            
             dsPrintValue(0,0,0, "LOAD");
+            CART_LoadAll(); // The restored memory map may point at any bank of a demand-paged cart
             // Memory
             fread(memory,                          sizeof(memory),                         1, fp);
             memcpy(fast_page, memory+0x0000, 0x1000);
@@ -544,6 +560,7 @@ void LoadGame(void)
             
             fread(ls_mem_map,                      sizeof(ls_mem_map),                     1, fp);
             err = RestoreMemMap();
+            MEMORY_CHECK_PAGES();
 
             u8 xeType = 0;
             u32 offset = 0;
@@ -605,9 +622,11 @@ void LoadGame(void)
 
 #ifdef NEW_CYCLE_EXACT            
             fread(&offset,                         sizeof(offset),                         1, fp);
-            cpu2antic_ptr = &cpu2antic[0] + offset;
+            if (rev == SAVE_FILE_REV_7) offset /= sizeof(int);
+            cpu2antic_ptr = CPU2ANTIC_ROW((offset % CPU2ANTIC_SIZE) ? 0 : (offset / CPU2ANTIC_SIZE) % CYCLE_MAP_ROWS);
             fread(&offset,                         sizeof(offset),                         1, fp);
-            antic2cpu_ptr = &antic2cpu[0] + offset;
+            if (rev == SAVE_FILE_REV_7) offset /= sizeof(int);
+            antic2cpu_ptr = ANTIC2CPU_ROW((offset % CPU2ANTIC_SIZE) ? 0 : (offset / CPU2ANTIC_SIZE) % CYCLE_MAP_ROWS);
 
             fread(&delayed_wsync,                  sizeof(delayed_wsync),                  1, fp);
             fread(&dmactl_changed,                 sizeof(dmactl_changed),                 1, fp);
@@ -780,6 +799,7 @@ void LoadGame(void)
             fread(AUDC,                            sizeof(AUDC),                           1, fp);
             fread(AUDCTL,                          sizeof(AUDCTL),                         1, fp);
             fread(DivNIRQ,                         sizeof(DivNIRQ),                        1, fp);
+            POKEY_RestoreTimers();
             fread(DivNMax,                         sizeof(DivNMax),                        1, fp);
             fread(Base_mult,                       sizeof(Base_mult),                      1, fp);
             fread(POT_input,                       sizeof(POT_input),                      1, fp);
@@ -822,7 +842,10 @@ void LoadGame(void)
             // XE Memory - this is potentially big so we only save used memory which might shrink this considerably
             u32 mem_used = 0;
             fread(&mem_used,                        sizeof(mem_used),                      1, fp);
-            fread(xe_mem_buffer,                    sizeof(UBYTE),                         mem_used, fp); 
+            MEMORY_XEZeroAll();
+            u32 mem_skip = (mem_used > xe_mem_size) ? (mem_used - xe_mem_size) : 0;
+            fread(xe_mem_buffer,                    sizeof(UBYTE),                         mem_used - mem_skip, fp); 
+            if (mem_skip) fseek(fp, mem_skip, SEEK_CUR);  // Saved from a bigger machine than we have now
             
             // Spare Bytes - Reduce this as needed to eat into spare memory
             fread(spare_bytes,                     256,                                    1, fp); 
@@ -830,14 +853,289 @@ void LoadGame(void)
         } else err = true;
         
         pm_dirty = true;
+        POKEY_StreamResync();   // The ARM7 synthesizer (if in use) needs the restored sound registers
         fclose(fp);
     } else err = true;
     
     if (err) dsPrintValue(0,0,0, "ERR ");
+    *timer0 = t0;
+    return !err;
+}
+
+void LoadGame(void)
+{
+    siprintf(save_filename, "sav/%s.sav", last_boot_file);
+    UWORD t0 = 0;
+    u8 ok = LoadGameFile(save_filename, &t0);
     
     WAITVBL;WAITVBL;WAITVBL;WAITVBL;
     dsPrintValue(0,0,0, "    ");
-    if (!err) TIMER0_DATA = t0;
+    if (ok) TIMER0_DATA = t0;
+}
+
+// ---------------------------------------------------------------------------------
+// Instant resume. Quitting (or closing the lid) while a game is running suspends it
+// into a save state in /data along with a small manifest saying which game it was,
+// where it came from and the settings it was running with. On the next start we
+// skip the intro and the file browser, boot that game and put the state on top.
+// The manifest is removed as soon as it is read so a state that won't restore can
+// never trap us in a loop, and whenever the game it points at moves on (waking from
+// the lid, loading another game) so a stale state is never resumed over newer play.
+// Holding B while A8DS starts skips the resume.
+// ---------------------------------------------------------------------------------
+#define RESUME_STATE    "/data/A8DS_RESUME.SAV"
+#define RESUME_MANIFEST "/data/A8DS_RESUME.DAT"
+
+typedef struct
+{
+    u16  rev;                           // SAVE_FILE_REV - a state from another build is not restored
+    u8   read_only[2];
+    unsigned int crc;                   // The game must still be the same file
+    char dir[300];                      // Where the game was picked from (the names below may be relative)
+    char boot_file[300];
+    char disk2_file[300];
+    struct GameSettings_t config;       // As played - the user may not have saved them
+} ResumeManifest_t;
+
+static ResumeManifest_t resume;
+
+void SuspendGame(void)
+{
+    if ((last_boot_file[0] == 0) || (strcmp(last_boot_file, "EMPTY") == 0)) return;   // Nothing running
+
+    DIR* dir = opendir("/data");
+    if (dir) closedir(dir);
+    else mkdir("/data", 0777);
+
+    memset(&resume, 0x00, sizeof(resume));
+    resume.rev = SAVE_FILE_REV;
+    resume.read_only[0] = last_read_only[0];
+    resume.read_only[1] = last_read_only[1];
+    resume.crc = last_crc;
+    if (last_working_dir[0][0]) strcpy(resume.dir, last_working_dir[0]);
+    else if (getcwd(resume.dir, sizeof(resume.dir)-1) == NULL) resume.dir[0] = 0;
+    strcpy(resume.boot_file, last_boot_file);
+    strcpy(resume.disk2_file, last_disk_filename[1]);
+    memcpy(&resume.config, &myConfig, sizeof(myConfig));
+
+    // The manifest is written last - it is what says the state is good to use
+    if (!SaveGameFile(RESUME_STATE)) return;
+    FILE *fp = fopen(RESUME_MANIFEST, "wb");
+    if (fp != NULL)
+    {
+        fwrite(&resume, sizeof(resume), 1, fp);
+        fclose(fp);
+    }
+}
+
+// The suspended state is out of date once play carries on or another game is loaded
+void ResumeDiscard(void)
+{
+    remove(RESUME_MANIFEST);
+}
+
+// Cheap enough to call before the intro - decides if we skip it
+u8 ResumePending(void)
+{
+    if (keysCurrent() & KEY_B) return 0;
+    return (access(RESUME_MANIFEST, F_OK) == 0);
+}
+
+// ---------------------------------------------------------------------------------
+// Boot the suspended game and restore its state. Returns non-zero if a game was
+// booted (even if the state itself could not be used) so the caller goes straight
+// to play - otherwise it should carry on to the menu as usual.
+// ---------------------------------------------------------------------------------
+u8 ResumeGame(void)
+{
+    FILE *fp = fopen(RESUME_MANIFEST, "rb");
+    if (fp == NULL) return 0;
+    u8 ok = (fread(&resume, sizeof(resume), 1, fp) == 1) && (resume.rev == SAVE_FILE_REV);
+    fclose(fp);
+    ResumeDiscard();
+    if (!ok) return 0;
+
+    if (resume.dir[0] && (chdir(resume.dir) == 0)) strcpy(last_working_dir[0], resume.dir);
+    if (access(resume.boot_file, F_OK) != 0) return 0;     // Game has gone away
+
+    // Boot it with the settings it was running with so the palette, sound engine, etc. are set up
+    // for them by dsLoadGame() - ApplyGameSpecificSettings() only takes them if the CRC still matches
+    resume.config.game_crc = resume.crc;
+    force_config = &resume.config;
+    dsShowScreenMain();
+    dsLoadGame(resume.boot_file, isDisk(resume.boot_file) ? DISK_1 : DISK_XEX, true, resume.read_only[0]);
+    force_config = NULL;
+    if (strcmp(resume.disk2_file, "EMPTY") != 0) dsLoadGame(resume.disk2_file, DISK_2, false, resume.read_only[1]);
+
+    // Anything that shapes the machine must match what the state was saved on - else it's just a cold boot
+    if ((last_crc == resume.crc) && (myConfig.machine_type == resume.config.machine_type) && (myConfig.cart_type == resume.config.cart_type))
+    {
+        UWORD t0 = 0;
+        if (LoadGameFile(RESUME_STATE, &t0)) TIMER0_DATA = t0;
+        dsPrintValue(0,0,0, "    ");
+    }
+    return 1;
+}
+
+
+// -------------------------------------------------------------------------------------------------------------
+// In-memory state snapshot used by Run-Ahead. Unlike SaveGame()/LoadGame() this never outlives the current
+// session so we can copy raw pointers (mem_map[], readmap[], writemap[], draw functions, etc) and skip all
+// of the re-mapping above. The buffer is allocated once and then re-used every frame - no heap, no SD card.
+// We only snapshot machines up to 128K as anything bigger is too much to memcpy twice per frame.
+// -------------------------------------------------------------------------------------------------------------
+typedef struct
+{
+    void *ptr;
+    u32  size;
+} SnapRegion_t;
+
+#define SNAP(x)     {(void*)&(x), sizeof(x)}
+
+static const SnapRegion_t snap_regions[] =
+{
+    // Memory - page 0 of memory[] is not used while the fast_page is mapped in
+    {memory+0x1000, 0xF000}, SNAP(fast_page), SNAP(cart809F_enabled), SNAP(cartA0BF_enabled),
+    SNAP(mem_map), SNAP(readmap), SNAP(writemap), SNAP(page_rd), SNAP(page_wr), SNAP(antic_xe_ptr),
+
+    // CPU
+    SNAP(regPC), SNAP(regA), SNAP(regP), SNAP(regS), SNAP(regY), SNAP(regX), SNAP(N), SNAP(Z), SNAP(C), SNAP(IRQ), SNAP(cim_encountered),
+    SNAP(xpos), SNAP(xpos_limit),
+
+    // ANTIC
+    SNAP(ANTIC_memory), SNAP(DMACTL), SNAP(CHACTL), SNAP(dlist), SNAP(HSCROL), SNAP(VSCROL), SNAP(PMBASE), SNAP(CHBASE), SNAP(NMIEN), SNAP(NMIST),
+    SNAP(scrn_ptr), SNAP(break_ypos), SNAP(ypos), SNAP(wsync_halt), SNAP(screenline_cpu_clock), SNAP(PENH_input), SNAP(PENV_input), SNAP(PENH), SNAP(PENV),
+    SNAP(screenaddr), SNAP(IR), SNAP(anticmode), SNAP(dctr), SNAP(lastline), SNAP(need_dl), SNAP(vscrol_off), SNAP(md),
+    SNAP(chars_read), SNAP(chars_displayed), SNAP(x_min), SNAP(ch_offset), SNAP(load_cycles), SNAP(before_cycles), SNAP(extra_cycles),
+#ifdef NEW_CYCLE_EXACT
+    SNAP(cpu2antic_ptr), SNAP(antic2cpu_ptr), SNAP(delayed_wsync), SNAP(dmactl_changed), SNAP(DELAYED_DMACTL), SNAP(draw_antic_ptr_changed),
+    SNAP(need_load), SNAP(dmactl_bug_chdata), SNAP(prevline_prior_pos), SNAP(curline_prior_pos), SNAP(prior_curpos), SNAP(prior_val_buf), SNAP(prior_pos_buf),
+#endif
+    SNAP(left_border_chars), SNAP(right_border_start), SNAP(chbase_20), SNAP(invert_mask), SNAP(blank_mask), SNAP(an_scanline),
+    SNAP(blank_lookup), SNAP(lookup2), SNAP(lookup_gtia9), SNAP(lookup_gtia11), SNAP(playfield_lookup), SNAP(mode_e_an_lookup), SNAP(cl_lookup),
+    SNAP(hires_lookup_n), SNAP(hires_lookup_m), SNAP(hires_lookup_l),
+    SNAP(singleline), SNAP(player_dma_enabled), SNAP(player_gra_enabled), SNAP(missile_dma_enabled), SNAP(missile_gra_enabled),
+    SNAP(player_flickering), SNAP(missile_flickering), SNAP(pmbase_s), SNAP(pmbase_d), SNAP(pm_dirty), SNAP(pm_lookup_ptr), SNAP(pm_scanline),
+    SNAP(draw_antic_ptr), SNAP(draw_antic_0_ptr),
+
+    // GTIA
+    SNAP(GRAFM), SNAP(GRAFP0), SNAP(GRAFP1), SNAP(GRAFP2), SNAP(GRAFP3), SNAP(HPOSP0), SNAP(HPOSP1), SNAP(HPOSP2), SNAP(HPOSP3),
+    SNAP(HPOSM0), SNAP(HPOSM1), SNAP(HPOSM2), SNAP(HPOSM3), SNAP(SIZEP0), SNAP(SIZEP1), SNAP(SIZEP2), SNAP(SIZEP3), SNAP(SIZEM),
+    SNAP(COLPM0), SNAP(COLPM1), SNAP(COLPM2), SNAP(COLPM3), SNAP(COLPF0), SNAP(COLPF1), SNAP(COLPF2), SNAP(COLPF3), SNAP(COLBK), SNAP(GRACTL),
+    SNAP(M0PL), SNAP(M1PL), SNAP(M2PL), SNAP(M3PL), SNAP(P0PL), SNAP(P1PL), SNAP(P2PL), SNAP(P3PL),
+#ifdef NEW_CYCLE_EXACT
+    SNAP(P1PL_T), SNAP(P2PL_T), SNAP(P3PL_T), SNAP(M0PL_T), SNAP(M1PL_T), SNAP(M2PL_T), SNAP(M3PL_T), SNAP(collision_curpos), SNAP(hitclr_pos),
+#endif
+    SNAP(PRIOR), SNAP(VDELAY), SNAP(POTENA), SNAP(atari_speaker), SNAP(consol_index), SNAP(consol_mask), SNAP(consol_table), SNAP(TRIG), SNAP(TRIG_latch),
+    SNAP(hposp_ptr), SNAP(hposm_ptr), SNAP(hposp_mask), SNAP(grafp_ptr), SNAP(global_sizem), SNAP(PM_Width),
+
+    // PIA
+    SNAP(PACTL), SNAP(PBCTL), SNAP(PORTA), SNAP(PORTB), SNAP(PORTA_mask), SNAP(PORTB_mask), SNAP(PORT_input), SNAP(xe_bank), SNAP(selftest_enabled),
+    SNAP(xe_banks_zeroed), SNAP(PIA_CA2), SNAP(PIA_CA2_negpending), SNAP(PIA_CA2_pospending), SNAP(PIA_CB2), SNAP(PIA_CB2_negpending), SNAP(PIA_CB2_pospending), SNAP(PIA_IRQ),
+
+    // SIO (Run-Ahead is suspended during disk access, but the serial state machine still needs to roll back)
+    SNAP(SIO_drive_status), SNAP(CommandFrame), SNAP(DataBuffer), SNAP(SIO_last_drive), SNAP(CommandIndex), SNAP(DataIndex), SNAP(TransferStatus), SNAP(ExpectedBytes),
+
+    // POKEY - the pokey_buffer[] itself is live data for the ARM7 so it is never rolled back
+    SNAP(KBCODE), SNAP(SERIN), SNAP(IRQST), SNAP(IRQEN), SNAP(SKSTAT), SNAP(SKCTLS), SNAP(DELAYED_SERIN_IRQ), SNAP(DELAYED_SEROUT_IRQ), SNAP(DELAYED_XMTDONE_IRQ),
+    SNAP(AUDF), SNAP(AUDC), SNAP(AUDCTL), SNAP(DivNDue), SNAP(pokey_next_event), SNAP(DivNMax), SNAP(Base_mult), SNAP(POT_input), SNAP(PCPOT_input), SNAP(POT_all), SNAP(pot_scanline),
+    SNAP(random_scanline_counter), SNAP(AUDV), SNAP(Outbit), SNAP(Outvol), SNAP(Div_n_cnt), SNAP(Div_n_max), SNAP(P4), SNAP(P5), SNAP(P9), SNAP(P17),
+    SNAP(Samp_n_max), SNAP(Samp_n_cnt), SNAP(pokey_decimate_ctr),
+
+    // Cartridge
+    SNAP(bank), SNAP(cart_sic_data), SNAP(last_bb1_bank), SNAP(last_bb2_bank),
+
+    // A8DS
+    SNAP(gTotalAtariFrames),
+};
+
+#define SNAP_XE_MAX     (64*1024)       // The 130XE has 4 banks of 16K - that's as far as we go
+#define SNAP_CART_MAX   (8*1024)        // Cart EEPROM/NVRAM kept inside the cart_image[] buffer
+
+u8  *snap_buffer = NULL;
+u32 snap_xe_size = 0;
+u8  *snap_cart_ram = NULL;
+u32 snap_cart_size = 0;
+
+// ---------------------------------------------------------------------------------------
+// Carts that keep writable memory in the back end of cart_image[]. The Corina SRAM cart
+// has 512K of SRAM there as well - far too much to copy every frame so dsRunAheadAllowed()
+// turns Run-Ahead off for it. Returns NULL if the loaded cart has no such memory.
+// ---------------------------------------------------------------------------------------
+static u8 *SnapCartRAM(u32 *size)
+{
+    u32 offset;
+    switch (myConfig.cart_type)
+    {
+        case CART_TELELINK2:    offset = 0x2000;        break;  // NVRAM at $9000
+        case CART_CORINA_1MB:   offset = 1024*1024;     break;  // EEPROM past the 1MB ROM
+        default:                return NULL;
+    }
+    if ((cart_image == NULL) || (cart_image_size < offset + SNAP_CART_MAX)) return NULL;
+    *size = SNAP_CART_MAX;
+    return cart_image + offset;
+}
+
+u8 SaveStateToRAM(void)
+{
+    // One-time allocation sized for the largest machine we support... after this, no more heap.
+    if (snap_buffer == NULL)
+    {
+        u32 size = 0x4000 + SNAP_XE_MAX + SNAP_CART_MAX;
+        for (int i=0; i<(sizeof(snap_regions)/sizeof(snap_regions[0])); i++) size += snap_regions[i].size;
+        snap_buffer = malloc(size);
+        if (snap_buffer == NULL) return false;
+    }
+
+    u8 *dest = snap_buffer;
+    for (int i=0; i<(sizeof(snap_regions)/sizeof(snap_regions[0])); i++)
+    {
+        memcpy(dest, snap_regions[i].ptr, snap_regions[i].size);
+        dest += snap_regions[i].size;
+    }
+
+    if (myConfig.machine_type >= MACHINE_XLXE_64K)
+    {
+        memcpy(dest, under_atarixl_os, 0x4000);
+        dest += 0x4000;
+    }
+
+    snap_cart_size = 0;
+    snap_cart_ram = SnapCartRAM(&snap_cart_size);
+    if (snap_cart_ram)
+    {
+        memcpy(dest, snap_cart_ram, snap_cart_size);
+        dest += snap_cart_size;
+    }
+
+    snap_xe_size = (mem_machine_type == MACHINE_XLXE_128K) ? SNAP_XE_MAX : 0;
+    if (snap_xe_size) memcpy(dest, atarixe_memory, snap_xe_size);
+
+    return true;
+}
+
+void LoadStateFromRAM(void)
+{
+    u8 *src = snap_buffer;
+    for (int i=0; i<(sizeof(snap_regions)/sizeof(snap_regions[0])); i++)
+    {
+        memcpy(snap_regions[i].ptr, src, snap_regions[i].size);
+        src += snap_regions[i].size;
+    }
+
+    if (myConfig.machine_type >= MACHINE_XLXE_64K)
+    {
+        memcpy(under_atarixl_os, src, 0x4000);
+        src += 0x4000;
+    }
+
+    if (snap_cart_ram)
+    {
+        memcpy(snap_cart_ram, src, snap_cart_size);
+        src += snap_cart_size;
+    }
+
+    if (snap_xe_size) memcpy(atarixe_memory, src, snap_xe_size);
 }
 
 
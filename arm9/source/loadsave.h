@@ -21,5 +21,11 @@
 
 extern void LoadGame(void);
 extern void SaveGame(void);
+extern void SuspendGame(void);
+extern u8   ResumePending(void);
+extern u8   ResumeGame(void);
+extern void ResumeDiscard(void);
+extern u8   SaveStateToRAM(void);
+extern void LoadStateFromRAM(void);
 
 #endif // _LOADSAVE_H
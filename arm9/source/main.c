@@ -27,6 +27,7 @@
 #include "intro.h"
 #include "a8ds.h"
 #include "highscore.h"
+#include "loadsave.h"
 
 extern void load_os(void);
 extern void install_os(void);
@@ -76,8 +77,9 @@ int main(int argc, char **argv)
     load_os();          // Read in the "atarixl.rom" file or use the built-in Altirra OS
     install_os();       // And install the right OS into our system...
     
-    // Intro and main screen
-    intro_logo();  
+    // Intro and main screen - skipped when we are going straight back into a suspended game
+    u8 bResume = (argc <= 1) && ResumePending();
+    if (!bResume) intro_logo();
     dsInitScreenMain();
     emu_state = A8_MENUINIT;
     
@@ -98,6 +100,7 @@ int main(int argc, char **argv)
         chdir("/roms");    // Try to start in roms area... doesn't matter if it fails
         chdir("a800");     // And try to start in the subdir /a800... doesn't matter if it fails.
         chdir("a8");       // if the above failed, try a8
+        if (bResume) emu_state = A8_RESUME;
     }
     
     srand(time(NULL));
@@ -0,0 +1,177 @@
+/*
+ * membudget.c contains the memory budget report for main RAM, DTCM, ITCM and VRAM
+ * 
+ * A8DS - Atari 8-bit Emulator designed to run on the Nintendo DS/DSi is
+ * Copyright (c) 2021-2025 Dave Bernazzani (wavemotion-dave)
+
+ * Copying and distribution of this emulator, its source code and associated 
+ * readme files, with or without modification, are permitted in any medium without 
+ * royalty provided this full copyright notice (including the Atari800 one below) 
+ * is used and wavemotion-dave, alekmaul (original port), Atari800 team (for the
+ * original source) and Avery Lee (Altirra OS) are credited and thanked profusely.
+ * 
+ * The A8DS emulator is offered as-is, without any warranty.
+ * 
+ * Since much of the original codebase came from the Atari800 project, and since
+ * that project is released under the GPL V2, this program and source must also
+ * be distributed using that same licensing model. See COPYING for the full license.
+ */
+#include <nds.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+#include <fat.h>
+#include <dirent.h>
+#include <unistd.h>
+#include "a8ds.h"
+#include "atari.h"
+#include "memory.h"
+#include "cartridge.h"
+#include "membudget.h"
+
+// ---------------------------------------------------------------------------------
+// Where did all the memory go? The linker script tells us how much of ITCM, DTCM and
+// main RAM our code and data take up and mallinfo() covers the heap. The VRAM banks
+// we use as general RAM are carved up by hand (see membudget.h) so those are listed
+// from the table below. The per-symbol breakdown can only come from the link - the
+// build writes that out next to the .elf as A8DSi.mem.txt (see membudget.awk).
+// ---------------------------------------------------------------------------------
+#define MEMBUDGET_FILE      "/data/A8DS_MEMORY.TXT"
+
+#define MAIN_RAM_START      0x02000000
+#define ITCM_SIZE           (32 * 1024)
+#define DTCM_SIZE           (16 * 1024)     // The IRQ/SVC/USR stacks also live at the top of DTCM
+
+// From the devkitARM ds_arm9.ld linker script - weak so a different script just reports zeros
+extern u8 __itcm_start[] __attribute__((weak));
+extern u8 __itcm_end[]   __attribute__((weak));
+extern u8 __dtcm_start[] __attribute__((weak));
+extern u8 __dtcm_end[]   __attribute__((weak));
+extern u8 __sbss_start[] __attribute__((weak));
+extern u8 __sbss_end[]   __attribute__((weak));
+extern u8 __end__[]      __attribute__((weak));
+extern u8 *fake_heap_end;
+
+extern int getMemUsed(void);
+extern int getMemFree(void);
+extern u8 *snap_buffer;
+
+typedef struct
+{
+    const char *name;
+    u32 base;
+    u32 size;
+    char bank;
+    u32 bank_base;
+    u32 bank_size;
+} VramCarveOut_t;
+
+static const VramCarveOut_t vram_carve_outs[] =
+{
+    {"CART SHADOW",  VRAM_CART_SHADOW,  VRAM_CART_SHADOW_SIZE,  'E', VRAM_E_BASE, VRAM_E_SIZE},
+    {"UNDER OS",     VRAM_UNDER_OS,     VRAM_UNDER_OS_SIZE,     'H', VRAM_H_BASE, VRAM_H_SIZE},
+    {"OS PRISTINE",  VRAM_OS_PRISTINE,  VRAM_OS_PRISTINE_SIZE,  'H', VRAM_H_BASE, VRAM_H_SIZE},
+    {"GRAFP LOOKUP", VRAM_GRAFP_LOOKUP, VRAM_GRAFP_LOOKUP_SIZE, 'I', VRAM_I_BASE, VRAM_I_SIZE},
+};
+#define VRAM_CARVE_OUTS     (sizeof(vram_carve_outs) / sizeof(vram_carve_outs[0]))
+
+// The same checks at compile time - a bad carve-out doesn't build
+#define CARVE_FITS(a, as, b, bs)    (((a) >= (b)) && (((a) + (as)) <= ((b) + (bs))))
+#define CARVE_APART(a, as, b, bs)   ((((a) + (as)) <= (b)) || (((b) + (bs)) <= (a)))
+
+_Static_assert(CARVE_FITS(VRAM_CART_SHADOW,  VRAM_CART_SHADOW_SIZE,  VRAM_E_BASE, VRAM_E_SIZE), "Cart shadow does not fit in VRAM E");
+_Static_assert(CARVE_FITS(VRAM_UNDER_OS,     VRAM_UNDER_OS_SIZE,     VRAM_H_BASE, VRAM_H_SIZE), "Under OS RAM does not fit in VRAM H");
+_Static_assert(CARVE_FITS(VRAM_OS_PRISTINE,  VRAM_OS_PRISTINE_SIZE,  VRAM_H_BASE, VRAM_H_SIZE), "Pristine OS does not fit in VRAM H");
+_Static_assert(CARVE_FITS(VRAM_GRAFP_LOOKUP, VRAM_GRAFP_LOOKUP_SIZE, VRAM_I_BASE, VRAM_I_SIZE), "GRAFP lookup does not fit in VRAM I");
+_Static_assert(CARVE_APART(VRAM_CART_SHADOW, VRAM_CART_SHADOW_SIZE, VRAM_UNDER_OS,     VRAM_UNDER_OS_SIZE),     "VRAM carve-outs overlap");
+_Static_assert(CARVE_APART(VRAM_CART_SHADOW, VRAM_CART_SHADOW_SIZE, VRAM_OS_PRISTINE,  VRAM_OS_PRISTINE_SIZE),  "VRAM carve-outs overlap");
+_Static_assert(CARVE_APART(VRAM_CART_SHADOW, VRAM_CART_SHADOW_SIZE, VRAM_GRAFP_LOOKUP, VRAM_GRAFP_LOOKUP_SIZE), "VRAM carve-outs overlap");
+_Static_assert(CARVE_APART(VRAM_UNDER_OS,    VRAM_UNDER_OS_SIZE,    VRAM_OS_PRISTINE,  VRAM_OS_PRISTINE_SIZE),  "VRAM carve-outs overlap");
+_Static_assert(CARVE_APART(VRAM_UNDER_OS,    VRAM_UNDER_OS_SIZE,    VRAM_GRAFP_LOOKUP, VRAM_GRAFP_LOOKUP_SIZE), "VRAM carve-outs overlap");
+_Static_assert(CARVE_APART(VRAM_OS_PRISTINE, VRAM_OS_PRISTINE_SIZE, VRAM_GRAFP_LOOKUP, VRAM_GRAFP_LOOKUP_SIZE), "VRAM carve-outs overlap");
+
+static u32 ItcmUsed(void)   {return (u32)(__itcm_end - __itcm_start);}
+static u32 DtcmUsed(void)   {return (u32)(__dtcm_end - __dtcm_start) + (u32)(__sbss_end - __sbss_start);}
+static u32 MainStatic(void) {return __end__ ? (u32)__end__ - MAIN_RAM_START : 0;}
+
+// Returns the index of a carve-out this one collides with (or that doesn't fit its bank), else -1
+static int VramCarveOutClash(int i)
+{
+    const VramCarveOut_t *c = &vram_carve_outs[i];
+    if (!CARVE_FITS(c->base, c->size, c->bank_base, c->bank_size)) return i;
+    for (int j = 0; j < VRAM_CARVE_OUTS; j++)
+    {
+        const VramCarveOut_t *d = &vram_carve_outs[j];
+        if ((i != j) && !CARVE_APART(c->base, c->size, d->base, d->size)) return j;
+    }
+    return -1;
+}
+
+// ---------------------------------------------------------------------------------
+// The short form for the debug screen - 5 lines starting at the given row.
+// ---------------------------------------------------------------------------------
+void MEMBUDGET_Show(int row)
+{
+    static char buf[33];
+    int clashes = 0;
+    for (int i = 0; i < VRAM_CARVE_OUTS; i++) if (VramCarveOutClash(i) >= 0) clashes++;
+
+    siprintf(buf, "MAIN %4dK STATIC %4dK TOTAL ", (int)(MainStatic() / 1024), (int)(((u32)fake_heap_end - MAIN_RAM_START) / 1024));
+    dsPrintValue(0, row+0, 0, buf);
+    siprintf(buf, "HEAP %4dK USED   %4dK FREE  ", getMemUsed() / 1024, getMemFree() / 1024);
+    dsPrintValue(0, row+1, 0, buf);
+    siprintf(buf, "XE %4dK  CART %4dK          ", (int)(xe_mem_size / 1024), (int)(cart_image_size / 1024));
+    dsPrintValue(0, row+2, 0, buf);
+    siprintf(buf, "DTCM %5d/%5d ITCM %5d/%5d", (int)DtcmUsed(), DTCM_SIZE, (int)ItcmUsed(), ITCM_SIZE);
+    dsPrintValue(0, row+3, 0, buf);
+    siprintf(buf, "VRAM CARVE-OUTS: %s          ", clashes ? "OVERLAP!" : "OK");
+    dsPrintValue(0, row+4, 0, buf);
+}
+
+// ---------------------------------------------------------------------------------
+// The long form goes to the SD card. Returns non-zero on error.
+// ---------------------------------------------------------------------------------
+u8 MEMBUDGET_Report(void)
+{
+    DIR* dir = opendir("/data");
+    if (dir) closedir(dir);
+    else mkdir("/data", 0777);
+
+    FILE *fp = fopen(MEMBUDGET_FILE, "w");
+    if (fp == NULL) return 1;
+
+    u32 main_size = (u32)fake_heap_end - MAIN_RAM_START;
+    u32 main_static = MainStatic();
+    u32 heap_used = getMemUsed();
+    u32 heap_free = getMemFree();
+
+    fprintf(fp, "A8DS MEMORY BUDGET (%s)\n\n", isDSiMode() ? "DSi" : "DS");
+    fprintf(fp, "REGION     SIZE      USED      FREE\n");
+    fprintf(fp, "MAIN   %8u  %8u  %8u   (static %u + heap %u)\n", (unsigned)main_size, (unsigned)(main_static + heap_used), (unsigned)heap_free, (unsigned)main_static, (unsigned)heap_used);
+    fprintf(fp, "DTCM   %8u  %8u  %8u   (free space is shared with the stacks)\n", DTCM_SIZE, (unsigned)DtcmUsed(), (unsigned)(DTCM_SIZE - DtcmUsed()));
+    fprintf(fp, "ITCM   %8u  %8u  %8u\n\n", ITCM_SIZE, (unsigned)ItcmUsed(), (unsigned)(ITCM_SIZE - ItcmUsed()));
+
+    fprintf(fp, "HEAP BUFFERS\n");
+    fprintf(fp, " XE RAM      %8u  (%u of %u banks cleared)\n", (unsigned)xe_mem_size,
+            (unsigned)(__builtin_popcount(xe_banks_zeroed[0]) + __builtin_popcount(xe_banks_zeroed[1])), (unsigned)(xe_mem_size >> 14));
+    fprintf(fp, " CART IMAGE  %8u\n", (unsigned)cart_image_size);
+    fprintf(fp, " RUN-AHEAD   %8s\n\n", snap_buffer ? "yes" : "no");
+
+    fprintf(fp, "VRAM CARVE-OUTS\n NAME          BANK  START      END        SIZE   STATUS\n");
+    for (int i = 0; i < VRAM_CARVE_OUTS; i++)
+    {
+        const VramCarveOut_t *c = &vram_carve_outs[i];
+        int clash = VramCarveOutClash(i);
+        fprintf(fp, " %-12s   %c    %08X - %08X  %6u  ", c->name, c->bank, (unsigned)c->base, (unsigned)(c->base + c->size - 1), (unsigned)c->size);
+        if (clash < 0) fprintf(fp, "OK\n");
+        else if (clash == i) fprintf(fp, "OUTSIDE BANK %c\n", c->bank);
+        else fprintf(fp, "OVERLAPS %s\n", vram_carve_outs[clash].name);
+    }
+
+    fprintf(fp, "\nLargest symbols per region: see the A8DSi.mem.txt written by the build.\n");
+    fclose(fp);
+    return 0;
+}
+
+// End of file
@@ -0,0 +1,53 @@
+/*
+ * membudget.h contains the memory budget report and the hand placed VRAM carve-outs
+ * 
+ * A8DS - Atari 8-bit Emulator designed to run on the Nintendo DS/DSi is
+ * Copyright (c) 2021-2025 Dave Bernazzani (wavemotion-dave)
+
+ * Copying and distribution of this emulator, its source code and associated 
+ * readme files, with or without modification, are permitted in any medium without 
+ * royalty provided this full copyright notice (including the Atari800 one below) 
+ * is used and wavemotion-dave, alekmaul (original port), Atari800 team (for the
+ * original source) and Avery Lee (Altirra OS) are credited and thanked profusely.
+ * 
+ * The A8DS emulator is offered as-is, without any warranty.
+ * 
+ * Since much of the original codebase came from the Atari800 project, and since
+ * that project is released under the GPL V2, this program and source must also
+ * be distributed using that same licensing model. See COPYING for the full license.
+ */
+#ifndef __MEMBUDGET_H
+#define __MEMBUDGET_H
+
+#include <nds.h>
+
+// ---------------------------------------------------------------------------------
+// VRAM banks E thru I are mapped to the LCD in dsInitScreenMain() and are not used
+// for video - we carve them up by hand for data that likes fast RAM. Every carve-out
+// is listed here so membudget.c can check (at compile time) that they all fit in
+// their bank and don't step on each other. Add any new carve-out to both places.
+// ---------------------------------------------------------------------------------
+#define VRAM_E_BASE             0x06880000      // 64K
+#define VRAM_E_SIZE             0x10000
+#define VRAM_F_BASE             0x06890000      // 16K
+#define VRAM_F_SIZE             0x4000
+#define VRAM_G_BASE             0x06894000      // 16K
+#define VRAM_G_SIZE             0x4000
+#define VRAM_H_BASE             0x06898000      // 32K
+#define VRAM_H_SIZE             0x8000
+#define VRAM_I_BASE             0x068A0000      // 16K
+#define VRAM_I_SIZE             0x4000
+
+#define VRAM_CART_SHADOW        (VRAM_E_BASE + 0x0000)      // Bounty Bob (BBSB and 5200) copy of the 40K cart
+#define VRAM_CART_SHADOW_SIZE   (40 * 1024)
+#define VRAM_UNDER_OS           (VRAM_H_BASE + 0x0000)      // RAM under the XL/XE OS
+#define VRAM_UNDER_OS_SIZE      0x4000
+#define VRAM_OS_PRISTINE        (VRAM_H_BASE + 0x4000)      // Unpatched copy of the OS
+#define VRAM_OS_PRISTINE_SIZE   0x4000
+#define VRAM_GRAFP_LOOKUP       (VRAM_I_BASE + 0x0000)      // GTIA ULONG[4][256] player graphics lookup
+#define VRAM_GRAFP_LOOKUP_SIZE  (4 * 256 * 4)
+
+extern void MEMBUDGET_Show(int row);
+extern u8   MEMBUDGET_Report(void);
+
+#endif
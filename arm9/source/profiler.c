@@ -0,0 +1,503 @@
+/*
+ * profiler.c contains the 6502 hot-spot sampling profiler
+ * 
+ * A8DS - Atari 8-bit Emulator designed to run on the Nintendo DS/DSi is
+ * Copyright (c) 2021-2025 Dave Bernazzani (wavemotion-dave)
+
+ * Copying and distribution of this emulator, its source code and associated 
+ * readme files, with or without modification, are permitted in any medium without 
+ * royalty provided this full copyright notice (including the Atari800 one below) 
+ * is used and wavemotion-dave, alekmaul (original port), Atari800 team (for the
+ * original source) and Avery Lee (Altirra OS) are credited and thanked profusely.
+ * 
+ * The A8DS emulator is offered as-is, without any warranty.
+ * 
+ * Since much of the original codebase came from the Atari800 project, and since
+ * that project is released under the GPL V2, this program and source must also
+ * be distributed using that same licensing model. See COPYING for the full license.
+ */
+#include <nds.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fat.h>
+#include <dirent.h>
+#include <unistd.h>
+#include "a8ds.h"
+#include "atari.h"
+#include "cpu.h"
+#include "memory.h"
+#include "pia.h"
+#include "cartridge.h"
+#include "antic.h"
+#include "gtia.h"
+#include "pokey.h"
+#include "profiler.h"
+#include "benchdev.h"
+
+// ---------------------------------------------------------------------------------
+// A very simple sampling profiler - every PROFILER_INTERVAL scanlines we record the
+// 6502 PC along with the bank that is mapped in behind it (XE bank for 0x4000-0x7FFF
+// and the cart bank for 0x8000-0xBFFF) into a small open-addressed hash table. The
+// interval is odd so we don't keep landing on the same scanline every frame. The
+// report is written to the SD card and lists the hottest addresses (disassembled),
+// and the hottest 256-byte pages which usually map nicely onto routines. Run-Ahead
+// is held off while profiling (see dsRunAheadAllowed()) as none of the counts here
+// are rolled back with the machine.
+// ---------------------------------------------------------------------------------
+#define PROFILER_INTERVAL   7
+#define PROFILER_ENTRIES    4096        // Must be a power of 2
+#define PROFILER_TOP_ADDRS  40
+#define PROFILER_TOP_PAGES  16
+#define PROFILER_FILE       "/data/A8DS_PROFILE.TXT"
+
+typedef struct
+{
+    u32 key;        // PC in the low 16 bits and bank in the upper bits
+    u32 count;      // Zero marks an empty slot
+} ProfileEntry_t;
+
+u8 profiler_enabled __attribute__((section(".dtcm"))) = 0;
+static u8  profiler_countdown = PROFILER_INTERVAL;
+static u32 profiler_samples = 0;
+static u32 profiler_dropped = 0;
+static u32 profiler_start_frame = 0;    // bench_frames at the start - gTotalAtariFrames is only 16 bits
+static ProfileEntry_t *profile_table = NULL;
+
+static void HwCountStart(void);
+static void HwCountStop(void);
+static u8   HwWriteReport(u32 frames);
+static void Arm9SampleStart(void);
+static void Arm9SampleStop(void);
+static u8   Arm9WriteReport(void);
+
+static inline u32 ProfilerBank(UWORD pc)
+{
+    if ((pc & 0xC000) == 0x4000) return (u32)xe_bank & 0xFF;
+    if ((pc & 0xC000) == 0x8000) return (u32)bank & 0xFF;
+    return 0;
+}
+
+void PROFILER_Start(void)
+{
+    if (profile_table == NULL)
+    {
+        profile_table = malloc(PROFILER_ENTRIES * sizeof(ProfileEntry_t));
+        if (profile_table == NULL) return;
+    }
+    memset(profile_table, 0x00, PROFILER_ENTRIES * sizeof(ProfileEntry_t));
+    profiler_countdown = PROFILER_INTERVAL;
+    profiler_samples = 0;
+    profiler_dropped = 0;
+    profiler_start_frame = bench_frames;
+    profiler_enabled = 1;
+    BENCH_ResetRegions();       // Bench device regions are reported for the same window
+    HwCountStart();
+    Arm9SampleStart();
+}
+
+void PROFILER_Sample(void)
+{
+    if (--profiler_countdown) return;
+    profiler_countdown = PROFILER_INTERVAL;
+
+    u32 key = regPC | (ProfilerBank(regPC) << 16);
+    u32 idx = (key ^ (key >> 11)) & (PROFILER_ENTRIES-1);
+    for (int probe = 0; probe < 32; probe++)
+    {
+        ProfileEntry_t *entry = &profile_table[idx];
+        if (entry->count == 0) entry->key = key;
+        if (entry->key == key)
+        {
+            entry->count++;
+            profiler_samples++;
+            return;
+        }
+        idx = (idx + 1) & (PROFILER_ENTRIES-1);
+    }
+    profiler_dropped++;     // Table is too crowded around this slot - very unlikely
+}
+
+// ---------------------------------------------------------------------------------
+// A minimal 6502 disassembler - just enough to make the report readable. We only
+// decode the documented opcodes; anything else is shown as ??? with the raw byte.
+// ---------------------------------------------------------------------------------
+enum {AM_IMP, AM_ACC, AM_IMM, AM_ZP, AM_ZPX, AM_ZPY, AM_ABS, AM_ABX, AM_ABY, AM_IND, AM_IZX, AM_IZY, AM_REL};
+
+typedef struct
+{
+    char name[4];
+    u8   mode;
+} Opcode_t;
+
+static const Opcode_t opcodes[256] =
+{
+    {"BRK",AM_IMP}, {"ORA",AM_IZX}, {"???",AM_IMP}, {"???",AM_IMP}, {"???",AM_IMP}, {"ORA",AM_ZP}, {"ASL",AM_ZP}, {"???",AM_IMP},   // 00
+    {"PHP",AM_IMP}, {"ORA",AM_IMM}, {"ASL",AM_ACC}, {"???",AM_IMP}, {"???",AM_IMP}, {"ORA",AM_ABS}, {"ASL",AM_ABS}, {"???",AM_IMP},   // 08
+    {"BPL",AM_REL}, {"ORA",AM_IZY}, {"???",AM_IMP}, {"???",AM_IMP}, {"???",AM_IMP}, {"ORA",AM_ZPX}, {"ASL",AM_ZPX}, {"???",AM_IMP},   // 10
+    {"CLC",AM_IMP}, {"ORA",AM_ABY}, {"???",AM_IMP}, {"???",AM_IMP}, {"???",AM_IMP}, {"ORA",AM_ABX}, {"ASL",AM_ABX}, {"???",AM_IMP},   // 18
+    {"JSR",AM_ABS}, {"AND",AM_IZX}, {"???",AM_IMP}, {"???",AM_IMP}, {"BIT",AM_ZP}, {"AND",AM_ZP}, {"ROL",AM_ZP}, {"???",AM_IMP},   // 20
+    {"PLP",AM_IMP}, {"AND",AM_IMM}, {"ROL",AM_ACC}, {"???",AM_IMP}, {"BIT",AM_ABS}, {"AND",AM_ABS}, {"ROL",AM_ABS}, {"???",AM_IMP},   // 28
+    {"BMI",AM_REL}, {"AND",AM_IZY}, {"???",AM_IMP}, {"???",AM_IMP}, {"???",AM_IMP}, {"AND",AM_ZPX}, {"ROL",AM_ZPX}, {"???",AM_IMP},   // 30
+    {"SEC",AM_IMP}, {"AND",AM_ABY}, {"???",AM_IMP}, {"???",AM_IMP}, {"???",AM_IMP}, {"AND",AM_ABX}, {"ROL",AM_ABX}, {"???",AM_IMP},   // 38
+    {"RTI",AM_IMP}, {"EOR",AM_IZX}, {"???",AM_IMP}, {"???",AM_IMP}, {"???",AM_IMP}, {"EOR",AM_ZP}, {"LSR",AM_ZP}, {"???",AM_IMP},   // 40
+    {"PHA",AM_IMP}, {"EOR",AM_IMM}, {"LSR",AM_ACC}, {"???",AM_IMP}, {"JMP",AM_ABS}, {"EOR",AM_ABS}, {"LSR",AM_ABS}, {"???",AM_IMP},   // 48
+    {"BVC",AM_REL}, {"EOR",AM_IZY}, {"???",AM_IMP}, {"???",AM_IMP}, {"???",AM_IMP}, {"EOR",AM_ZPX}, {"LSR",AM_ZPX}, {"???",AM_IMP},   // 50
+    {"CLI",AM_IMP}, {"EOR",AM_ABY}, {"???",AM_IMP}, {"???",AM_IMP}, {"???",AM_IMP}, {"EOR",AM_ABX}, {"LSR",AM_ABX}, {"???",AM_IMP},   // 58
+    {"RTS",AM_IMP}, {"ADC",AM_IZX}, {"???",AM_IMP}, {"???",AM_IMP}, {"???",AM_IMP}, {"ADC",AM_ZP}, {"ROR",AM_ZP}, {"???",AM_IMP},   // 60
+    {"PLA",AM_IMP}, {"ADC",AM_IMM}, {"ROR",AM_ACC}, {"???",AM_IMP}, {"JMP",AM_IND}, {"ADC",AM_ABS}, {"ROR",AM_ABS}, {"???",AM_IMP},   // 68
+    {"BVS",AM_REL}, {"ADC",AM_IZY}, {"???",AM_IMP}, {"???",AM_IMP}, {"???",AM_IMP}, {"ADC",AM_ZPX}, {"ROR",AM_ZPX}, {"???",AM_IMP},   // 70
+    {"SEI",AM_IMP}, {"ADC",AM_ABY}, {"???",AM_IMP}, {"???",AM_IMP}, {"???",AM_IMP}, {"ADC",AM_ABX}, {"ROR",AM_ABX}, {"???",AM_IMP},   // 78
+    {"???",AM_IMP}, {"STA",AM_IZX}, {"???",AM_IMP}, {"???",AM_IMP}, {"STY",AM_ZP}, {"STA",AM_ZP}, {"STX",AM_ZP}, {"???",AM_IMP},   // 80
+    {"DEY",AM_IMP}, {"???",AM_IMP}, {"TXA",AM_IMP}, {"???",AM_IMP}, {"STY",AM_ABS}, {"STA",AM_ABS}, {"STX",AM_ABS}, {"???",AM_IMP},   // 88
+    {"BCC",AM_REL}, {"STA",AM_IZY}, {"???",AM_IMP}, {"???",AM_IMP}, {"STY",AM_ZPX}, {"STA",AM_ZPX}, {"STX",AM_ZPY}, {"???",AM_IMP},   // 90
+    {"TYA",AM_IMP}, {"STA",AM_ABY}, {"TXS",AM_IMP}, {"???",AM_IMP}, {"???",AM_IMP}, {"STA",AM_ABX}, {"???",AM_IMP}, {"???",AM_IMP},   // 98
+    {"LDY",AM_IMM}, {"LDA",AM_IZX}, {"LDX",AM_IMM}, {"???",AM_IMP}, {"LDY",AM_ZP}, {"LDA",AM_ZP}, {"LDX",AM_ZP}, {"???",AM_IMP},   // A0
+    {"TAY",AM_IMP}, {"LDA",AM_IMM}, {"TAX",AM_IMP}, {"???",AM_IMP}, {"LDY",AM_ABS}, {"LDA",AM_ABS}, {"LDX",AM_ABS}, {"???",AM_IMP},   // A8
+    {"BCS",AM_REL}, {"LDA",AM_IZY}, {"???",AM_IMP}, {"???",AM_IMP}, {"LDY",AM_ZPX}, {"LDA",AM_ZPX}, {"LDX",AM_ZPY}, {"???",AM_IMP},   // B0
+    {"CLV",AM_IMP}, {"LDA",AM_ABY}, {"TSX",AM_IMP}, {"???",AM_IMP}, {"LDY",AM_ABX}, {"LDA",AM_ABX}, {"LDX",AM_ABY}, {"???",AM_IMP},   // B8
+    {"CPY",AM_IMM}, {"CMP",AM_IZX}, {"???",AM_IMP}, {"???",AM_IMP}, {"CPY",AM_ZP}, {"CMP",AM_ZP}, {"DEC",AM_ZP}, {"???",AM_IMP},   // C0
+    {"INY",AM_IMP}, {"CMP",AM_IMM}, {"DEX",AM_IMP}, {"???",AM_IMP}, {"CPY",AM_ABS}, {"CMP",AM_ABS}, {"DEC",AM_ABS}, {"???",AM_IMP},   // C8
+    {"BNE",AM_REL}, {"CMP",AM_IZY}, {"???",AM_IMP}, {"???",AM_IMP}, {"???",AM_IMP}, {"CMP",AM_ZPX}, {"DEC",AM_ZPX}, {"???",AM_IMP},   // D0
+    {"CLD",AM_IMP}, {"CMP",AM_ABY}, {"???",AM_IMP}, {"???",AM_IMP}, {"???",AM_IMP}, {"CMP",AM_ABX}, {"DEC",AM_ABX}, {"???",AM_IMP},   // D8
+    {"CPX",AM_IMM}, {"SBC",AM_IZX}, {"???",AM_IMP}, {"???",AM_IMP}, {"CPX",AM_ZP}, {"SBC",AM_ZP}, {"INC",AM_ZP}, {"???",AM_IMP},   // E0
+    {"INX",AM_IMP}, {"SBC",AM_IMM}, {"NOP",AM_IMP}, {"???",AM_IMP}, {"CPX",AM_ABS}, {"SBC",AM_ABS}, {"INC",AM_ABS}, {"???",AM_IMP},   // E8
+    {"BEQ",AM_REL}, {"SBC",AM_IZY}, {"???",AM_IMP}, {"???",AM_IMP}, {"???",AM_IMP}, {"SBC",AM_ZPX}, {"INC",AM_ZPX}, {"???",AM_IMP},   // F0
+    {"SED",AM_IMP}, {"SBC",AM_ABY}, {"???",AM_IMP}, {"???",AM_IMP}, {"???",AM_IMP}, {"SBC",AM_ABX}, {"INC",AM_ABX}, {"???",AM_IMP},   // F8
+};
+
+static void Disassemble(UWORD pc, char *out)
+{
+    UBYTE op = dGetByte(pc);
+    UBYTE lo = dGetByte((UWORD)(pc+1));
+    UBYTE hi = dGetByte((UWORD)(pc+2));
+    UWORD abs = lo | (hi << 8);
+    const char *name = opcodes[op].name;
+
+    switch (opcodes[op].mode)
+    {
+        case AM_ACC: siprintf(out, "%02X        %s A", op, name);                                  break;
+        case AM_IMM: siprintf(out, "%02X %02X     %s #$%02X", op, lo, name, lo);                   break;
+        case AM_ZP:  siprintf(out, "%02X %02X     %s $%02X", op, lo, name, lo);                    break;
+        case AM_ZPX: siprintf(out, "%02X %02X     %s $%02X,X", op, lo, name, lo);                  break;
+        case AM_ZPY: siprintf(out, "%02X %02X     %s $%02X,Y", op, lo, name, lo);                  break;
+        case AM_ABS: siprintf(out, "%02X %02X %02X  %s $%04X", op, lo, hi, name, abs);             break;
+        case AM_ABX: siprintf(out, "%02X %02X %02X  %s $%04X,X", op, lo, hi, name, abs);           break;
+        case AM_ABY: siprintf(out, "%02X %02X %02X  %s $%04X,Y", op, lo, hi, name, abs);           break;
+        case AM_IND: siprintf(out, "%02X %02X %02X  %s ($%04X)", op, lo, hi, name, abs);           break;
+        case AM_IZX: siprintf(out, "%02X %02X     %s ($%02X,X)", op, lo, name, lo);                break;
+        case AM_IZY: siprintf(out, "%02X %02X     %s ($%02X),Y", op, lo, name, lo);                break;
+        case AM_REL: siprintf(out, "%02X %02X     %s $%04X", op, lo, name, (UWORD)(pc + 2 + (SBYTE)lo)); break;
+        default:     siprintf(out, "%02X        %s", op, name);                                    break;
+    }
+}
+
+// ---------------------------------------------------------------------------------
+// Hardware register access counts. While the profiler runs we swap the GTIA, ANTIC,
+// POKEY and PIA entries in readmap[]/writemap[] for thin counting wrappers that
+// tally each register (folded onto its mirror) and then call the real handler.
+// Writes to WSYNC and to the color registers are also binned by scanline to give
+// a heatmap of where in the frame a game hits them. When the profiler is off the
+// real handlers are in place so there is no cost at all. Note that a cold start
+// rebuilds the handler tables and so quietly ends the register counting.
+// ---------------------------------------------------------------------------------
+#define HW_GTIA         0
+#define HW_ANTIC        1
+#define HW_POKEY        2
+#define HW_PIA          3
+#define HW_CHIPS        4
+#define HW_REGS         32
+#define HW_SCANLINES    TV_PAL_SCANLINES
+#define HW_REGS_FILE    "/data/A8DS_HWREGS.CSV"
+#define HW_HEAT_FILE    "/data/A8DS_HEATMAP.CSV"
+
+static const char *hw_chip_names[HW_CHIPS] = {"GTIA", "ANTIC", "POKEY", "PIA"};
+static const u8 hw_chip_regs[HW_CHIPS] = {32, 16, 16, 4};
+
+static const char *hw_write_names[HW_CHIPS][HW_REGS] =
+{
+    {"HPOSP0","HPOSP1","HPOSP2","HPOSP3","HPOSM0","HPOSM1","HPOSM2","HPOSM3","SIZEP0","SIZEP1","SIZEP2","SIZEP3","SIZEM","GRAFP0","GRAFP1","GRAFP2",
+     "GRAFP3","GRAFM","COLPM0","COLPM1","COLPM2","COLPM3","COLPF0","COLPF1","COLPF2","COLPF3","COLBK","PRIOR","VDELAY","GRACTL","HITCLR","CONSOL"},
+    {"DMACTL","CHACTL","DLISTL","DLISTH","HSCROL","VSCROL","-","PMBASE","-","CHBASE","WSYNC","-","-","-","NMIEN","NMIRES"},
+    {"AUDF1","AUDC1","AUDF2","AUDC2","AUDF3","AUDC3","AUDF4","AUDC4","AUDCTL","STIMER","SKRES","POTGO","-","SEROUT","IRQEN","SKCTL"},
+    {"PORTA","PORTB","PACTL","PBCTL"},
+};
+
+static const char *hw_read_names[HW_CHIPS][HW_REGS] =
+{
+    {"M0PF","M1PF","M2PF","M3PF","P0PF","P1PF","P2PF","P3PF","M0PL","M1PL","M2PL","M3PL","P0PL","P1PL","P2PL","P3PL",
+     "TRIG0","TRIG1","TRIG2","TRIG3","PAL","-","-","-","-","-","-","-","-","-","-","CONSOL"},
+    {"-","-","-","-","-","-","-","-","-","-","-","VCOUNT","PENH","PENV","-","NMIST"},
+    {"POT0","POT1","POT2","POT3","POT4","POT5","POT6","POT7","ALLPOT","KBCODE","RANDOM","-","-","SERIN","IRQST","SKSTAT"},
+    {"PORTA","PORTB","PACTL","PBCTL"},
+};
+
+static u32 *hw_reads = NULL;        // [HW_CHIPS][HW_REGS]
+static u32 *hw_writes = NULL;       // [HW_CHIPS][HW_REGS]
+static u16 *hw_wsync_heat = NULL;   // [HW_SCANLINES]
+static u16 *hw_color_heat = NULL;   // [HW_SCANLINES]
+static u8   hw_counting = 0;
+
+#define HW_READ(chip, addr)     hw_reads[((chip) * HW_REGS) + ((addr) & (hw_chip_regs[chip]-1))]++
+#define HW_WRITE(chip, addr)    hw_writes[((chip) * HW_REGS) + ((addr) & (hw_chip_regs[chip]-1))]++
+#define HW_HEAT(map)            if ((unsigned)ypos < HW_SCANLINES) map[ypos]++
+
+static UBYTE Count_GTIA_GetByte(UWORD addr)                 {HW_READ(HW_GTIA, addr);   return GTIA_GetByte(addr);}
+static UBYTE Count_ANTIC_GetByte(UWORD addr)                {HW_READ(HW_ANTIC, addr);  return ANTIC_GetByte(addr);}
+static UBYTE Count_POKEY_GetByte(UWORD addr)                {HW_READ(HW_POKEY, addr);  return POKEY_GetByte(addr);}
+static UBYTE Count_PIA_GetByte(UWORD addr)                  {HW_READ(HW_PIA, addr);    return PIA_GetByte(addr);}
+static void  Count_POKEY_PutByte(UWORD addr, UBYTE byte)    {HW_WRITE(HW_POKEY, addr); POKEY_PutByte(addr, byte);}
+static void  Count_PIA_PutByte(UWORD addr, UBYTE byte)      {HW_WRITE(HW_PIA, addr);   PIA_PutByte(addr, byte);}
+
+static void Count_GTIA_PutByte(UWORD addr, UBYTE byte)
+{
+    HW_WRITE(HW_GTIA, addr);
+    if (((addr & 0x1f) >= 0x12) && ((addr & 0x1f) <= 0x1a)) {HW_HEAT(hw_color_heat);}   // COLPM0..COLBK
+    GTIA_PutByte(addr, byte);
+}
+
+static void Count_ANTIC_PutByte(UWORD addr, UBYTE byte)
+{
+    HW_WRITE(HW_ANTIC, addr);
+    if ((addr & 0x0f) == 0x0a) {HW_HEAT(hw_wsync_heat);}                                   // WSYNC
+    ANTIC_PutByte(addr, byte);
+}
+
+static const rdfunc hw_real_rd[HW_CHIPS]  = {GTIA_GetByte, ANTIC_GetByte, POKEY_GetByte, PIA_GetByte};
+static const rdfunc hw_count_rd[HW_CHIPS] = {Count_GTIA_GetByte, Count_ANTIC_GetByte, Count_POKEY_GetByte, Count_PIA_GetByte};
+static const wrfunc hw_real_wr[HW_CHIPS]  = {GTIA_PutByte, ANTIC_PutByte, POKEY_PutByte, PIA_PutByte};
+static const wrfunc hw_count_wr[HW_CHIPS] = {Count_GTIA_PutByte, Count_ANTIC_PutByte, Count_POKEY_PutByte, Count_PIA_PutByte};
+
+// Swap every page handled by one of the chips between the real and the counting handlers
+static void HwSwapHandlers(const rdfunc *rd_from, const rdfunc *rd_to, const wrfunc *wr_from, const wrfunc *wr_to)
+{
+    for (int page=0; page<256; page++)
+    {
+        for (int chip=0; chip<HW_CHIPS; chip++)
+        {
+            if (readmap[page]  == rd_from[chip]) MEMORY_SetReadHandler(page, rd_to[chip]);
+            if (writemap[page] == wr_from[chip]) MEMORY_SetWriteHandler(page, wr_to[chip]);
+        }
+    }
+    MEMORY_CHECK_PAGES();
+}
+
+static void HwCountStart(void)
+{
+    if (hw_reads == NULL)
+    {
+        hw_reads  = malloc(2 * HW_CHIPS * HW_REGS * sizeof(u32) + 2 * HW_SCANLINES * sizeof(u16));
+        if (hw_reads == NULL) return;
+        hw_writes = hw_reads + (HW_CHIPS * HW_REGS);
+        hw_wsync_heat = (u16 *)(hw_writes + (HW_CHIPS * HW_REGS));
+        hw_color_heat = hw_wsync_heat + HW_SCANLINES;
+    }
+    memset(hw_reads, 0x00, 2 * HW_CHIPS * HW_REGS * sizeof(u32) + 2 * HW_SCANLINES * sizeof(u16));
+
+    if (!hw_counting) HwSwapHandlers(hw_real_rd, hw_count_rd, hw_real_wr, hw_count_wr);
+    hw_counting = 1;
+}
+
+static void HwCountStop(void)
+{
+    if (hw_counting) HwSwapHandlers(hw_count_rd, hw_real_rd, hw_count_wr, hw_real_wr);
+    hw_counting = 0;
+}
+
+// Per-register totals plus per-frame averages (in hundredths) as CSV
+static u8 HwWriteReport(u32 frames)
+{
+    if (hw_reads == NULL) return 1;
+    if (frames == 0) frames = 1;
+
+    FILE *fp = fopen(HW_REGS_FILE, "w");
+    if (fp == NULL) return 1;
+    fprintf(fp, "chip,reg,read_name,write_name,reads,writes,reads_per_frame,writes_per_frame\n");
+    for (int chip=0; chip<HW_CHIPS; chip++)
+    {
+        for (int reg=0; reg<hw_chip_regs[chip]; reg++)
+        {
+            u32 r = hw_reads[(chip * HW_REGS) + reg];
+            u32 w = hw_writes[(chip * HW_REGS) + reg];
+            if ((r | w) == 0) continue;
+            u32 r100 = (u32)(((u64)r * 100) / frames);
+            u32 w100 = (u32)(((u64)w * 100) / frames);
+            fprintf(fp, "%s,$%02X,%s,%s,%u,%u,%u.%02u,%u.%02u\n", hw_chip_names[chip], reg, hw_read_names[chip][reg], hw_write_names[chip][reg],
+                    (unsigned)r, (unsigned)w, (unsigned)(r100/100), (unsigned)(r100%100), (unsigned)(w100/100), (unsigned)(w100%100));
+        }
+    }
+    fclose(fp);
+
+    fp = fopen(HW_HEAT_FILE, "w");
+    if (fp == NULL) return 1;
+    fprintf(fp, "scanline,wsync_writes,color_writes\n");
+    for (int line=0; line<max_ypos; line++)
+    {
+        fprintf(fp, "%d,%u,%u\n", line, hw_wsync_heat[line], hw_color_heat[line]);
+    }
+    fclose(fp);
+    return 0;
+}
+
+// ---------------------------------------------------------------------------------
+// While the 6502 profiler runs we also sample where the ARM9 itself is spending its
+// time: TIMER3 fires at an odd rate (so it doesn't beat against the frame) and the
+// handler records the PC the IRQ interrupted. TIMER3 is borrowed from the bench
+// device host clock (benchdev.c) which keeps counting through it. The BIOS IRQ entry stacks r0-r3, r12
+// and lr on the IRQ stack before calling the libnds dispatcher - that lr is the
+// interrupted PC+4. The raw PC/count list is written to the SD card and fed to the
+// itcmplace.awk placement generator (see the arm9/Makefile 'placement' target).
+// ---------------------------------------------------------------------------------
+#define ARM9_SAMPLE_HZ      4099
+#define ARM9_PC_ENTRIES     4096        // Must be a power of 2
+#define ARM9_PC_FILE        "/data/A8DS_ARM9PC.TXT"
+
+extern u32 __sp_irq[] __attribute__((weak));     // Top of the IRQ stack (linker script)
+
+static ProfileEntry_t *arm9_pc_table = NULL;
+static u32 arm9_samples = 0;
+static u32 arm9_dropped = 0;
+
+static void Arm9SampleIrq(void)
+{
+    u32 pc = __sp_irq[-1] - 4;      // Last word the BIOS pushed is the interrupted lr_irq
+    u32 idx = ((pc >> 2) ^ (pc >> 13)) & (ARM9_PC_ENTRIES-1);
+    for (int probe = 0; probe < 32; probe++)
+    {
+        ProfileEntry_t *entry = &arm9_pc_table[idx];
+        if (entry->count == 0) entry->key = pc;
+        if (entry->key == pc)
+        {
+            entry->count++;
+            arm9_samples++;
+            return;
+        }
+        idx = (idx + 1) & (ARM9_PC_ENTRIES-1);
+    }
+    arm9_dropped++;
+}
+
+static void Arm9SampleStart(void)
+{
+    Arm9SampleStop();
+    if (__sp_irq == NULL) return;   // No linker symbol - no way to find the interrupted PC
+    if (arm9_pc_table == NULL)
+    {
+        arm9_pc_table = malloc(ARM9_PC_ENTRIES * sizeof(ProfileEntry_t));
+        if (arm9_pc_table == NULL) return;
+    }
+    memset(arm9_pc_table, 0x00, ARM9_PC_ENTRIES * sizeof(ProfileEntry_t));
+    arm9_samples = 0;
+    arm9_dropped = 0;
+
+    BENCH_ClockStart(TIMER_FREQ(ARM9_SAMPLE_HZ), Arm9SampleIrq);
+}
+
+static void Arm9SampleStop(void)
+{
+    BENCH_ClockRelease();
+}
+
+// One 'PC COUNT' line per sampled address - itcmplace.awk folds them into functions
+static u8 Arm9WriteReport(void)
+{
+    if (arm9_pc_table == NULL) return 0;    // Sampling was not available - not an error
+
+    FILE *fp = fopen(ARM9_PC_FILE, "w");
+    if (fp == NULL) return 1;
+    fprintf(fp, "# A8DS ARM9 PC SAMPLES - %s\n", last_boot_file);
+    fprintf(fp, "# Samples: %u (%d Hz)  Dropped: %u\n", (unsigned)arm9_samples, ARM9_SAMPLE_HZ, (unsigned)arm9_dropped);
+    for (int i=0; i<ARM9_PC_ENTRIES; i++)
+    {
+        if (arm9_pc_table[i].count) fprintf(fp, "%08X %u\n", (unsigned)arm9_pc_table[i].key, (unsigned)arm9_pc_table[i].count);
+    }
+    fclose(fp);
+    return 0;
+}
+
+static int CompareCounts(const void *a, const void *b)
+{
+    u32 ca = ((const ProfileEntry_t *)a)->count;
+    u32 cb = ((const ProfileEntry_t *)b)->count;
+    return (ca < cb) ? 1 : ((ca > cb) ? -1 : 0);
+}
+
+// ---------------------------------------------------------------------------------
+// Stop sampling and write out the report. Returns non-zero on error. Note that the
+// disassembly is read through the current memory map - if the bank recorded for an
+// address is not the one mapped in right now we flag it with a '*' since the bytes
+// shown may belong to a different bank.
+// ---------------------------------------------------------------------------------
+u8 PROFILER_Report(void)
+{
+    static char line[64];
+    profiler_enabled = 0;
+    HwCountStop();
+    Arm9SampleStop();
+    if (profile_table == NULL) return 1;
+
+    // Sort in place - the table is rebuilt from scratch on the next PROFILER_Start()
+    qsort(profile_table, PROFILER_ENTRIES, sizeof(ProfileEntry_t), CompareCounts);
+
+    DIR* dir = opendir("/data");
+    if (dir) closedir(dir);
+    else mkdir("/data", 0777);
+
+    FILE *fp = fopen(PROFILER_FILE, "w");
+    if (fp == NULL) return 1;
+
+    u32 total = profiler_samples ? profiler_samples : 1;
+    fprintf(fp, "A8DS 6502 PROFILE\n");
+    fprintf(fp, "Frames: %u  Samples: %u (1 per %d scanlines)  Dropped: %u\n\n",
+            (unsigned)(bench_frames - profiler_start_frame), (unsigned)profiler_samples, PROFILER_INTERVAL, (unsigned)profiler_dropped);
+
+    fprintf(fp, "TOP ADDRESSES\n BANK  ADDR   COUNT    PCT   INSTRUCTION\n");
+    for (int i=0; (i < PROFILER_TOP_ADDRS) && profile_table[i].count; i++)
+    {
+        UWORD pc = profile_table[i].key & 0xFFFF;
+        u32 sample_bank = profile_table[i].key >> 16;
+        Disassemble(pc, line);
+        u32 pct10 = (profile_table[i].count * 1000) / total;
+        fprintf(fp, " %3u%c  $%04X  %6u  %3u.%u%%  %s\n", (unsigned)sample_bank, (sample_bank == ProfilerBank(pc)) ? ' ':'*',
+                pc, (unsigned)profile_table[i].count, (unsigned)(pct10 / 10), (unsigned)(pct10 % 10), line);
+    }
+
+    // Fold the per-address counts into 256-byte pages (per bank) for the hot range list
+    u32 page_keys[PROFILER_TOP_PAGES*4];
+    u32 page_counts[PROFILER_TOP_PAGES*4];
+    int pages = 0;
+    memset(page_counts, 0x00, sizeof(page_counts));
+    for (int i=0; (i < PROFILER_ENTRIES) && profile_table[i].count; i++)
+    {
+        u32 key = profile_table[i].key & 0xFFFFFF00;
+        int j;
+        for (j=0; j<pages; j++) if (page_keys[j] == key) break;
+        if (j == pages)
+        {
+            if (pages == (PROFILER_TOP_PAGES*4)) continue;  // Only the hottest pages matter - the list is already in count order
+            page_keys[pages++] = key;
+        }
+        page_counts[j] += profile_table[i].count;
+    }
+
+    fprintf(fp, "\nHOT RANGES\n BANK  RANGE          COUNT    PCT\n");
+    for (int n=0; n < PROFILER_TOP_PAGES; n++)
+    {
+        int best = -1;
+        for (int j=0; j<pages; j++)
+        {
+            if (page_counts[j] && ((best < 0) || (page_counts[j] > page_counts[best]))) best = j;
+        }
+        if (best < 0) break;
+        UWORD start = page_keys[best] & 0xFF00;
+        u32 pct10 = (page_counts[best] * 1000) / total;
+        fprintf(fp, " %3u   $%04X-$%04X  %6u  %3u.%u%%\n", (unsigned)(page_keys[best] >> 16), start, start | 0xFF,
+                (unsigned)page_counts[best], (unsigned)(pct10 / 10), (unsigned)(pct10 % 10));
+        page_counts[best] = 0;
+    }
+
+    BENCH_WriteReport(fp);
+    fclose(fp);
+    if (Arm9WriteReport()) return 1;
+    return HwWriteReport(bench_frames - profiler_start_frame);
+}
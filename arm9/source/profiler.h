@@ -0,0 +1,33 @@
+/*
+ * profiler.h contains the 6502 hot-spot sampling profiler
+ * 
+ * A8DS - Atari 8-bit Emulator designed to run on the Nintendo DS/DSi is
+ * Copyright (c) 2021-2025 Dave Bernazzani (wavemotion-dave)
+
+ * Copying and distribution of this emulator, its source code and associated 
+ * readme files, with or without modification, are permitted in any medium without 
+ * royalty provided this full copyright notice (including the Atari800 one below) 
+ * is used and wavemotion-dave, alekmaul (original port), Atari800 team (for the
+ * original source) and Avery Lee (Altirra OS) are credited and thanked profusely.
+ * 
+ * The A8DS emulator is offered as-is, without any warranty.
+ * 
+ * Since much of the original codebase came from the Atari800 project, and since
+ * that project is released under the GPL V2, this program and source must also
+ * be distributed using that same licensing model. See COPYING for the full license.
+ */
+#ifndef __PROFILER_H
+#define __PROFILER_H
+
+#include <nds.h>
+
+extern u8 profiler_enabled;
+
+extern void PROFILER_Start(void);
+extern void PROFILER_Sample(void);
+extern u8   PROFILER_Report(void);
+
+// Drop one of these into a per-scanline loop - when the profiler is off it costs a single branch
+#define PROFILER_SCANLINE() if (profiler_enabled) PROFILER_Sample()
+
+#endif